@@ -0,0 +1,526 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/roadmaps/flat_roadmap.hpp"
+#include "lines/roadmaps/roadmap_builder.hpp"
+#include "lines/roadmaps/roadmap_views.hpp"
+#include "lines/roadmaps/roadmaps_algorithms.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace Lines;
+
+namespace {
+LINES_CONSTEXPR std::size_t NODES = 100'000;
+
+// Every node hangs under a random earlier one, which gives the shallow and
+// wide trees large roadmaps tend to be
+auto parents() -> const std::vector<std::size_t> & {
+    static const std::vector<std::size_t> parents = [] {
+        std::mt19937 rng{42};
+        std::vector<std::size_t> parents(NODES);
+        for (std::size_t i = 1; i < NODES; ++i) {
+            parents[i] = rng() % i;
+        }
+        return parents;
+    }();
+    return parents;
+}
+
+// Counts the bytes held through it
+class CountingResource final : public std::pmr::memory_resource {
+    std::size_t _bytes = 0;
+
+    auto do_allocate(std::size_t bytes, std::size_t alignment) -> void * override {
+        _bytes += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override {
+        _bytes -= bytes;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+    LINES_NODISCARD auto do_is_equal(const std::pmr::memory_resource &other) const noexcept
+        -> bool override {
+        return this == &other;
+    }
+
+  public:
+    LINES_NODISCARD auto bytes() const -> std::size_t { return _bytes; }
+};
+
+auto make_roadmap(const Allocator &alloc = {}) -> Roadmap {
+    Roadmap rmap{std::allocator_arg, alloc, RoadmapInfo{"Roadmap"}};
+    const auto &parent = parents();
+    for (std::size_t i = 1; i < NODES; ++i) {
+        rmap.add_node(rmap[parent[i]], RoadmapNodeInfo{"Node"}, i);
+    }
+    return rmap;
+}
+
+auto make_flat_roadmap(const Allocator &alloc = {}) -> FlatRoadmap {
+    FlatRoadmap rmap{std::allocator_arg, alloc, RoadmapInfo{"Roadmap"}};
+    const auto &parent = parents();
+    std::vector<NodeHandle> nodes{rmap.root()};
+    nodes.reserve(NODES);
+    for (std::size_t i = 1; i < NODES; ++i) {
+        nodes.push_back(rmap.add_node(nodes[parent[i]], RoadmapNodeInfo{"Node"}));
+    }
+    return rmap;
+}
+} // namespace
+
+static void BM_RoadmapBuild(benchmark::State &state) {
+    for (auto _ : state) {
+        CountingResource resource;
+        const Roadmap rmap = make_roadmap(&resource);
+        benchmark::DoNotOptimize(&rmap);
+        state.counters["bytes_per_node"] =
+            static_cast<double>(resource.bytes()) / static_cast<double>(NODES);
+    }
+}
+BENCHMARK(BM_RoadmapBuild)->Unit(benchmark::kMillisecond);
+
+static void BM_FlatRoadmapBuild(benchmark::State &state) {
+    for (auto _ : state) {
+        CountingResource resource;
+        const FlatRoadmap rmap = make_flat_roadmap(&resource);
+        benchmark::DoNotOptimize(&rmap);
+        state.counters["bytes_per_node"] =
+            static_cast<double>(resource.bytes()) / static_cast<double>(NODES);
+    }
+}
+BENCHMARK(BM_FlatRoadmapBuild)->Unit(benchmark::kMillisecond);
+
+static void BM_RoadmapBuilder(benchmark::State &state) {
+    const auto &parent = parents();
+    for (auto _ : state) {
+        RoadmapBuilder builder{RoadmapInfo{"Roadmap"}};
+        builder.reserve(NODES - 1);
+        for (std::size_t i = 1; i < NODES; ++i) {
+            builder.add(parent[i], RoadmapNodeInfo{"Node"});
+        }
+        benchmark::DoNotOptimize(builder.build());
+    }
+}
+BENCHMARK(BM_RoadmapBuilder)->Unit(benchmark::kMillisecond);
+
+static void BM_FlatRoadmapBuilder(benchmark::State &state) {
+    const auto &parent = parents();
+    for (auto _ : state) {
+        RoadmapBuilder builder{RoadmapInfo{"Roadmap"}};
+        builder.reserve(NODES - 1);
+        for (std::size_t i = 1; i < NODES; ++i) {
+            builder.add(parent[i], RoadmapNodeInfo{"Node"});
+        }
+        benchmark::DoNotOptimize(builder.build_flat());
+    }
+}
+BENCHMARK(BM_FlatRoadmapBuilder)->Unit(benchmark::kMillisecond);
+
+// Adding nodes to a roadmap with a thousand leaves removed
+static void BM_RoadmapRefill(benchmark::State &state) {
+    const Roadmap built = make_roadmap();
+    std::vector<RoadmapNode::NodeID> leaves;
+    Roadmaps::dfs_foreach(built, [&](const RoadmapNode::NodePtr &node) {
+        const auto nptr = node.lock();
+        if (nptr->out_degree() == 0 && leaves.size() < 1000) {
+            leaves.push_back(nptr->id());
+        }
+    });
+    std::optional<Roadmap> rmap;
+    for (auto _ : state) {
+        state.PauseTiming();
+        rmap.reset();
+        rmap.emplace(make_roadmap());
+        for (const auto id : leaves) {
+            rmap->remove_node(id);
+        }
+        state.ResumeTiming();
+        for (std::size_t i = 0; i < 2 * leaves.size(); ++i) {
+            rmap->add_node(rmap->root(), RoadmapNodeInfo{"Node"});
+        }
+    }
+}
+BENCHMARK(BM_RoadmapRefill)->Unit(benchmark::kMillisecond);
+
+// Deleting the branch under node 1, which holds most of the tree
+auto branch() -> std::vector<RoadmapNode::NodeID> {
+    std::vector<RoadmapNode::NodeID> nodes{1};
+    std::vector<bool> inside(NODES);
+    inside[1] = true;
+    const auto &parent = parents();
+    for (std::size_t i = 2; i < NODES; ++i) {
+        if (inside[parent[i]]) {
+            inside[i] = true;
+            nodes.push_back(i);
+        }
+    }
+    return nodes;
+}
+
+static void BM_RoadmapRemoveBranchByNode(benchmark::State &state) {
+    std::optional<Roadmap> rmap;
+    const std::vector<RoadmapNode::NodeID> nodes = branch();
+    for (auto _ : state) {
+        state.PauseTiming();
+        rmap.reset();
+        rmap.emplace(make_roadmap());
+        state.ResumeTiming();
+        for (const auto id : nodes) {
+            rmap->remove_node(id);
+        }
+    }
+    state.counters["nodes"] = static_cast<double>(nodes.size());
+}
+BENCHMARK(BM_RoadmapRemoveBranchByNode)->Unit(benchmark::kMillisecond);
+
+static void BM_RoadmapRemoveSubtree(benchmark::State &state) {
+    std::optional<Roadmap> rmap;
+    for (auto _ : state) {
+        state.PauseTiming();
+        rmap.reset();
+        rmap.emplace(make_roadmap());
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(rmap->remove_subtree(1));
+    }
+}
+BENCHMARK(BM_RoadmapRemoveSubtree)->Unit(benchmark::kMillisecond);
+
+static void BM_FlatRoadmapRemoveSubtree(benchmark::State &state) {
+    std::optional<FlatRoadmap> rmap;
+    for (auto _ : state) {
+        state.PauseTiming();
+        rmap.reset();
+        rmap.emplace(make_flat_roadmap());
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(rmap->remove_subtree(*rmap->find(1)));
+    }
+}
+BENCHMARK(BM_FlatRoadmapRemoveSubtree)->Unit(benchmark::kMillisecond);
+
+static void BM_RoadmapDfs(benchmark::State &state) {
+    const Roadmap rmap = make_roadmap();
+    for (auto _ : state) {
+        std::size_t visited = 0;
+        Roadmaps::dfs_foreach(rmap, [&](const RoadmapNode::NodePtr &) { ++visited; });
+        benchmark::DoNotOptimize(visited);
+    }
+}
+BENCHMARK(BM_RoadmapDfs)->Unit(benchmark::kMillisecond);
+
+static void BM_FlatRoadmapDfs(benchmark::State &state) {
+    const FlatRoadmap rmap = make_flat_roadmap();
+    for (auto _ : state) {
+        std::size_t visited = 0;
+        Roadmaps::dfs_foreach(rmap, [&](NodeHandle) { ++visited; });
+        benchmark::DoNotOptimize(visited);
+    }
+}
+BENCHMARK(BM_FlatRoadmapDfs)->Unit(benchmark::kMillisecond);
+
+static void BM_RoadmapBfs(benchmark::State &state) {
+    const Roadmap rmap = make_roadmap();
+    for (auto _ : state) {
+        std::size_t visited = 0;
+        Roadmaps::bfs_foreach(rmap, [&](const RoadmapNode::NodePtr &) { ++visited; });
+        benchmark::DoNotOptimize(visited);
+    }
+}
+BENCHMARK(BM_RoadmapBfs)->Unit(benchmark::kMillisecond);
+
+static void BM_FlatRoadmapBfs(benchmark::State &state) {
+    const FlatRoadmap rmap = make_flat_roadmap();
+    for (auto _ : state) {
+        std::size_t visited = 0;
+        Roadmaps::bfs_foreach(rmap, [&](NodeHandle) { ++visited; });
+        benchmark::DoNotOptimize(visited);
+    }
+}
+BENCHMARK(BM_FlatRoadmapBfs)->Unit(benchmark::kMillisecond);
+
+static void BM_RoadmapDfsVector(benchmark::State &state) {
+    const Roadmap rmap = make_roadmap();
+    for (auto _ : state) {
+        std::size_t completed = 0;
+        for (const auto &node : Roadmaps::dfs(rmap)) {
+            completed += node.lock()->state() == RoadmapNode::State::Completed ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(completed);
+    }
+}
+BENCHMARK(BM_RoadmapDfsVector)->Unit(benchmark::kMillisecond);
+
+static void BM_FlatRoadmapPreorderView(benchmark::State &state) {
+    const FlatRoadmap rmap = make_flat_roadmap();
+    for (auto _ : state) {
+        std::size_t completed = 0;
+        for (const NodeHandle node : Roadmaps::preorder(rmap)) {
+            completed += rmap.state(node) == RoadmapNode::State::Completed ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(completed);
+    }
+}
+BENCHMARK(BM_FlatRoadmapPreorderView)->Unit(benchmark::kMillisecond);
+
+static void BM_FlatRoadmapPostorderView(benchmark::State &state) {
+    const FlatRoadmap rmap = make_flat_roadmap();
+    for (auto _ : state) {
+        std::size_t completed = 0;
+        for (const NodeHandle node : Roadmaps::postorder(rmap)) {
+            completed += rmap.state(node) == RoadmapNode::State::Completed ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(completed);
+    }
+}
+BENCHMARK(BM_FlatRoadmapPostorderView)->Unit(benchmark::kMillisecond);
+
+static void BM_FlatRoadmapLevelorderView(benchmark::State &state) {
+    const FlatRoadmap rmap = make_flat_roadmap();
+    std::vector<NodeHandle> buffer;
+    for (auto _ : state) {
+        std::size_t completed = 0;
+        for (const NodeHandle node : Roadmaps::levelorder(rmap, buffer)) {
+            completed += rmap.state(node) == RoadmapNode::State::Completed ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(completed);
+    }
+}
+BENCHMARK(BM_FlatRoadmapLevelorderView)->Unit(benchmark::kMillisecond);
+
+// Finding the first incomplete leaf when every branch under the root but
+// the last one is completed
+static void BM_FlatRoadmapFirstIncompleteLeaf(benchmark::State &state) {
+    FlatRoadmap rmap = make_flat_roadmap();
+    const NodeHandle last = rmap.last_child(rmap.root());
+    for (NodeHandle child = rmap.first_child(rmap.root()); child != last;
+         child = rmap.next_sibling(child)) {
+        rmap.set_state(child, RoadmapNode::State::Completed);
+    }
+    const bool prune = state.range(0) != 0;
+    for (auto _ : state) {
+        NodeHandle found;
+        Roadmaps::dfs_foreach(rmap, [&](NodeHandle node) {
+            if (prune && rmap.state(node) == RoadmapNode::State::Completed) {
+                return Roadmaps::Visit::SkipChildren;
+            }
+            if (!found.valid() && !rmap.first_child(node).valid() &&
+                rmap.state(node) != RoadmapNode::State::Completed) {
+                found = node;
+                return prune ? Roadmaps::Visit::Stop : Roadmaps::Visit::Continue;
+            }
+            return Roadmaps::Visit::Continue;
+        });
+        benchmark::DoNotOptimize(found);
+    }
+}
+BENCHMARK(BM_FlatRoadmapFirstIncompleteLeaf)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+namespace {
+// Random (ancestor, node) pairs over the NODES ids
+auto query_pairs() -> const std::vector<std::pair<std::size_t, std::size_t>> & {
+    static const std::vector<std::pair<std::size_t, std::size_t>> pairs = [] {
+        std::mt19937 rng{7};
+        std::vector<std::pair<std::size_t, std::size_t>> pairs(1'000);
+        for (auto &[ancestor, node] : pairs) {
+            ancestor = rng() % 64;
+            node = rng() % NODES;
+        }
+        return pairs;
+    }();
+    return pairs;
+}
+} // namespace
+
+static void BM_RoadmapIsAncestorWalk(benchmark::State &state) {
+    Roadmap rmap = make_roadmap();
+    for (auto _ : state) {
+        std::size_t hits = 0;
+        for (const auto &[ancestor, node] : query_pairs()) {
+            for (auto up = rmap[node].lock()->parent().lock(); up; up = up->parent().lock()) {
+                if (up->id() == ancestor) {
+                    ++hits;
+                    break;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+}
+BENCHMARK(BM_RoadmapIsAncestorWalk)->Unit(benchmark::kMicrosecond);
+
+static void BM_RoadmapIsAncestor(benchmark::State &state) {
+    const Roadmap rmap = make_roadmap();
+    for (auto _ : state) {
+        std::size_t hits = 0;
+        for (const auto &[ancestor, node] : query_pairs()) {
+            hits += rmap.is_ancestor(ancestor, node) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+}
+BENCHMARK(BM_RoadmapIsAncestor)->Unit(benchmark::kMicrosecond);
+
+static void BM_FlatRoadmapIsAncestor(benchmark::State &state) {
+    FlatRoadmap rmap = make_flat_roadmap();
+    for (auto _ : state) {
+        std::size_t hits = 0;
+        for (const auto &[ancestor, node] : query_pairs()) {
+            hits += rmap.is_ancestor(*rmap.find(ancestor), *rmap.find(node)) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+}
+BENCHMARK(BM_FlatRoadmapIsAncestor)->Unit(benchmark::kMicrosecond);
+
+// One leaf added, then a query: relabels from the new leaf onwards. Arg(0)
+// adds under the first node in pre-order, Arg(1) under the last.
+static void BM_FlatRoadmapRelabel(benchmark::State &state) {
+    FlatRoadmap rmap = make_flat_roadmap();
+    const auto order = Roadmaps::dfs(rmap);
+    const NodeHandle parent = state.range(0) == 0 ? order[1] : order.back();
+    const NodeHandle root = rmap.root();
+    for (auto _ : state) {
+        const NodeHandle leaf = rmap.add_node(parent, RoadmapNodeInfo{"Leaf"});
+        benchmark::DoNotOptimize(rmap.subtree_size(root));
+        state.PauseTiming();
+        rmap.remove_node(leaf);
+        benchmark::DoNotOptimize(rmap.subtree_size(root));
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_FlatRoadmapRelabel)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+static void BM_RoadmapRelabel(benchmark::State &state) {
+    Roadmap rmap = make_roadmap();
+    const auto order = Roadmaps::dfs(rmap);
+    const auto parent = state.range(0) == 0 ? order[1] : order.back();
+    for (auto _ : state) {
+        const auto leaf = rmap.add_node(parent, RoadmapNodeInfo{"Leaf"}).lock()->id();
+        benchmark::DoNotOptimize(rmap.subtree_size(Roadmap::ROOT_ID));
+        state.PauseTiming();
+        rmap.remove_node(leaf);
+        benchmark::DoNotOptimize(rmap.subtree_size(Roadmap::ROOT_ID));
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_RoadmapRelabel)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+// Common ancestors of random node pairs by collecting both parent chains
+static void BM_RoadmapLcaChains(benchmark::State &state) {
+    Roadmap rmap = make_roadmap();
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (const auto &[first, second] : query_pairs()) {
+            std::vector<RoadmapNode::NodeID> up;
+            std::vector<RoadmapNode::NodeID> down;
+            for (auto node = rmap[first * (NODES / 64)].lock(); node;
+                 node = node->parent().lock()) {
+                up.push_back(node->id());
+            }
+            for (auto node = rmap[second].lock(); node; node = node->parent().lock()) {
+                down.push_back(node->id());
+            }
+            while (up.size() > 1 && down.size() > 1 && up[up.size() - 2] == down[down.size() - 2]) {
+                up.pop_back();
+                down.pop_back();
+            }
+            sum += up.back();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_RoadmapLcaChains)->Unit(benchmark::kMicrosecond);
+
+static void BM_RoadmapLca(benchmark::State &state) {
+    const Roadmap rmap = make_roadmap();
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (const auto &[first, second] : query_pairs()) {
+            sum += rmap.lca(first * (NODES / 64), second);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_RoadmapLca)->Unit(benchmark::kMicrosecond);
+
+static void BM_FlatRoadmapLca(benchmark::State &state) {
+    FlatRoadmap rmap = make_flat_roadmap();
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (const auto &[first, second] : query_pairs()) {
+            sum += rmap.id(rmap.lca(*rmap.find(first * (NODES / 64)), *rmap.find(second)));
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_FlatRoadmapLca)->Unit(benchmark::kMicrosecond);
+
+// A state change followed by reading the progress of a branch under the root.
+// The states cycle, NODES - 1 is not a multiple of 4 so every change is one.
+static void BM_RoadmapProgressDfs(benchmark::State &state) {
+    Roadmap rmap = make_roadmap();
+    std::vector<std::shared_ptr<RoadmapNode>> stack;
+    std::size_t node = 0;
+    std::size_t changes = 0;
+    for (auto _ : state) {
+        node = (node + 7919) % (NODES - 1) + 1;
+        rmap[node].lock()->set_state(static_cast<RoadmapNode::State>(++changes % 4));
+        std::size_t completed = 0;
+        std::size_t total = 0;
+        stack.assign(1, rmap[1].lock());
+        while (!stack.empty()) {
+            const auto top = std::move(stack.back());
+            stack.pop_back();
+            ++total;
+            completed += top->state() == RoadmapNode::State::Completed ? 1 : 0;
+            for (const auto &child : top->children()) {
+                stack.push_back(child.lock());
+            }
+        }
+        benchmark::DoNotOptimize(completed * total);
+    }
+}
+BENCHMARK(BM_RoadmapProgressDfs)->Unit(benchmark::kMillisecond);
+
+static void BM_RoadmapProgress(benchmark::State &state) {
+    Roadmap rmap = make_roadmap();
+    std::size_t node = 0;
+    std::size_t changes = 0;
+    for (auto _ : state) {
+        node = (node + 7919) % (NODES - 1) + 1;
+        rmap[node].lock()->set_state(static_cast<RoadmapNode::State>(++changes % 4));
+        benchmark::DoNotOptimize(rmap.progress(1).ratio());
+    }
+}
+BENCHMARK(BM_RoadmapProgress)->Unit(benchmark::kMicrosecond);
+
+static void BM_FlatRoadmapProgress(benchmark::State &state) {
+    FlatRoadmap rmap = make_flat_roadmap();
+    const NodeHandle branch = *rmap.find(1);
+    std::size_t node = 0;
+    std::size_t changes = 0;
+    for (auto _ : state) {
+        node = (node + 7919) % (NODES - 1) + 1;
+        rmap.set_state(*rmap.find(node), static_cast<RoadmapNode::State>(++changes % 4));
+        benchmark::DoNotOptimize(rmap.progress(branch).ratio());
+    }
+}
+BENCHMARK(BM_FlatRoadmapProgress)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,105 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/search/text_index.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Lines::Search;
+
+namespace {
+LINES_CONSTEXPR std::size_t TITLES = 1'000'000;
+
+auto make_titles() -> std::vector<std::string> {
+    static LINES_CONSTEXPR std::array<std::string_view, 16> words{
+        "Write",  "report", "Fix",      "CI",     "call",   "mom",     "buy",   "groceries",
+        "review", "pull",   "request",  "gym",    "plan",   "roadmap", "Learn", "piano"};
+    std::mt19937 rng{42}; // NOLINT
+    std::uniform_int_distribution<std::size_t> word(0, words.size() - 1);
+    std::uniform_int_distribution<int> count(2, 5);
+    std::vector<std::string> titles;
+    titles.reserve(TITLES);
+    for (std::size_t i = 0; i < TITLES; ++i) {
+        std::string title;
+        for (int w = count(rng); w > 0; --w) {
+            title += words[word(rng)];
+            title += ' ';
+        }
+        title += std::to_string(i);
+        titles.push_back(std::move(title));
+    }
+    return titles;
+}
+
+auto titles() -> const std::vector<std::string> & {
+    static const auto value = make_titles();
+    return value;
+}
+
+auto index() -> const TextIndex & {
+    static const auto value = [] {
+        TextIndex result;
+        for (std::size_t i = 0; i < titles().size(); ++i) {
+            result.insert(static_cast<DocID>(i), titles()[i]);
+        }
+        return result;
+    }();
+    return value;
+}
+
+const std::array<std::string_view, 3> QUERIES{"roadmap", "view pull", "123456"};
+} // namespace
+
+static void BM_TextIndexBuild(benchmark::State &state) {
+    for (auto _ : state) {
+        TextIndex result;
+        for (std::size_t i = 0; i < titles().size(); ++i) {
+            result.insert(static_cast<DocID>(i), titles()[i]);
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * titles().size()));
+}
+BENCHMARK(BM_TextIndexBuild)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+static void BM_TextIndexSearch(benchmark::State &state) {
+    const auto &idx = index();
+    const auto query = QUERIES[static_cast<std::size_t>(state.range(0))];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(idx.search(query, MatchMode::Substring, 50));
+    }
+    state.SetLabel(std::string{query});
+}
+BENCHMARK(BM_TextIndexSearch)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+static void BM_LinearScan(benchmark::State &state) {
+    const auto &all = titles();
+    const auto query = fold_case(QUERIES[static_cast<std::size_t>(state.range(0))]);
+    for (auto _ : state) {
+        std::vector<DocID> hits;
+        for (std::size_t i = 0; i < all.size(); ++i) {
+            if (fold_case(all[i]).find(query) != std::string::npos) {
+                hits.push_back(static_cast<DocID>(i));
+            }
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetLabel(query);
+}
+BENCHMARK(BM_LinearScan)->DenseRange(0, 2)->Unit(benchmark::kMillisecond);
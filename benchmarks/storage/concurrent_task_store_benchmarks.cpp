@@ -0,0 +1,144 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/concurrent_task_store.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Lines;
+using namespace Lines::Storage;
+
+namespace {
+LINES_CONSTEXPR std::size_t TASKS = 100'000;
+
+auto make_task(std::size_t i) -> Task {
+    Task task{TaskInfo{"Task " + std::to_string(i), std::nullopt, {"work"}}};
+    task.set_deadline(Temporal::TimePoint{Temporal::Days{static_cast<int64_t>(i % 365)}});
+    return task;
+}
+
+// Keeps updating random tasks while the readers run
+class Writer {
+    std::atomic<bool> _stop{false};
+    std::thread _thread;
+
+  public:
+    template <typename F> explicit Writer(F update) {
+        _thread = std::thread{[this, update] {
+            std::mt19937 random{7};
+            while (!_stop.load(std::memory_order_relaxed)) {
+                update(random() % TASKS);
+            }
+        }};
+    }
+    Writer(const Writer &) = delete;
+    Writer(Writer &&) = delete;
+    auto operator=(const Writer &) -> Writer & = delete;
+    auto operator=(Writer &&) -> Writer & = delete;
+    ~Writer() {
+        _stop.store(true);
+        _thread.join();
+    }
+};
+
+auto shared_store() -> ConcurrentTaskStore & {
+    static ConcurrentTaskStore store{64};
+    static const bool filled = [] {
+        for (std::size_t i = 0; i < TASKS; ++i) {
+            store.insert(make_task(i));
+        }
+        return true;
+    }();
+    (void)filled;
+    return store;
+}
+
+// The previous approach: one workspace behind a global mutex
+struct LockedTasks {
+    std::mutex mutex;
+    std::vector<Task> tasks;
+};
+
+auto locked_tasks() -> LockedTasks & {
+    static LockedTasks locked;
+    static const bool filled = [] {
+        locked.tasks.reserve(TASKS);
+        for (std::size_t i = 0; i < TASKS; ++i) {
+            locked.tasks.push_back(make_task(i));
+        }
+        return true;
+    }();
+    (void)filled;
+    return locked;
+}
+
+void BM_ConcurrentStoreRead(benchmark::State &state) {
+    ConcurrentTaskStore &store = shared_store();
+    std::unique_ptr<Writer> writer;
+    if (state.thread_index() == 0) {
+        writer = std::make_unique<Writer>([&store](std::size_t id) {
+            store.update(static_cast<TaskID>(id), [](Task &task) { task.advance_deadline(); });
+        });
+    }
+    std::mt19937 random{static_cast<unsigned>(state.thread_index())};
+    for (auto _ : state) {
+        const auto id = static_cast<TaskID>(random() % TASKS);
+        benchmark::DoNotOptimize(store.read(id, [](const Task *task) { return task->deadline(); }));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_MutexWorkspaceRead(benchmark::State &state) {
+    LockedTasks &locked = locked_tasks();
+    std::unique_ptr<Writer> writer;
+    if (state.thread_index() == 0) {
+        writer = std::make_unique<Writer>([&locked](std::size_t id) {
+            const std::lock_guard lock{locked.mutex};
+            locked.tasks[id].advance_deadline();
+        });
+    }
+    std::mt19937 random{static_cast<unsigned>(state.thread_index())};
+    for (auto _ : state) {
+        const auto id = random() % TASKS;
+        const std::lock_guard lock{locked.mutex};
+        benchmark::DoNotOptimize(locked.tasks[id].deadline());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Whole-store scans through one snapshot
+void BM_ConcurrentStoreScan(benchmark::State &state) {
+    ConcurrentTaskStore &store = shared_store();
+    for (auto _ : state) {
+        std::size_t count = 0;
+        store.snapshot().for_each(
+            [&](TaskID /*id*/, const Task &task) { count += task.completed(); });
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(TASKS));
+}
+} // namespace
+
+BENCHMARK(BM_ConcurrentStoreRead)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_MutexWorkspaceRead)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_ConcurrentStoreScan)->ThreadRange(1, 8)->UseRealTime()->Unit(benchmark::kMillisecond);
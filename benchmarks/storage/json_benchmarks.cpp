@@ -0,0 +1,148 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/json.hpp"
+#include "lines/storage/json_io.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+using namespace Lines;
+using namespace Lines::Storage;
+
+namespace {
+LINES_CONSTEXPR std::size_t DOCUMENT_SIZE = 100 * 1024 * 1024;
+LINES_CONSTEXPR std::size_t DISTINCT_TASKS = 64;
+
+// Discards output, only counts it
+class NullBuffer : public std::streambuf {
+  public:
+    std::size_t written = 0;
+
+  protected:
+    auto overflow(int_type chr) -> int_type override {
+        ++written;
+        return traits_type::not_eof(chr);
+    }
+    auto xsputn(const char * /*str*/, std::streamsize count) -> std::streamsize override {
+        written += static_cast<std::size_t>(count);
+        return count;
+    }
+};
+
+// Reads a string in place
+class MemoryBuffer : public std::streambuf {
+  public:
+    explicit MemoryBuffer(const std::string &data) {
+        char *begin = const_cast<char *>(data.data()); // NOLINT
+        setg(begin, begin, begin + data.size());
+    }
+};
+
+auto sample_tasks() -> std::vector<Task> {
+    std::vector<Task> tasks;
+    for (std::size_t i = 0; i < DISTINCT_TASKS; ++i) {
+        const std::string title = "Task number " + std::to_string(i) + " with a \"quoted\" word";
+        tasks.emplace_back(
+            TaskInfo{title, "Description of the task,\twith an escape", {"work", "q3"}});
+        tasks.back().set_deadline(Temporal::TimePoint{Temporal::Days{static_cast<int64_t>(i)}});
+        if (i % 2 == 0) {
+            tasks.back().set_repeat_rule(TaskRepeatRule{
+                .repeat_type = TaskRepeat::EveryUnit{
+                    .interval = Temporal::duration_cast<Temporal::Seconds>(Temporal::Days{1}),
+                    .unit_str = "days"}});
+        }
+    }
+    return tasks;
+}
+
+// Writes tasks round-robin into an array until `out` holds about DOCUMENT_SIZE bytes
+void write_document(std::ostream &out, const NullBuffer *counter = nullptr) {
+    static const auto tasks = sample_tasks();
+    std::size_t written = 0;
+    JsonWriter writer{out};
+    writer.begin_array();
+    for (std::size_t i = 0; written < DOCUMENT_SIZE; ++i) {
+        write_json(writer, tasks[i % tasks.size()]);
+        if (i % DISTINCT_TASKS == 0) {
+            writer.flush();
+            written = counter != nullptr ? counter->written : static_cast<std::size_t>(out.tellp());
+        }
+    }
+    writer.end_array();
+}
+
+auto document() -> const std::string & {
+    static const std::string value = [] {
+        std::ostringstream out;
+        write_document(out);
+        return out.str();
+    }();
+    return value;
+}
+} // namespace
+
+static void BM_JsonWriteTasks(benchmark::State &state) {
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        NullBuffer buffer;
+        std::ostream out{&buffer};
+        write_document(out, &buffer);
+        bytes += buffer.written;
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+BENCHMARK(BM_JsonWriteTasks)->Unit(benchmark::kMillisecond);
+
+static void BM_JsonTokenize(benchmark::State &state) {
+    const std::string &json = document();
+    for (auto _ : state) {
+        MemoryBuffer buffer{json};
+        std::istream in{&buffer};
+        JsonReader reader{in};
+        std::size_t count = 0;
+        while (reader.next() != JsonToken::End) {
+            ++count;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * json.size()));
+}
+BENCHMARK(BM_JsonTokenize)->Unit(benchmark::kMillisecond);
+
+static void BM_JsonReadTasks(benchmark::State &state) {
+    const std::string &json = document();
+    for (auto _ : state) {
+        MemoryBuffer buffer{json};
+        std::istream in{&buffer};
+        JsonReader reader{in};
+        reader.expect(JsonToken::BeginArray);
+        std::size_t count = 0;
+        while (reader.peek() != JsonToken::EndArray) {
+            const Task task = read_task(reader);
+            benchmark::DoNotOptimize(task.completed());
+            ++count;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * json.size()));
+}
+BENCHMARK(BM_JsonReadTasks)->Unit(benchmark::kMillisecond);
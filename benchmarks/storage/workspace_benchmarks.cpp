@@ -0,0 +1,102 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/file.hpp"
+#include "lines/storage/workspace.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <string>
+
+using namespace Lines;
+using namespace Lines::Storage;
+
+namespace {
+LINES_CONSTEXPR std::size_t TASKS = 1'000'000;
+LINES_CONSTEXPR std::size_t ROADMAPS = 1'000;
+LINES_CONSTEXPR std::size_t NODES_PER_ROADMAP = 100;
+
+// Snapshot of an account with 1M tasks and 100K roadmap nodes, written once
+auto snapshot_path() -> const std::filesystem::path & {
+    static const std::filesystem::path path = [] {
+        auto path = std::filesystem::temp_directory_path() / "lines-workspace-benchmark";
+        Workspace workspace;
+        workspace.tasks.reserve(TASKS);
+        for (std::size_t i = 0; i < TASKS; ++i) {
+            workspace.tasks.emplace_back(
+                TaskInfo{"Task " + std::to_string(i), std::nullopt, {"work", "q3"}});
+            workspace.tasks.back().set_deadline(
+                Temporal::TimePoint{Temporal::Days{static_cast<int64_t>(i % 365)}});
+        }
+        workspace.roadmaps.reserve(ROADMAPS);
+        for (std::size_t i = 0; i < ROADMAPS; ++i) {
+            Roadmap &rmap =
+                workspace.roadmaps.emplace_back(RoadmapInfo{"Roadmap " + std::to_string(i)});
+            auto parent = rmap.root();
+            for (std::size_t node = 0; node < NODES_PER_ROADMAP; ++node) {
+                const auto added =
+                    rmap.add_node(parent, RoadmapNodeInfo{"Step " + std::to_string(node)});
+                if (node % 10 == 0) {
+                    parent = added;
+                }
+            }
+        }
+        save_workspace_snapshot(path, workspace);
+        return path;
+    }();
+    return path;
+}
+
+void BM_MappedWorkspaceOpen(benchmark::State &state) {
+    const auto &path = snapshot_path();
+    for (auto _ : state) {
+        MappedWorkspace workspace{path};
+        benchmark::DoNotOptimize(workspace.task_count());
+    }
+    state.counters["items"] = static_cast<double>(TASKS + ROADMAPS * NODES_PER_ROADMAP);
+}
+
+void BM_MappedWorkspaceOpenVerified(benchmark::State &state) {
+    const auto &path = snapshot_path();
+    for (auto _ : state) {
+        MappedWorkspace workspace{path, Verify::Checksums};
+        benchmark::DoNotOptimize(workspace.task_count());
+    }
+}
+
+// Opening and reading one title, the page holding it has to be faulted in
+void BM_MappedWorkspaceFirstRead(benchmark::State &state) {
+    const auto &path = snapshot_path();
+    for (auto _ : state) {
+        MappedWorkspace workspace{path};
+        benchmark::DoNotOptimize(workspace.tasks()[TASKS / 2].title());
+    }
+}
+
+// The previous approach: reading the file and parsing every item
+void BM_ReadWorkspaceSnapshot(benchmark::State &state) {
+    const auto &path = snapshot_path();
+    for (auto _ : state) {
+        auto workspace = read_workspace_snapshot(read_file(path), Verify::Structure);
+        benchmark::DoNotOptimize(workspace.tasks.size());
+    }
+}
+} // namespace
+
+BENCHMARK(BM_MappedWorkspaceOpen)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MappedWorkspaceOpenVerified)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MappedWorkspaceFirstRead)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ReadWorkspaceSnapshot)->Unit(benchmark::kMillisecond);
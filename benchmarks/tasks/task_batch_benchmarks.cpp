@@ -0,0 +1,82 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/execution/work_stealing.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_batch.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace Lines;
+
+namespace {
+LINES_CONSTEXPR std::size_t TASKS = 1'000'000;
+
+// Nightly workload: repeating tasks, half every few days, half on weekdays.
+// Advancing from the same timepoint is idempotent, so the tasks are reused.
+auto repeating_tasks() -> std::vector<Task> & {
+    static std::vector<Task> tasks = [] {
+        std::vector<Task> tasks;
+        tasks.reserve(TASKS);
+        for (std::size_t i = 0; i < TASKS; ++i) {
+            TaskRepeatRule rule{
+                .repeat_type = TaskRepeat::EveryUnit{
+                    .interval = Temporal::Seconds{static_cast<int64_t>(1 + i % 7) * 86400},
+                    .unit_str = "days"}};
+            if (i % 2 == 0) {
+                std::pmr::vector<Temporal::Weekday> weekdays;
+                weekdays.push_back(static_cast<Temporal::Weekday>(i % 7));
+                rule.repeat_type = TaskRepeat::EveryWeekday{.weekdays = weekdays};
+            }
+            tasks.emplace_back(TaskInfo{"Task"}, rule);
+            tasks.back().set_deadline(Temporal::TimePoint{Temporal::Days{1}});
+        }
+        return tasks;
+    }();
+    return tasks;
+}
+
+const Temporal::TimePoint COMPLETED_AT{Temporal::Days{20'000}};
+
+void BM_AdvanceDeadlineLoop(benchmark::State &state) {
+    auto &tasks = repeating_tasks();
+    for (auto _ : state) {
+        for (Task &task : tasks) {
+            task.advance_deadline(COMPLETED_AT);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(TASKS));
+}
+
+void BM_AdvanceDeadlines(benchmark::State &state) {
+    auto &tasks = repeating_tasks();
+    Execution::WorkStealingExecutor executor{static_cast<std::size_t>(state.range(0))};
+    for (auto _ : state) {
+        Tasks::advance_deadlines(tasks, COMPLETED_AT, executor);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(TASKS));
+}
+} // namespace
+
+BENCHMARK(BM_AdvanceDeadlineLoop)->Unit(benchmark::kMillisecond);
+// Worker threads, the scaling curve by core count
+BENCHMARK(BM_AdvanceDeadlines)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,137 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_sort.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+using namespace Lines;
+
+namespace {
+LINES_CONSTEXPR std::size_t TASKS = 1'000'000;
+LINES_CONSTEXPR std::size_t TOP = 100;
+
+// An account's agenda: deadlines spread over a few years, one in ten
+// undated, a quarter completed
+auto agenda() -> const std::vector<Task> & {
+    static const std::vector<Task> tasks = [] {
+        std::mt19937 rng{42};
+        std::vector<Task> tasks;
+        tasks.reserve(TASKS);
+        for (std::size_t i = 0; i < TASKS; ++i) {
+            Task &task = tasks.emplace_back(TaskInfo{"Task " + std::to_string(rng() % 1000)});
+            if (rng() % 10 != 0) {
+                const auto seconds = 1'700'000'000 + static_cast<int64_t>(rng() % 100'000'000);
+                task.set_deadline(Temporal::TimePoint{Temporal::Seconds{seconds}});
+            }
+            if (rng() % 4 == 0) {
+                task.complete();
+            }
+        }
+        return tasks;
+    }();
+    return tasks;
+}
+
+// The comparator agendas are sorted with today
+auto deadline_before(const std::vector<Task> &tasks) {
+    return [&](std::uint32_t lhs, std::uint32_t rhs) {
+        const auto &left = tasks[lhs].deadline();
+        const auto &right = tasks[rhs].deadline();
+        if (left.has_value() != right.has_value()) {
+            return left.has_value();
+        }
+        return left && *left < *right;
+    };
+}
+
+void BM_StdSortByDeadline(benchmark::State &state) {
+    const auto &tasks = agenda();
+    for (auto _ : state) {
+        auto permutation = Tasks::identity_permutation(tasks);
+        std::ranges::sort(permutation, deadline_before(tasks));
+        benchmark::DoNotOptimize(permutation.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(TASKS));
+}
+
+void BM_RadixSortByDeadline(benchmark::State &state) {
+    const auto &tasks = agenda();
+    for (auto _ : state) {
+        auto permutation = Tasks::sort_by_deadline(tasks);
+        benchmark::DoNotOptimize(permutation.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(TASKS));
+}
+
+void BM_StdStableSortMultiKey(benchmark::State &state) {
+    const auto &tasks = agenda();
+    const auto before = deadline_before(tasks);
+    for (auto _ : state) {
+        auto permutation = Tasks::identity_permutation(tasks);
+        std::ranges::stable_sort(permutation, [&](std::uint32_t lhs, std::uint32_t rhs) {
+            if (before(lhs, rhs) || before(rhs, lhs)) {
+                return before(lhs, rhs);
+            }
+            return std::tuple{tasks[lhs].completed(), std::string_view{tasks[lhs].title()}} <
+                   std::tuple{tasks[rhs].completed(), std::string_view{tasks[rhs].title()}};
+        });
+        benchmark::DoNotOptimize(permutation.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(TASKS));
+}
+
+void BM_SortByMultiKey(benchmark::State &state) {
+    const auto &tasks = agenda();
+    for (auto _ : state) {
+        auto permutation = Tasks::identity_permutation(tasks);
+        Tasks::sort_by(permutation, tasks);
+        benchmark::DoNotOptimize(permutation.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(TASKS));
+}
+
+void BM_StdPartialSortTop(benchmark::State &state) {
+    const auto &tasks = agenda();
+    for (auto _ : state) {
+        auto permutation = Tasks::identity_permutation(tasks);
+        std::ranges::partial_sort(permutation, permutation.begin() + TOP, deadline_before(tasks));
+        benchmark::DoNotOptimize(permutation.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(TASKS));
+}
+
+void BM_TopByDeadline(benchmark::State &state) {
+    const auto &tasks = agenda();
+    for (auto _ : state) {
+        auto top = Tasks::top_by_deadline(tasks, TOP);
+        benchmark::DoNotOptimize(top.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(TASKS));
+}
+} // namespace
+
+BENCHMARK(BM_StdSortByDeadline)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RadixSortByDeadline)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StdStableSortMultiKey)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SortByMultiKey)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StdPartialSortTop)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TopByDeadline)->Unit(benchmark::kMillisecond);
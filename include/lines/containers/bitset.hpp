@@ -0,0 +1,177 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace Lines::Containers {
+// Dense, dynamically sized bitset stored as 64-bit words.
+// Bits past size() in the last word are always kept zero.
+class LINES_API Bitset {
+  public:
+    using Word = std::uint64_t;
+    static LINES_CONSTEXPR std::size_t WORD_BITS = 64;
+
+  private:
+    std::vector<Word> _words;
+    std::size_t _size{};
+
+    LINES_NODISCARD static auto words_for(std::size_t bits) -> std::size_t {
+        return (bits + WORD_BITS - 1) / WORD_BITS;
+    }
+
+    void clear_tail() {
+        const std::size_t tail = _size % WORD_BITS;
+        if (tail != 0) {
+            _words.back() &= (Word{1} << tail) - 1;
+        }
+    }
+
+    void check_size(const Bitset &other) const {
+        if (other._size != _size) {
+            throw std::invalid_argument("Bitset: size mismatch");
+        }
+    }
+
+  public:
+    Bitset() = default;
+    explicit Bitset(std::size_t size, bool value = false)
+        : _words(words_for(size), value ? ~Word{0} : Word{0}), _size(size) {
+        clear_tail();
+    }
+
+    LINES_NODISCARD auto size() const -> std::size_t { return _size; }
+    LINES_NODISCARD auto empty() const -> bool { return _size == 0; }
+
+    void resize(std::size_t size, bool value = false) {
+        const std::size_t old_size = _size;
+        _words.resize(words_for(size), value ? ~Word{0} : Word{0});
+        _size = size;
+        if (value && size > old_size && old_size % WORD_BITS != 0) {
+            _words[old_size / WORD_BITS] |= ~Word{0} << (old_size % WORD_BITS);
+        }
+        clear_tail();
+    }
+
+    void push_back(bool value) {
+        resize(_size + 1);
+        set(_size - 1, value);
+    }
+
+    LINES_NODISCARD auto test(std::size_t pos) const -> bool {
+        return ((_words[pos / WORD_BITS] >> (pos % WORD_BITS)) & 1U) != 0;
+    }
+
+    LINES_NODISCARD auto operator[](std::size_t pos) const -> bool { return test(pos); }
+
+    void set(std::size_t pos, bool value = true) {
+        const Word bit = Word{1} << (pos % WORD_BITS);
+        Word &word = _words[pos / WORD_BITS];
+        word = value ? (word | bit) : (word & ~bit);
+    }
+
+    void reset(std::size_t pos) { set(pos, false); }
+
+    void reset() { std::ranges::fill(_words, Word{0}); }
+
+    LINES_NODISCARD auto count() const -> std::size_t {
+        std::size_t total = 0;
+        for (const Word word : _words) {
+            total += static_cast<std::size_t>(std::popcount(word));
+        }
+        return total;
+    }
+
+    LINES_NODISCARD auto any() const -> bool {
+        return std::ranges::any_of(_words, [](Word word) { return word != 0; });
+    }
+
+    LINES_NODISCARD auto none() const -> bool { return !any(); }
+
+    LINES_NODISCARD auto words() const -> std::span<const Word> { return _words; }
+    LINES_NODISCARD auto words() -> std::span<Word> { return _words; }
+
+    auto flip() -> Bitset & {
+        for (Word &word : _words) {
+            word = ~word;
+        }
+        clear_tail();
+        return *this;
+    }
+
+    auto operator~() const -> Bitset {
+        auto temp = *this;
+        temp.flip();
+        return temp;
+    }
+
+    auto operator&=(const Bitset &other) -> Bitset & {
+        check_size(other);
+        for (std::size_t i = 0; i < _words.size(); ++i) {
+            _words[i] &= other._words[i];
+        }
+        return *this;
+    }
+
+    auto operator|=(const Bitset &other) -> Bitset & {
+        check_size(other);
+        for (std::size_t i = 0; i < _words.size(); ++i) {
+            _words[i] |= other._words[i];
+        }
+        return *this;
+    }
+
+    auto operator^=(const Bitset &other) -> Bitset & {
+        check_size(other);
+        for (std::size_t i = 0; i < _words.size(); ++i) {
+            _words[i] ^= other._words[i];
+        }
+        return *this;
+    }
+
+    // this &= ~other
+    auto subtract(const Bitset &other) -> Bitset & {
+        check_size(other);
+        for (std::size_t i = 0; i < _words.size(); ++i) {
+            _words[i] &= ~other._words[i];
+        }
+        return *this;
+    }
+
+    friend auto operator&(Bitset lhs, const Bitset &rhs) -> Bitset { return lhs &= rhs; }
+    friend auto operator|(Bitset lhs, const Bitset &rhs) -> Bitset { return lhs |= rhs; }
+    friend auto operator^(Bitset lhs, const Bitset &rhs) -> Bitset { return lhs ^= rhs; }
+
+    auto operator==(const Bitset &other) const -> bool = default;
+
+    // Calls fn(index) for every set bit in ascending order.
+    template <typename Fn> void for_each_set(Fn &&fn) const {
+        for (std::size_t i = 0; i < _words.size(); ++i) {
+            Word word = _words[i];
+            while (word != 0) {
+                fn(i * WORD_BITS + static_cast<std::size_t>(std::countr_zero(word)));
+                word &= word - 1;
+            }
+        }
+    }
+};
+} // namespace Lines::Containers
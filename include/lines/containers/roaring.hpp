@@ -0,0 +1,137 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace Lines::Containers {
+// Compressed bitmap of 32-bit integers in the spirit of Roaring bitmaps.
+// Values are split by their high 16 bits into containers. A container stores
+// its low 16 bits either as a sorted array (sparse) or as a 65536-bit bitmap
+// (dense), switching representation at ARRAY_LIMIT values.
+class LINES_API RoaringBitmap {
+  public:
+    using Value = std::uint32_t;
+
+    class LINES_API Container {
+      public:
+        static LINES_CONSTEXPR std::uint32_t ARRAY_LIMIT = 4096;
+        static LINES_CONSTEXPR std::size_t BITMAP_WORDS = 1024;
+
+      private:
+        std::vector<std::uint16_t> _array;
+        std::vector<std::uint64_t> _bitmap;
+        std::uint32_t _cardinality{};
+
+        void to_bitmap();
+        void to_array();
+        void normalize();
+
+      public:
+        LINES_NODISCARD auto is_bitmap() const -> bool { return !_bitmap.empty(); }
+        LINES_NODISCARD auto cardinality() const -> std::uint32_t { return _cardinality; }
+        LINES_NODISCARD auto contains(std::uint16_t low) const -> bool;
+        auto add(std::uint16_t low) -> bool;
+        auto remove(std::uint16_t low) -> bool;
+
+        template <typename Fn> void for_each(Fn &&fn) const {
+            if (!is_bitmap()) {
+                for (const std::uint16_t low : _array) {
+                    fn(low);
+                }
+                return;
+            }
+            for (std::size_t i = 0; i < BITMAP_WORDS; ++i) {
+                std::uint64_t word = _bitmap[i];
+                while (word != 0) {
+                    fn(static_cast<std::uint16_t>(i * 64 + std::countr_zero(word)));
+                    word &= word - 1;
+                }
+            }
+        }
+
+        LINES_NODISCARD static auto intersect(const Container &lhs, const Container &rhs)
+            -> Container;
+        LINES_NODISCARD static auto unite(const Container &lhs, const Container &rhs)
+            -> Container;
+        LINES_NODISCARD static auto subtract(const Container &lhs, const Container &rhs)
+            -> Container;
+
+        auto operator==(const Container &other) const -> bool = default;
+    };
+
+  private:
+    std::vector<std::uint16_t> _keys;
+    std::vector<Container> _containers;
+
+    LINES_NODISCARD auto find(std::uint16_t key) const -> std::size_t;
+
+  public:
+    RoaringBitmap() = default;
+    RoaringBitmap(std::initializer_list<Value> values);
+
+    auto add(Value value) -> bool;
+    auto remove(Value value) -> bool;
+    LINES_NODISCARD auto contains(Value value) const -> bool;
+
+    LINES_NODISCARD auto cardinality() const -> std::size_t;
+    LINES_NODISCARD auto empty() const -> bool { return _containers.empty(); }
+    void clear();
+
+    LINES_NODISCARD auto container_count() const -> std::size_t { return _containers.size(); }
+
+    // Calls fn(value) for every value in ascending order.
+    template <typename Fn> void for_each(Fn &&fn) const {
+        for (std::size_t i = 0; i < _containers.size(); ++i) {
+            const Value high = static_cast<Value>(_keys[i]) << 16U;
+            _containers[i].for_each([&](std::uint16_t low) { fn(high | low); });
+        }
+    }
+
+    LINES_NODISCARD auto to_vector() const -> std::vector<Value>;
+
+    auto operator&=(const RoaringBitmap &other) -> RoaringBitmap &;
+    auto operator|=(const RoaringBitmap &other) -> RoaringBitmap &;
+    auto operator-=(const RoaringBitmap &other) -> RoaringBitmap &;
+
+    LINES_NODISCARD friend auto operator&(const RoaringBitmap &lhs, const RoaringBitmap &rhs)
+        -> RoaringBitmap {
+        auto temp = lhs;
+        temp &= rhs;
+        return temp;
+    }
+
+    LINES_NODISCARD friend auto operator|(const RoaringBitmap &lhs, const RoaringBitmap &rhs)
+        -> RoaringBitmap {
+        auto temp = lhs;
+        temp |= rhs;
+        return temp;
+    }
+
+    LINES_NODISCARD friend auto operator-(const RoaringBitmap &lhs, const RoaringBitmap &rhs)
+        -> RoaringBitmap {
+        auto temp = lhs;
+        temp -= rhs;
+        return temp;
+    }
+
+    auto operator==(const RoaringBitmap &other) const -> bool = default;
+};
+} // namespace Lines::Containers
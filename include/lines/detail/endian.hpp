@@ -0,0 +1,59 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Lines::detail {
+// Reads a little-endian integer from possibly unaligned storage
+template <std::integral T> auto load_le(const std::byte *src) -> T {
+    using U = std::make_unsigned_t<T>;
+    U value{};
+    LINES_CONSTEXPR_IF(std::endian::native == std::endian::little) {
+        std::memcpy(&value, src, sizeof(U));
+    }
+    else {
+        for (std::size_t i = 0; i < sizeof(U); ++i) {
+            value |= static_cast<U>(static_cast<U>(src[i]) << (8 * i)); // NOLINT
+        }
+    }
+    return static_cast<T>(value);
+}
+
+// Writes `value` as a little-endian integer into possibly unaligned storage
+template <std::integral T> void store_le(std::byte *dst, T value) {
+    using U = std::make_unsigned_t<T>;
+    const auto bits = static_cast<U>(value);
+    LINES_CONSTEXPR_IF(std::endian::native == std::endian::little) {
+        std::memcpy(dst, &bits, sizeof(U));
+    }
+    else {
+        for (std::size_t i = 0; i < sizeof(U); ++i) {
+            dst[i] = static_cast<std::byte>(bits >> (8 * i)); // NOLINT
+        }
+    }
+}
+
+template <std::integral T> void append_le(std::vector<std::byte> &out, T value) {
+    out.resize(out.size() + sizeof(T));
+    store_le(out.data() + out.size() - sizeof(T), value);
+}
+} // namespace Lines::detail
@@ -149,3 +149,23 @@
 #else
 #define LINES_CONSTEXPR_IF if
 #endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define LINES_X86_64 1
+#else
+#define LINES_X86_64 0
+#endif
+
+// SIMD paths are selected at compile time from the target flags
+// (e.g. -mavx2 or /arch:AVX2). Scalar fallbacks are always available.
+#if LINES_X86_64 && defined(__AVX2__)
+#define LINES_HAS_AVX2 1
+#else
+#define LINES_HAS_AVX2 0
+#endif
+
+#if LINES_X86_64 && (defined(__SSE4_2__) || LINES_HAS_AVX2)
+#define LINES_HAS_SSE42 1
+#else
+#define LINES_HAS_SSE42 0
+#endif
@@ -0,0 +1,105 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include <initializer_list>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Lines {
+// Allocator used by all allocator-aware types of the library. Passing a
+// std::pmr::memory_resource lets whole workspaces live in one arena.
+using Allocator = std::pmr::polymorphic_allocator<>;
+
+using Tags = std::pmr::vector<std::pmr::string>;
+
+namespace detail {
+inline auto make_tags(std::initializer_list<std::string_view> tags, const Allocator &alloc)
+    -> Tags {
+    Tags result(alloc);
+    result.reserve(tags.size());
+    for (const auto tag : tags) {
+        result.emplace_back(tag);
+    }
+    return result;
+}
+
+inline auto make_tags(const std::vector<std::string> &tags, const Allocator &alloc) -> Tags {
+    Tags result(alloc);
+    result.reserve(tags.size());
+    for (const auto &tag : tags) {
+        result.emplace_back(tag);
+    }
+    return result;
+}
+
+inline auto to_strings(const Tags &tags) -> std::vector<std::string> {
+    std::vector<std::string> result;
+    result.reserve(tags.size());
+    for (const auto &tag : tags) {
+        result.emplace_back(tag);
+    }
+    return result;
+}
+
+inline auto make_optional_string(const std::optional<std::string_view> &str,
+                                 const Allocator &alloc) -> std::optional<std::pmr::string> {
+    if (!str) {
+        return std::nullopt;
+    }
+    return std::pmr::string(*str, alloc);
+}
+
+// Optional strings are not allocator-aware themselves, so values are
+// (re)constructed explicitly with the allocator of the owner.
+inline void assign_optional_string(std::optional<std::pmr::string> &target,
+                                   const std::optional<std::string_view> &value,
+                                   const Allocator &alloc) {
+    if (!value) {
+        target.reset();
+    } else if (target) {
+        target->assign(*value);
+    } else {
+        target.emplace(*value, alloc);
+    }
+}
+
+inline auto copy_optional_string(const std::optional<std::pmr::string> &str,
+                                 const Allocator &alloc) -> std::optional<std::pmr::string> {
+    if (!str) {
+        return std::nullopt;
+    }
+    return std::pmr::string(*str, alloc);
+}
+
+inline auto move_optional_string(std::optional<std::pmr::string> &&str, const Allocator &alloc)
+    -> std::optional<std::pmr::string> {
+    if (!str) {
+        return std::nullopt;
+    }
+    return std::pmr::string(std::move(*str), alloc);
+}
+
+inline auto view_optional_string(const std::optional<std::pmr::string> &str)
+    -> std::optional<std::string_view> {
+    if (!str) {
+        return std::nullopt;
+    }
+    return std::string_view{*str};
+}
+} // namespace detail
+} // namespace Lines
@@ -0,0 +1,46 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+
+namespace Lines::detail {
+// Attachment of an object to an observer under an id. It follows the object
+// when it is moved, copies of the object start detached and copy assignment
+// keeps the attachment of the target.
+template <typename Observer, typename Id> struct ObserverHook {
+    Observer *observer{};
+    Id id{};
+
+    ObserverHook() = default;
+    ObserverHook(const ObserverHook & /*other*/) LINES_NOEXCEPT {}
+    ObserverHook(ObserverHook &&other) LINES_NOEXCEPT : observer(other.observer), id(other.id) {
+        other.observer = nullptr;
+    }
+    auto operator=(const ObserverHook & /*other*/) LINES_NOEXCEPT -> ObserverHook & {
+        return *this;
+    }
+    auto operator=(ObserverHook &&other) LINES_NOEXCEPT -> ObserverHook & {
+        if (this != &other) {
+            observer = other.observer;
+            id = other.id;
+            other.observer = nullptr;
+        }
+        return *this;
+    }
+    ~ObserverHook() = default;
+
+    explicit operator bool() const { return observer != nullptr; }
+};
+} // namespace Lines::detail
@@ -0,0 +1,80 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Lines::Execution {
+template <typename Signature> class FunctionRef;
+
+// Non-owning reference to a callable, cheap to pass through virtual calls.
+// The callable has to outlive the reference.
+template <typename R, typename... Args> class FunctionRef<R(Args...)> {
+    void *_object;
+    R (*_call)(void *, Args...);
+
+  public:
+    template <typename F>
+        requires(!std::is_same_v<std::remove_cvref_t<F>, FunctionRef> &&
+                 std::is_invocable_r_v<R, F &, Args...>)
+    FunctionRef(F &&fn) noexcept // NOLINT(google-explicit-constructor)
+        : _object(const_cast<void *>(static_cast<const void *>(std::addressof(fn)))),
+          _call([](void *object, Args... args) -> R {
+              return std::invoke(
+                  *static_cast<std::add_pointer_t<std::remove_reference_t<F>>>(object),
+                  std::forward<Args>(args)...);
+          }) {}
+
+    auto operator()(Args... args) const -> R { return _call(_object, std::forward<Args>(args)...); }
+};
+
+// Where library batch operations run their work. Implement it to route the
+// work of the library into a thread pool of your own.
+class LINES_API Executor {
+  public:
+    Executor() = default;
+    Executor(const Executor &) = default;
+    Executor(Executor &&) = default;
+    auto operator=(const Executor &) -> Executor & = default;
+    auto operator=(Executor &&) -> Executor & = default;
+    virtual ~Executor() = default;
+
+    // Calls fn(i) for every i in [0, count), possibly concurrently, and
+    // returns once every call is done. Rethrows the first exception of fn,
+    // the calls not started yet are skipped then.
+    virtual void bulk(std::size_t count, FunctionRef<void(std::size_t)> fn) = 0;
+    // Number of calls that may run at once
+    LINES_NODISCARD virtual auto concurrency() const -> std::size_t = 0;
+};
+
+// Runs everything on the calling thread, in index order
+class LINES_API InlineExecutor final : public Executor {
+  public:
+    void bulk(std::size_t count, FunctionRef<void(std::size_t)> fn) override;
+    LINES_NODISCARD auto concurrency() const -> std::size_t override { return 1; }
+};
+
+// Executor the batch operations use unless they are given one. It is a
+// WorkStealingExecutor over every hardware thread, created on first use.
+LINES_NODISCARD LINES_API auto default_executor() -> Executor &;
+// Makes default_executor() return `executor`, nullptr restores the built-in
+// one. The executor has to outlive every batch operation using it.
+LINES_API void set_default_executor(Executor *executor);
+} // namespace Lines::Execution
@@ -0,0 +1,104 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/execution/executor.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Lines::Execution {
+namespace detail {
+// Chunks handed to the executor per thread when no grain is given, enough
+// for stealing to even out uneven work
+LINES_CONSTEXPR std::size_t CHUNKS_PER_THREAD = 8;
+
+inline auto grain_for(const Executor &executor, std::size_t count, std::size_t grain)
+    -> std::size_t {
+    if (grain != 0) {
+        return grain;
+    }
+    return std::max<std::size_t>(1, count / (executor.concurrency() * CHUNKS_PER_THREAD));
+}
+
+// Result of one chunk of parallel_reduce. The wrapper keeps std::vector<bool>
+// from packing the results of several chunks into one word.
+template <typename T> struct Partial {
+    T value;
+};
+} // namespace detail
+
+// Calls fn(i) for every i in [begin, end) on `executor`. The range is cut into
+// chunks of `grain` indices, 0 picks a grain from the executor's concurrency.
+template <typename F>
+void parallel_for(Executor &executor, std::size_t begin, std::size_t end, F &&fn,
+                  std::size_t grain = 0) {
+    if (begin >= end) {
+        return;
+    }
+    const std::size_t count = end - begin;
+    grain = detail::grain_for(executor, count, grain);
+    executor.bulk((count + grain - 1) / grain, [&](std::size_t chunk) {
+        const std::size_t first = begin + chunk * grain;
+        const std::size_t last = first + std::min(grain, end - first);
+        for (std::size_t i = first; i < last; ++i) {
+            fn(i);
+        }
+    });
+}
+
+template <typename F>
+void parallel_for(std::size_t begin, std::size_t end, F &&fn, std::size_t grain = 0) {
+    parallel_for(default_executor(), begin, end, std::forward<F>(fn), grain);
+}
+
+// Folds every chunk of [begin, end) with acc = fold(std::move(acc), i),
+// starting from `identity`, then combines the chunk results left to right.
+// For a given grain the result does not depend on the executor.
+template <typename T, typename Fold, typename Combine>
+auto parallel_reduce(Executor &executor, std::size_t begin, std::size_t end, T identity,
+                     Fold &&fold, Combine &&combine, std::size_t grain = 0) -> T {
+    if (begin >= end) {
+        return identity;
+    }
+    const std::size_t count = end - begin;
+    grain = detail::grain_for(executor, count, grain);
+    std::vector<detail::Partial<T>> partial((count + grain - 1) / grain,
+                                            detail::Partial<T>{identity});
+    executor.bulk(partial.size(), [&](std::size_t chunk) {
+        const std::size_t first = begin + chunk * grain;
+        const std::size_t last = first + std::min(grain, end - first);
+        T acc = std::move(partial[chunk].value);
+        for (std::size_t i = first; i < last; ++i) {
+            acc = fold(std::move(acc), i);
+        }
+        partial[chunk].value = std::move(acc);
+    });
+    T result = std::move(identity);
+    for (auto &chunk : partial) {
+        result = combine(std::move(result), std::move(chunk.value));
+    }
+    return result;
+}
+
+template <typename T, typename Fold, typename Combine>
+auto parallel_reduce(std::size_t begin, std::size_t end, T identity, Fold &&fold,
+                     Combine &&combine, std::size_t grain = 0) -> T {
+    return parallel_reduce(default_executor(), begin, end, std::move(identity),
+                           std::forward<Fold>(fold), std::forward<Combine>(combine), grain);
+}
+} // namespace Lines::Execution
@@ -0,0 +1,209 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/temporal/timepoint.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+
+namespace Lines::Execution {
+// Source of the current time for timers
+class LINES_API Clock {
+  public:
+    Clock() = default;
+    Clock(const Clock &) = default;
+    Clock(Clock &&) = default;
+    auto operator=(const Clock &) -> Clock & = default;
+    auto operator=(Clock &&) -> Clock & = default;
+    virtual ~Clock() = default;
+
+    LINES_NODISCARD virtual auto now() const -> Temporal::TimePoint = 0;
+};
+
+// Temporal::UTCClock
+class LINES_API SystemClock final : public Clock {
+  public:
+    LINES_NODISCARD auto now() const -> Temporal::TimePoint override;
+};
+
+// Simulated time, only moves when told to. Safe to read from any thread.
+class LINES_API ManualClock final : public Clock {
+    std::atomic<std::int64_t> _seconds;
+
+  public:
+    explicit ManualClock(const Temporal::TimePoint &start)
+        : _seconds(start.time_since_epoch().count()) {}
+
+    LINES_NODISCARD auto now() const -> Temporal::TimePoint override {
+        return Temporal::TimePoint{Temporal::Seconds{_seconds.load()}};
+    }
+    void set(const Temporal::TimePoint &now) { _seconds.store(now.time_since_epoch().count()); }
+    void advance(const Temporal::Seconds &by) { _seconds.fetch_add(by.count()); }
+};
+
+// Timers ordered by the time they are due. Nothing runs by itself: whoever
+// drives the queue calls run_due(), either an event loop of the embedding
+// application, asking next_wakeup() for how long it may sleep, or a
+// TimerThread, one thread at a time. Scheduling and cancelling are safe from
+// any thread, timers fire on the thread driving the queue.
+class LINES_API TimerQueue {
+  public:
+    // Pending wake-up, owned by whoever schedules it. A timer is cancelled
+    // when destroyed, destroying it while it fires on another thread waits
+    // for fire() to return. Derived timers call disarm() first thing in
+    // their destructor, their members are gone by the time ~Timer() runs.
+    class LINES_API Timer {
+        friend class TimerQueue;
+        std::atomic<TimerQueue *> _queue{nullptr};  // set while pending
+        std::atomic<TimerQueue *> _firing{nullptr}; // set while fire() runs
+        std::multimap<Temporal::TimePoint, Timer *>::iterator _position;
+
+      public:
+        Timer() = default;
+        Timer(const Timer &) = delete;
+        Timer(Timer &&) = delete;
+        auto operator=(const Timer &) -> Timer & = delete;
+        auto operator=(Timer &&) -> Timer & = delete;
+        virtual ~Timer();
+
+        // Called once the timer is due, after it left the queue
+        virtual void fire() = 0;
+        // Called instead of fire() for timers still pending when the queue
+        // is destroyed
+        virtual void abandon() {}
+
+      protected:
+        // Cancels the timer and waits for a fire() running on another thread
+        void disarm();
+    };
+
+  private:
+    const Clock &_clock;
+    mutable std::mutex _mutex;
+    std::condition_variable_any _changed;
+    std::multimap<Temporal::TimePoint, Timer *> _timers;
+    bool _woken = false;
+    // The timer run_due() is firing, reset by its destructor if fire()
+    // destroys it
+    Timer *_current = nullptr;
+    std::thread::id _driver;
+    std::condition_variable _fired;
+
+    // Leaves the timer neither pending nor firing in this queue
+    void release(Timer &timer);
+
+  public:
+    explicit TimerQueue(const Clock &clock) : _clock(clock) {}
+    TimerQueue(const TimerQueue &) = delete;
+    TimerQueue(TimerQueue &&) = delete;
+    auto operator=(const TimerQueue &) -> TimerQueue & = delete;
+    auto operator=(TimerQueue &&) -> TimerQueue & = delete;
+    // Abandons the pending timers, nothing may drive the queue any more
+    ~TimerQueue();
+
+    LINES_NODISCARD auto clock() const -> const Clock & { return _clock; }
+
+    // (Re)schedules `timer` at `at`. Timers due at the same time fire in the
+    // order they were scheduled.
+    void schedule(Timer &timer, const Temporal::TimePoint &at);
+    // Returns false if the timer was not pending
+    auto cancel(Timer &timer) -> bool;
+
+    // Fires every timer due by now in time order, returns how many fired
+    auto run_due() -> std::size_t;
+    LINES_NODISCARD auto next_wakeup() const -> std::optional<Temporal::TimePoint>;
+    LINES_NODISCARD auto pending() const -> std::size_t;
+
+    // Drives the queue until `stop` is requested, sleeping until the next
+    // timer is due
+    void run(std::stop_token stop);
+    // Makes run() look at the clock again, needed after a ManualClock moved
+    void wake();
+};
+
+// Thread driving a TimerQueue
+class LINES_API TimerThread {
+    std::jthread _thread;
+
+  public:
+    explicit TimerThread(TimerQueue &queue)
+        : _thread([&queue](std::stop_token stop) { queue.run(std::move(stop)); }) {}
+    TimerThread(const TimerThread &) = delete;
+    TimerThread(TimerThread &&) = delete;
+    auto operator=(const TimerThread &) -> TimerThread & = delete;
+    auto operator=(TimerThread &&) -> TimerThread & = delete;
+    ~TimerThread() = default;
+};
+
+// Queue over SystemClock with a TimerThread of its own, created on first use
+LINES_NODISCARD LINES_API auto default_timers() -> TimerQueue &;
+
+// Fire-and-forget coroutine, starts right away and frees its frame when it
+// finishes. An escaping exception terminates.
+struct LINES_API Detached {
+    struct promise_type {
+        auto get_return_object() noexcept -> Detached { return {}; }
+        auto initial_suspend() noexcept -> std::suspend_never { return {}; }
+        auto final_suspend() noexcept -> std::suspend_never { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+// co_await until(queue, tp) resumes the coroutine once the queue's clock
+// reaches `tp`, on the thread driving the queue. A coroutine still waiting
+// when the queue is destroyed is destroyed with it.
+class LINES_API UntilAwaitable final : private TimerQueue::Timer {
+    TimerQueue &_queue;
+    Temporal::TimePoint _at;
+    std::coroutine_handle<> _handle;
+
+    void fire() override { _handle.resume(); }
+    void abandon() override { _handle.destroy(); }
+
+  public:
+    UntilAwaitable(TimerQueue &queue, const Temporal::TimePoint &at) : _queue(queue), _at(at) {}
+    UntilAwaitable(const UntilAwaitable &) = delete;
+    UntilAwaitable(UntilAwaitable &&) = delete;
+    auto operator=(const UntilAwaitable &) -> UntilAwaitable & = delete;
+    auto operator=(UntilAwaitable &&) -> UntilAwaitable & = delete;
+    ~UntilAwaitable() override { disarm(); }
+
+    LINES_NODISCARD auto await_ready() const -> bool { return _at <= _queue.clock().now(); }
+    void await_suspend(std::coroutine_handle<> handle) {
+        _handle = handle;
+        _queue.schedule(*this, _at);
+    }
+    void await_resume() const noexcept {}
+};
+
+LINES_NODISCARD inline auto until(TimerQueue &queue, const Temporal::TimePoint &at)
+    -> UntilAwaitable {
+    return {queue, at};
+}
+LINES_NODISCARD inline auto until(const Temporal::TimePoint &at) -> UntilAwaitable {
+    return {default_timers(), at};
+}
+} // namespace Lines::Execution
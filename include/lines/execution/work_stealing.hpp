@@ -0,0 +1,202 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/execution/executor.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Lines::Execution {
+// Chase-Lev work-stealing deque (Le, Pop, Cohen, Zappa Nardelli, "Correct
+// and Efficient Work-Stealing for Weak Memory Models"). The owner pushes and
+// pops at the bottom, any other thread steals from the top. The buffer grows
+// on demand, replaced buffers are kept until the deque is destroyed because
+// a thief may still read from them.
+template <typename T> class ChaseLevDeque {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    class Buffer {
+        std::int64_t _mask;
+        std::unique_ptr<std::atomic<T>[]> _slots;
+
+      public:
+        explicit Buffer(std::int64_t capacity)
+            : _mask(capacity - 1), _slots(std::make_unique<std::atomic<T>[]>(capacity)) {}
+
+        LINES_NODISCARD auto capacity() const -> std::int64_t { return _mask + 1; }
+        LINES_NODISCARD auto get(std::int64_t i) const -> T {
+            return _slots[i & _mask].load(std::memory_order_relaxed);
+        }
+        void put(std::int64_t i, T value) {
+            _slots[i & _mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(64) std::atomic<std::int64_t> _top{0};
+    alignas(64) std::atomic<std::int64_t> _bottom{0};
+    std::atomic<Buffer *> _buffer;
+    std::vector<std::unique_ptr<Buffer>> _buffers; // owner only
+
+    auto grow(Buffer *buffer, std::int64_t bottom, std::int64_t top) -> Buffer * {
+        auto &grown = _buffers.emplace_back(std::make_unique<Buffer>(buffer->capacity() * 2));
+        for (std::int64_t i = top; i < bottom; ++i) {
+            grown->put(i, buffer->get(i));
+        }
+        _buffer.store(grown.get(), std::memory_order_release);
+        return grown.get();
+    }
+
+  public:
+    // `capacity` is rounded up to a power of two
+    explicit ChaseLevDeque(std::size_t capacity = 256) {
+        std::int64_t size = 1;
+        while (size < static_cast<std::int64_t>(capacity)) {
+            size *= 2;
+        }
+        _buffer.store(_buffers.emplace_back(std::make_unique<Buffer>(size)).get());
+    }
+    ChaseLevDeque(const ChaseLevDeque &) = delete;
+    ChaseLevDeque(ChaseLevDeque &&) = delete;
+    auto operator=(const ChaseLevDeque &) -> ChaseLevDeque & = delete;
+    auto operator=(ChaseLevDeque &&) -> ChaseLevDeque & = delete;
+    ~ChaseLevDeque() = default;
+
+    // Owner only
+    void push(T value) {
+        const std::int64_t bottom = _bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = _top.load(std::memory_order_acquire);
+        Buffer *buffer = _buffer.load(std::memory_order_relaxed);
+        if (bottom - top > buffer->capacity() - 1) {
+            buffer = grow(buffer, bottom, top);
+        }
+        buffer->put(bottom, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    // Owner only, takes the most recently pushed value
+    auto pop() -> std::optional<T> {
+        const std::int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+        Buffer *buffer = _buffer.load(std::memory_order_relaxed);
+        _bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = _top.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        const T value = buffer->get(bottom);
+        if (top == bottom) {
+            // Last value, race the thieves for it
+            const bool won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                          std::memory_order_relaxed);
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            if (!won) {
+                return std::nullopt;
+            }
+        }
+        return value;
+    }
+
+    // Any thread, takes the oldest value. Also fails when losing a race.
+    auto steal() -> std::optional<T> {
+        std::int64_t top = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom = _bottom.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return std::nullopt;
+        }
+        const T value = _buffer.load(std::memory_order_acquire)->get(top);
+        if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    // Approximate when other threads are active
+    LINES_NODISCARD auto size() const -> std::size_t {
+        const std::int64_t size =
+            _bottom.load(std::memory_order_relaxed) - _top.load(std::memory_order_relaxed);
+        return size > 0 ? static_cast<std::size_t>(size) : 0;
+    }
+    LINES_NODISCARD auto empty() const -> bool { return size() == 0; }
+};
+
+// Fixed pool of workers, each owning a ChaseLevDeque. bulk() splits its
+// index range lazily in halves: a worker keeps the lower half and pushes the
+// upper one, so idle workers steal the largest pieces left. Threads outside
+// the pool hand their work in through a locked queue and help by stealing
+// until their bulk is done; bulk() calls from inside a job run nested on the
+// calling worker.
+class LINES_API WorkStealingExecutor final : public Executor {
+    struct Bulk;
+    struct Job {
+        Bulk *bulk;
+        std::size_t begin;
+        std::size_t end;
+    };
+    struct Worker {
+        ChaseLevDeque<Job *> jobs;
+        std::jthread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+
+    std::mutex _injected_mutex;
+    std::deque<Job *> _injected;
+    std::atomic<std::size_t> _injected_size{0};
+
+    // Idle workers sleep until _signals changes
+    std::mutex _sleep_mutex;
+    std::condition_variable _sleep;
+    std::atomic<std::uint64_t> _signals{0};
+    std::atomic<std::size_t> _sleepers{0};
+    bool _stopping = false; // guarded by _sleep_mutex
+
+    // Outside callers wait here for their bulk
+    std::mutex _done_mutex;
+    std::condition_variable _done;
+
+    void work(std::size_t index);
+    void push(Job *job);
+    void signal();
+    auto find_job(std::size_t self) -> Job *;
+    void run(Job *job);
+
+  public:
+    // Starts `threads` workers, 0 starts one per hardware thread
+    explicit WorkStealingExecutor(std::size_t threads = 0);
+    WorkStealingExecutor(const WorkStealingExecutor &) = delete;
+    WorkStealingExecutor(WorkStealingExecutor &&) = delete;
+    auto operator=(const WorkStealingExecutor &) -> WorkStealingExecutor & = delete;
+    auto operator=(WorkStealingExecutor &&) -> WorkStealingExecutor & = delete;
+    // Waits for running jobs, no bulk() may be in progress
+    ~WorkStealingExecutor() override;
+
+    void bulk(std::size_t count, FunctionRef<void(std::size_t)> fn) override;
+    LINES_NODISCARD auto concurrency() const -> std::size_t override { return _workers.size(); }
+};
+} // namespace Lines::Execution
@@ -0,0 +1,360 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/detail/memory.hpp"
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/roadmaps/roadmaps_algorithms.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Lines {
+// Reference to a node of a FlatRoadmap: the slot of the node and the
+// generation of the slot when the node was added. Slots are reused, the
+// handle of a removed node never matches the node that reuses its slot.
+struct LINES_API NodeHandle {
+    static LINES_CONSTEXPR std::uint32_t NONE = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t index = NONE;
+    std::uint32_t generation = 0;
+
+    // False for the handle returned where there is no node
+    LINES_NODISCARD auto valid() const -> bool { return index != NONE; }
+    auto operator==(const NodeHandle &) const -> bool = default;
+};
+
+// Roadmap kept in two arrays indexed by slot: the links and states of the
+// nodes, which is all traversals touch, and the node infos beside them.
+// Children are linked first-child/next-sibling, so adding a node allocates
+// nothing beyond the strings of its info and walking the tree follows indices
+// instead of locking weak pointers. Slots of removed nodes are reused, the
+// most recently freed first.
+//
+// The id of a node is its slot, ids of nodes imported from a Roadmap are
+// kept. Notifications to a RoadmapObserver are not supported, convert back
+// with to_roadmap() to attach one.
+//
+// Like on Roadmap, the first ancestry or subtree query after a structural
+// change relabels the nodes, const as it is. Queries must not run
+// concurrently with each other until one of them ran after the last edit.
+class LINES_API FlatRoadmap {
+  public:
+    using NodeID = RoadmapNode::NodeID;
+    using State = RoadmapNode::State;
+    using allocator_type = Allocator;
+
+    static LINES_CONSTEXPR NodeID ROOT_ID = Roadmap::ROOT_ID;
+
+  private:
+    static LINES_CONSTEXPR std::uint32_t NONE = NodeHandle::NONE;
+
+    struct Links {
+        std::uint32_t parent = NONE;
+        std::uint32_t first_child = NONE;
+        // Next free slot while the slot is free
+        std::uint32_t next_sibling = NONE;
+        // Circular, the previous sibling of the first child is the last one
+        std::uint32_t prev_sibling = NONE;
+        // Bumped when the slot is freed
+        std::uint32_t generation = 0;
+        State state = State::NotCompleted;
+        bool live = false;
+    };
+
+    // Euler-tour label of a node: its pre-order position and one past the
+    // last position of its subtree
+    struct Label {
+        std::uint32_t pre = 0;
+        std::uint32_t end = 0;
+    };
+
+    // Skew-binary jump pointer (Myers, "An applicative random-access
+    // stack"). The jump of a node only depends on its depth and on the jump
+    // of its parent, so it is set in O(1) when the node is added, and any
+    // ancestor is reached in O(log depth) hops.
+    struct Jump {
+        std::uint32_t jump = 0; // the root jumps to itself
+        std::uint32_t depth = 0;
+    };
+
+    RoadmapInfo _info;
+    std::pmr::vector<Links> _links;
+    std::pmr::vector<RoadmapNodeInfo> _infos;
+    std::uint32_t _free = NONE; // LIFO list of free slots
+    std::size_t _size = 0;
+
+    // Labels are brought up to date by the first query after a structural
+    // change. Edits only move nodes at or after the pre-order position where
+    // they happen, so positions below _dirty_from keep their labels and only
+    // the rest of the pre-order is walked again.
+    mutable std::pmr::vector<Label> _labels; // by slot
+    mutable std::pmr::vector<NodeHandle> _order; // by pre-order position
+    mutable std::uint32_t _dirty_from = 0; // NONE once labels are current
+
+    // Jumps by slot. Removing a node moves its subtree up a level, the
+    // subtrees of the children it leaves behind are rejumped right away.
+    std::pmr::vector<Jump> _jumps;
+
+    // Node counts of every subtree by state, kept current by the edits and
+    // state changes: each one adds its delta to the ancestors of the node,
+    // O(depth). The counts are unsigned and wrap, so a negated delta
+    // subtracts.
+    using Counts = std::array<std::uint32_t, 4>;
+    std::pmr::vector<Counts> _counts;
+
+    [[noreturn]] static void throw_stale();
+    // Slot of `node`, throws std::out_of_range for stale handles
+    LINES_NODISCARD auto slot(NodeHandle node) const -> std::uint32_t {
+        if (!contains(node)) {
+            throw_stale();
+        }
+        return node.index;
+    }
+    LINES_NODISCARD auto handle(std::uint32_t index) const -> NodeHandle {
+        return index == NONE ? NodeHandle{} : NodeHandle{index, _links[index].generation};
+    }
+    auto allocate() -> std::uint32_t;
+    void release(std::uint32_t index);
+    void append_child(std::uint32_t parent, std::uint32_t child);
+    // Moves all children of `from` behind the children of `to`
+    void splice_children(std::uint32_t from, std::uint32_t to);
+    void unlink(std::uint32_t index);
+    // Whether the label of the slot is current
+    LINES_NODISCARD auto labeled(std::uint32_t index) const -> bool {
+        return index < _labels.size() && _labels[index].pre < _dirty_from;
+    }
+    void dirty_from(std::uint32_t position) { _dirty_from = std::min(_dirty_from, position); }
+    void relabel() const;
+    auto label(NodeHandle node) const -> const Label & {
+        const std::uint32_t index = slot(node);
+        if (_dirty_from != NONE) {
+            relabel();
+        }
+        return _labels[index];
+    }
+    // Adds `delta` to the counts of the slot and of all its ancestors
+    void count_up(std::uint32_t index, const Counts &delta);
+    // Recomputes all counts after a bulk import
+    void recount();
+    // Sets the jump of a node whose parent link is current
+    void set_jump(std::uint32_t index);
+    // Sets the jumps of the subtree of the slot, parents first
+    void rejump(std::uint32_t top);
+    // Ancestor of the slot at `depth`, which is at most its own depth
+    LINES_NODISCARD auto lift(std::uint32_t index, std::uint32_t depth) const -> std::uint32_t;
+    LINES_NODISCARD auto common_ancestor(std::uint32_t first, std::uint32_t second) const
+        -> std::uint32_t;
+
+    friend class RoadmapBuilder;
+
+  public:
+    // Without an explicit allocator the roadmap uses the allocator of `info`.
+    // Throws std::invalid_argument for an empty title.
+    explicit FlatRoadmap(RoadmapInfo info);
+    FlatRoadmap(std::allocator_arg_t tag, const allocator_type &alloc, RoadmapInfo info);
+    // Copies `rmap` with its node ids, states and child order
+    explicit FlatRoadmap(const Roadmap &rmap);
+    FlatRoadmap(std::allocator_arg_t tag, const allocator_type &alloc, const Roadmap &rmap);
+    FlatRoadmap(const FlatRoadmap &) = default;
+    FlatRoadmap(FlatRoadmap &&) = default;
+    auto operator=(const FlatRoadmap &) -> FlatRoadmap & = default;
+    auto operator=(FlatRoadmap &&) -> FlatRoadmap & = default;
+    ~FlatRoadmap() = default;
+
+    LINES_NODISCARD auto root() const -> NodeHandle { return handle(ROOT_ID); }
+    LINES_NODISCARD auto is_root(NodeHandle node) const -> bool { return node == root(); }
+
+    // Throws std::invalid_argument if `parent` is stale or the title is empty
+    auto add_node(NodeHandle parent, RoadmapNodeInfo info) -> NodeHandle;
+    // Like Roadmap::remove_node, the children of the node move to the end of
+    // the children of its parent. O(1) apart from updating the parent of
+    // every child and the jumps of the subtree. Throws std::invalid_argument
+    // for the root and std::out_of_range for stale handles.
+    void remove_node(NodeHandle node);
+    // Removes the node with all of its descendants in time linear in their
+    // number, returns that number. Throws like remove_node().
+    auto remove_subtree(NodeHandle node) -> std::size_t;
+
+    LINES_NODISCARD auto contains(NodeHandle node) const -> bool {
+        return node.index < _links.size() && _links[node.index].live &&
+               _links[node.index].generation == node.generation;
+    }
+    // Handle of the node with `id`, if there is one
+    LINES_NODISCARD auto find(NodeID id) const -> std::optional<NodeHandle>;
+    LINES_NODISCARD auto id(NodeHandle node) const -> NodeID { return slot(node); }
+    // Number of nodes, the root included
+    LINES_NODISCARD auto size() const -> std::size_t { return _size; }
+    // Number of slots, one past the largest id
+    LINES_NODISCARD auto capacity() const -> std::size_t { return _links.size(); }
+
+    // The accessors throw std::out_of_range for stale handles and return an
+    // invalid handle where there is no node
+    LINES_NODISCARD auto parent(NodeHandle node) const -> NodeHandle {
+        return handle(_links[slot(node)].parent);
+    }
+    LINES_NODISCARD auto first_child(NodeHandle node) const -> NodeHandle {
+        return handle(_links[slot(node)].first_child);
+    }
+    LINES_NODISCARD auto next_sibling(NodeHandle node) const -> NodeHandle {
+        return handle(_links[slot(node)].next_sibling);
+    }
+    LINES_NODISCARD auto prev_sibling(NodeHandle node) const -> NodeHandle;
+    LINES_NODISCARD auto last_child(NodeHandle node) const -> NodeHandle;
+    LINES_NODISCARD auto out_degree(NodeHandle node) const -> std::size_t;
+
+    LINES_NODISCARD auto info(NodeHandle node) const -> const RoadmapNodeInfo &;
+    LINES_NODISCARD auto state(NodeHandle node) const -> State;
+    void set_state(NodeHandle node, State state);
+    // Counts of the subtree of `node` by state, O(1)
+    LINES_NODISCARD auto progress(NodeHandle node) const -> RoadmapProgress;
+
+    LINES_NODISCARD auto get_allocator() const -> allocator_type { return _links.get_allocator(); }
+    LINES_NODISCARD auto title() const -> const std::pmr::string & { return _info.title; }
+    LINES_NODISCARD auto description() const -> const std::optional<std::pmr::string> & {
+        return _info.description;
+    }
+    LINES_NODISCARD auto tags() const -> const Tags & { return _info.tags; }
+
+    // Ancestry and subtree queries, O(1) while the structure is unchanged.
+    // The first of them after add_node() or a removal relabels the nodes
+    // from where the earliest edit happened in pre-order. All throw
+    // std::out_of_range for stale handles.
+    //
+    // Whether `node` is `top` or one of its descendants
+    LINES_NODISCARD auto in_subtree(NodeHandle node, NodeHandle top) const -> bool {
+        const Label &outer = label(top);
+        const std::uint32_t pre = label(node).pre;
+        return outer.pre <= pre && pre < outer.end;
+    }
+    // Whether `ancestor` is a proper ancestor of `node`
+    LINES_NODISCARD auto is_ancestor(NodeHandle ancestor, NodeHandle node) const -> bool {
+        return ancestor != node && in_subtree(node, ancestor);
+    }
+    // 0 for the root
+    LINES_NODISCARD auto depth(NodeHandle node) const -> std::size_t {
+        const std::uint32_t index = slot(node);
+        return _jumps[index].depth;
+    }
+    // Number of nodes in the subtree, the node included
+    LINES_NODISCARD auto subtree_size(NodeHandle node) const -> std::size_t {
+        const Label &node_label = label(node);
+        return node_label.end - node_label.pre;
+    }
+    LINES_NODISCARD auto preorder_index(NodeHandle node) const -> std::size_t {
+        return label(node).pre;
+    }
+    // The subtree in pre-order, valid until the next structural change
+    LINES_NODISCARD auto subtree_span(NodeHandle node) const -> std::span<const NodeHandle> {
+        const Label &node_label = label(node);
+        return std::span<const NodeHandle>{_order}.subspan(node_label.pre,
+                                                           node_label.end - node_label.pre);
+    }
+
+    // Lowest common ancestor and path queries in O(log depth), through jump
+    // pointers kept up to date by the edits. A node counts as its own
+    // ancestor. Throw std::out_of_range for stale handles.
+    LINES_NODISCARD auto lca(NodeHandle first, NodeHandle second) const -> NodeHandle {
+        return handle(common_ancestor(slot(first), slot(second)));
+    }
+    // Number of edges between the nodes
+    LINES_NODISCARD auto distance(NodeHandle first, NodeHandle second) const -> std::size_t;
+    // Nodes from `first` up to the common ancestor and down to `second`,
+    // both ends included
+    LINES_NODISCARD auto path(NodeHandle first, NodeHandle second) const
+        -> std::vector<NodeHandle>;
+
+    // Roadmap with the same nodes, ids, states and child order
+    LINES_NODISCARD auto to_roadmap() const -> Roadmap;
+};
+
+namespace Roadmaps {
+// Visitors are called with the NodeHandle of every node and may return a
+// Visit, see roadmaps_algorithms.hpp.
+//
+// Pre-order, children in order. Climbs back through the parent links instead
+// of keeping a stack.
+template <typename Fn>
+void dfs_foreach(const FlatRoadmap &rmap, Fn &&visitor, const TraversalLimits &limits = {}) {
+    const NodeHandle root = rmap.root();
+    NodeHandle node = root;
+    std::size_t depth = 0;
+    while (node.valid()) {
+        NodeHandle next;
+        if (depth == 0 || limits.states.contains(rmap.state(node))) {
+            const Visit visit = detail::visit(visitor, node);
+            if (visit == Visit::Stop) {
+                return;
+            }
+            if (visit == Visit::Continue && depth < limits.max_depth) {
+                next = rmap.first_child(node);
+                depth += next.valid() ? 1 : 0;
+            }
+        }
+        while (!next.valid() && node != root) {
+            next = rmap.next_sibling(node);
+            if (!next.valid()) {
+                node = rmap.parent(node);
+                --depth;
+            }
+        }
+        node = next;
+    }
+}
+
+template <typename Fn>
+void bfs_foreach(const FlatRoadmap &rmap, Fn &&visitor, const TraversalLimits &limits = {}) {
+    std::vector<NodeHandle> queue;
+    queue.reserve(rmap.size());
+    queue.push_back(rmap.root());
+    // Nodes of one depth are contiguous in the queue
+    std::size_t depth = 0;
+    std::size_t depth_end = 1;
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        if (head == depth_end) {
+            ++depth;
+            depth_end = queue.size();
+        }
+        const NodeHandle node = queue[head];
+        if (depth != 0 && !limits.states.contains(rmap.state(node))) {
+            continue;
+        }
+        const Visit visit = detail::visit(visitor, node);
+        if (visit == Visit::Stop) {
+            return;
+        }
+        if (visit == Visit::SkipChildren || depth >= limits.max_depth) {
+            continue;
+        }
+        for (NodeHandle child = rmap.first_child(node); child.valid();
+             child = rmap.next_sibling(child)) {
+            queue.push_back(child);
+        }
+    }
+}
+
+LINES_API auto dfs(const FlatRoadmap &rmap) -> std::vector<NodeHandle>;
+
+LINES_API auto bfs(const FlatRoadmap &rmap) -> std::vector<NodeHandle>;
+} // namespace Roadmaps
+} // namespace Lines
@@ -0,0 +1,71 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/detail/memory.hpp"
+#include "lines/roadmaps/flat_roadmap.hpp"
+#include "lines/roadmaps/roadmaps.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Lines {
+// Collects the nodes of a roadmap as a parent-index array and builds the
+// whole tree in one pass, with one reservation per array instead of growing
+// everything node by node. Nodes get the ids 1, 2, ... in the order they are
+// added and children keep that order.
+//
+// Nodes are given either by parent id, which has to be added already, or as
+// a pre-order stream of depths, where depth 1 is a child of the root.
+class LINES_API RoadmapBuilder {
+  public:
+    using NodeID = RoadmapNode::NodeID;
+    using allocator_type = Allocator;
+
+  private:
+    RoadmapInfo _info;
+    std::pmr::vector<NodeID> _parents; // parent of node i + 1
+    std::pmr::vector<RoadmapNodeInfo> _infos;
+    std::pmr::vector<NodeID> _path; // pre-order path to the last node, by depth
+
+  public:
+    // The built roadmap uses the allocator of the builder
+    explicit RoadmapBuilder(RoadmapInfo info);
+    RoadmapBuilder(std::allocator_arg_t tag, const allocator_type &alloc, RoadmapInfo info);
+    RoadmapBuilder(const RoadmapBuilder &) = default;
+    RoadmapBuilder(RoadmapBuilder &&) = default;
+    auto operator=(const RoadmapBuilder &) -> RoadmapBuilder & = default;
+    auto operator=(RoadmapBuilder &&) -> RoadmapBuilder & = default;
+    ~RoadmapBuilder() = default;
+
+    void reserve(std::size_t nodes);
+
+    // Throws std::invalid_argument for a parent that is not added yet or an
+    // empty title
+    auto add(NodeID parent, RoadmapNodeInfo info) -> NodeID;
+    // Adds the next node of a pre-order walk. Throws std::invalid_argument if
+    // `depth` is 0 or deeper than one below the previous node.
+    auto add_at_depth(std::size_t depth, RoadmapNodeInfo info) -> NodeID;
+
+    // Number of nodes added, the root excluded
+    LINES_NODISCARD auto size() const -> std::size_t { return _parents.size(); }
+    LINES_NODISCARD auto get_allocator() const -> allocator_type { return _infos.get_allocator(); }
+
+    // Both move the nodes out and leave the builder with none
+    LINES_NODISCARD auto build() -> Roadmap;
+    LINES_NODISCARD auto build_flat() -> FlatRoadmap;
+};
+} // namespace Lines
@@ -0,0 +1,216 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/roadmaps/flat_roadmap.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+// Lazy traversals of a FlatRoadmap as std::ranges views. They yield node
+// handles and walk the links of the roadmap, so iterating allocates nothing
+// and touches no reference counts; level order keeps its queue in a buffer
+// of the caller. The roadmap must not change while a view is iterated.
+namespace Lines::Roadmaps {
+// Pre-order of the subtree of a node, children in order. Walks back up
+// through the parent links instead of keeping a stack.
+class PreorderView : public std::ranges::view_interface<PreorderView> {
+    const FlatRoadmap *_rmap = nullptr;
+    NodeHandle _top;
+
+  public:
+    class Iterator {
+        const FlatRoadmap *_rmap = nullptr;
+        NodeHandle _top;
+        NodeHandle _node;
+
+      public:
+        using value_type = NodeHandle;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        Iterator(const FlatRoadmap &rmap, NodeHandle top) : _rmap(&rmap), _top(top), _node(top) {}
+
+        auto operator*() const -> NodeHandle { return _node; }
+        auto operator++() -> Iterator & {
+            NodeHandle next = _rmap->first_child(_node);
+            while (!next.valid() && _node != _top) {
+                next = _rmap->next_sibling(_node);
+                _node = _rmap->parent(_node);
+            }
+            _node = next;
+            return *this;
+        }
+        auto operator++(int) -> Iterator {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+        auto operator==(const Iterator &other) const -> bool { return _node == other._node; }
+        auto operator==(std::default_sentinel_t /*end*/) const -> bool { return !_node.valid(); }
+    };
+
+    PreorderView() = default;
+    PreorderView(const FlatRoadmap &rmap, NodeHandle top) : _rmap(&rmap), _top(top) {}
+
+    LINES_NODISCARD auto begin() const -> Iterator { return Iterator{*_rmap, _top}; }
+    LINES_NODISCARD auto end() const -> std::default_sentinel_t { return std::default_sentinel; }
+};
+
+// Post-order of the subtree of a node: every node after its descendants,
+// children in order
+class PostorderView : public std::ranges::view_interface<PostorderView> {
+    const FlatRoadmap *_rmap = nullptr;
+    NodeHandle _top;
+
+  public:
+    class Iterator {
+        const FlatRoadmap *_rmap = nullptr;
+        NodeHandle _top;
+        NodeHandle _node;
+
+        auto leftmost_leaf(NodeHandle node) const -> NodeHandle {
+            for (NodeHandle child = _rmap->first_child(node); child.valid();
+                 child = _rmap->first_child(node)) {
+                node = child;
+            }
+            return node;
+        }
+
+      public:
+        using value_type = NodeHandle;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        Iterator(const FlatRoadmap &rmap, NodeHandle top)
+            : _rmap(&rmap), _top(top), _node(leftmost_leaf(top)) {}
+
+        auto operator*() const -> NodeHandle { return _node; }
+        auto operator++() -> Iterator & {
+            if (_node == _top) {
+                _node = {};
+            } else if (const NodeHandle next = _rmap->next_sibling(_node); next.valid()) {
+                _node = leftmost_leaf(next);
+            } else {
+                _node = _rmap->parent(_node);
+            }
+            return *this;
+        }
+        auto operator++(int) -> Iterator {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+        auto operator==(const Iterator &other) const -> bool { return _node == other._node; }
+        auto operator==(std::default_sentinel_t /*end*/) const -> bool { return !_node.valid(); }
+    };
+
+    PostorderView() = default;
+    PostorderView(const FlatRoadmap &rmap, NodeHandle top) : _rmap(&rmap), _top(top) {}
+
+    LINES_NODISCARD auto begin() const -> Iterator { return Iterator{*_rmap, _top}; }
+    LINES_NODISCARD auto end() const -> std::default_sentinel_t { return std::default_sentinel; }
+};
+
+// Level order of the subtree of a node, children in order. The queue lives
+// in `buffer`, which begin() clears; its capacity is kept between walks. The
+// view is single pass.
+class LevelorderView : public std::ranges::view_interface<LevelorderView> {
+    const FlatRoadmap *_rmap = nullptr;
+    std::vector<NodeHandle> *_queue = nullptr;
+    NodeHandle _top;
+
+  public:
+    class Iterator {
+        const FlatRoadmap *_rmap = nullptr;
+        std::vector<NodeHandle> *_queue = nullptr;
+        std::size_t _head = 0;
+
+      public:
+        using value_type = NodeHandle;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        Iterator(const FlatRoadmap &rmap, std::vector<NodeHandle> &queue)
+            : _rmap(&rmap), _queue(&queue) {}
+
+        auto operator*() const -> NodeHandle { return (*_queue)[_head]; }
+        auto operator++() -> Iterator & {
+            for (NodeHandle child = _rmap->first_child((*_queue)[_head]); child.valid();
+                 child = _rmap->next_sibling(child)) {
+                _queue->push_back(child);
+            }
+            ++_head;
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        auto operator==(std::default_sentinel_t /*end*/) const -> bool {
+            return _head == _queue->size();
+        }
+    };
+
+    LevelorderView() = default;
+    LevelorderView(const FlatRoadmap &rmap, std::vector<NodeHandle> &buffer, NodeHandle top)
+        : _rmap(&rmap), _queue(&buffer), _top(top) {}
+
+    LINES_NODISCARD auto begin() const -> Iterator {
+        _queue->clear();
+        _queue->push_back(_top);
+        return Iterator{*_rmap, *_queue};
+    }
+    LINES_NODISCARD auto end() const -> std::default_sentinel_t { return std::default_sentinel; }
+};
+
+// The views throw std::out_of_range for a stale `top`
+LINES_NODISCARD inline auto preorder(const FlatRoadmap &rmap, NodeHandle top) -> PreorderView {
+    (void)rmap.id(top);
+    return PreorderView{rmap, top};
+}
+LINES_NODISCARD inline auto preorder(const FlatRoadmap &rmap) -> PreorderView {
+    return PreorderView{rmap, rmap.root()};
+}
+
+LINES_NODISCARD inline auto postorder(const FlatRoadmap &rmap, NodeHandle top) -> PostorderView {
+    (void)rmap.id(top);
+    return PostorderView{rmap, top};
+}
+LINES_NODISCARD inline auto postorder(const FlatRoadmap &rmap) -> PostorderView {
+    return PostorderView{rmap, rmap.root()};
+}
+
+LINES_NODISCARD inline auto levelorder(const FlatRoadmap &rmap, std::vector<NodeHandle> &buffer,
+                                       NodeHandle top) -> LevelorderView {
+    (void)rmap.id(top);
+    return LevelorderView{rmap, buffer, top};
+}
+LINES_NODISCARD inline auto levelorder(const FlatRoadmap &rmap, std::vector<NodeHandle> &buffer)
+    -> LevelorderView {
+    return LevelorderView{rmap, buffer, rmap.root()};
+}
+
+// Pre-order of the node with `id` and its descendants. Throws
+// std::out_of_range if there is no such node.
+LINES_NODISCARD inline auto subtree(const FlatRoadmap &rmap, FlatRoadmap::NodeID id)
+    -> PreorderView {
+    const auto node = rmap.find(id);
+    if (!node) {
+        throw std::out_of_range("Roadmaps::subtree: unknown node");
+    }
+    return PreorderView{rmap, *node};
+}
+} // namespace Lines::Roadmaps
@@ -14,23 +14,75 @@
 #pragma once
 
 #include "lines/detail/macro.h"
+#include "lines/detail/memory.hpp"
+#include "lines/detail/observer_hook.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Lines {
 struct LINES_API RoadmapNodeInfo {
-    explicit RoadmapNodeInfo(std::string title,
-                             std::optional<std::string> description = std::nullopt,
-                             std::vector<std::string> tags = {});
-    std::string title;
-    std::optional<std::string> description;
-    std::vector<std::string> tags;
+    using allocator_type = Allocator;
+
+    // Leaves the title empty, it has to be set before use
+    explicit RoadmapNodeInfo(const allocator_type &alloc) : title(alloc), tags(alloc) {}
+    explicit RoadmapNodeInfo(std::string_view title,
+                             std::optional<std::string_view> description = std::nullopt,
+                             std::initializer_list<std::string_view> tags = {});
+    // Tags held in a std::vector, as before the allocator-aware layout
+    RoadmapNodeInfo(std::string_view title, std::optional<std::string_view> description,
+                    const std::vector<std::string> &tags);
+    RoadmapNodeInfo(std::allocator_arg_t tag, const allocator_type &alloc, std::string_view title,
+                    std::optional<std::string_view> description = std::nullopt,
+                    std::initializer_list<std::string_view> tags = {});
+    RoadmapNodeInfo(const RoadmapNodeInfo &) = default;
+    RoadmapNodeInfo(RoadmapNodeInfo &&) = default;
+    RoadmapNodeInfo(std::allocator_arg_t tag, const allocator_type &alloc,
+                    const RoadmapNodeInfo &other);
+    RoadmapNodeInfo(std::allocator_arg_t tag, const allocator_type &alloc, RoadmapNodeInfo &&other);
+    auto operator=(const RoadmapNodeInfo &) -> RoadmapNodeInfo & = default;
+    auto operator=(RoadmapNodeInfo &&) -> RoadmapNodeInfo & = default;
+    ~RoadmapNodeInfo() = default;
+
+    LINES_NODISCARD auto get_allocator() const -> allocator_type { return title.get_allocator(); }
+
+    std::pmr::string title;
+    std::optional<std::pmr::string> description;
+    Tags tags;
+};
+
+class RoadmapObserver;
+class RoadmapBuilder;
+
+// Number of nodes of a subtree by state, the top node included
+struct LINES_API RoadmapProgress {
+    std::size_t total = 0;
+    std::size_t not_completed = 0;
+    std::size_t completed = 0;
+    std::size_t skipped = 0;
+    std::size_t in_progress = 0;
+
+    // Completed share of the nodes that are not skipped, 1 when all are
+    LINES_NODISCARD auto ratio() const -> double {
+        const std::size_t counted = total - skipped;
+        return counted == 0 ? 1.0 : static_cast<double>(completed) / static_cast<double>(counted);
+    }
+    auto operator==(const RoadmapProgress &) const -> bool = default;
 };
 
+// Identifier a roadmap is attached under, chosen by the owner of the roadmap.
+using RoadmapID = std::uint32_t;
+
 class LINES_API RoadmapNode {
   public:
     using NodeID = std::size_t;
@@ -42,10 +94,29 @@ class LINES_API RoadmapNode {
     const NodeID _id; // NOLINT
     RoadmapNodeInfo _info;
     NodePtr _parent;
-    std::vector<NodePtr> _children;
+    std::pmr::vector<NodePtr> _children;
+    // Attachment of the owning roadmap, maintained by Roadmap
+    detail::ObserverHook<RoadmapObserver, RoadmapID> _hook;
+    // Skew-binary jump pointer and depth, maintained by Roadmap, see
+    // FlatRoadmap. The root jumps to itself.
+    const RoadmapNode *_jump = this;
+    std::size_t _depth = 0;
+    // Nodes of the subtree by state, the node included. Current while
+    // _counted; the ancestors of a node that is not counted are not counted
+    // either.
+    std::array<std::uint32_t, 4> _counts{};
+    bool _counted = false;
+
+    // Marks the node and its ancestors as not counted
+    void uncount();
+
+    friend class Roadmap;
+    friend class RoadmapBuilder;
 
   public:
-    explicit RoadmapNode(NodeID id, RoadmapNodeInfo info, NodePtr parent);
+    // Strings and the child list of the node are allocated with `alloc`
+    explicit RoadmapNode(NodeID id, RoadmapNodeInfo info, NodePtr parent,
+                         const Allocator &alloc = {});
     RoadmapNode() = delete;
     RoadmapNode(const RoadmapNode &) = delete;
     RoadmapNode(RoadmapNode &&) = delete;
@@ -53,12 +124,17 @@ class LINES_API RoadmapNode {
     auto operator=(RoadmapNode &&) -> RoadmapNode & = delete;
     ~RoadmapNode() = default;
 
-    LINES_NODISCARD auto title() const -> const std::string &;
-    LINES_NODISCARD auto description() const -> const std::optional<std::string> &;
+    // Views into the node, info() reads the allocator-aware fields in place
+    LINES_NODISCARD auto title() const -> std::string_view;
+    LINES_NODISCARD auto description() const -> std::optional<std::string_view>;
+    // Copy of the tags, info().tags reads them in place
     LINES_NODISCARD auto tags() const -> std::vector<std::string>;
+    LINES_NODISCARD auto info() const -> const RoadmapNodeInfo &;
 
     LINES_NODISCARD auto state() const -> State;
 
+    // Updates the counts of the ancestors kept for Roadmap::progress(),
+    // O(depth)
     void set_state(State state);
 
     void add_child(const NodePtr &node);
@@ -70,31 +146,173 @@ class LINES_API RoadmapNode {
     LINES_NODISCARD auto out_degree() const -> std::size_t;
 
     LINES_NODISCARD auto parent() const -> NodePtr;
-    LINES_NODISCARD auto children() const -> const std::vector<NodePtr> &;
+    LINES_NODISCARD auto children() const -> const std::pmr::vector<NodePtr> &;
     LINES_NODISCARD auto id() const -> NodeID;
 };
 
 struct LINES_API RoadmapInfo {
-    explicit RoadmapInfo(std::string title, std::optional<std::string> description = std::nullopt,
-                         std::vector<std::string> tags = {});
-    std::string title;
-    std::optional<std::string> description;
-    std::vector<std::string> tags;
+    using allocator_type = Allocator;
+
+    // Leaves the title empty, it has to be set before use
+    explicit RoadmapInfo(const allocator_type &alloc) : title(alloc), tags(alloc) {}
+    explicit RoadmapInfo(std::string_view title,
+                         std::optional<std::string_view> description = std::nullopt,
+                         std::initializer_list<std::string_view> tags = {});
+    // Tags held in a std::vector, as before the allocator-aware layout
+    RoadmapInfo(std::string_view title, std::optional<std::string_view> description,
+                const std::vector<std::string> &tags);
+    RoadmapInfo(std::allocator_arg_t tag, const allocator_type &alloc, std::string_view title,
+                std::optional<std::string_view> description = std::nullopt,
+                std::initializer_list<std::string_view> tags = {});
+    RoadmapInfo(const RoadmapInfo &) = default;
+    RoadmapInfo(RoadmapInfo &&) = default;
+    RoadmapInfo(std::allocator_arg_t tag, const allocator_type &alloc, const RoadmapInfo &other);
+    RoadmapInfo(std::allocator_arg_t tag, const allocator_type &alloc, RoadmapInfo &&other);
+    auto operator=(const RoadmapInfo &) -> RoadmapInfo & = default;
+    auto operator=(RoadmapInfo &&) -> RoadmapInfo & = default;
+    ~RoadmapInfo() = default;
+
+    LINES_NODISCARD auto get_allocator() const -> allocator_type { return title.get_allocator(); }
+
+    std::pmr::string title;
+    std::optional<std::pmr::string> description;
+    Tags tags;
+};
+
+// Receives notifications from an attached Roadmap and its nodes.
+// on_node_added is invoked once the node is linked into the tree,
+// on_node_removed right before the node is unlinked and destroyed,
+// on_node_state_changed after RoadmapNode::set_state.
+class LINES_API RoadmapObserver {
+  public:
+    RoadmapObserver() = default;
+    RoadmapObserver(const RoadmapObserver &) = default;
+    RoadmapObserver(RoadmapObserver &&) = default;
+    auto operator=(const RoadmapObserver &) -> RoadmapObserver & = default;
+    auto operator=(RoadmapObserver &&) -> RoadmapObserver & = default;
+    virtual ~RoadmapObserver() = default;
+
+    virtual void on_node_added(RoadmapID /*id*/, const RoadmapNode & /*node*/) {}
+    virtual void on_node_removed(RoadmapID /*id*/, const RoadmapNode & /*node*/) {}
+    virtual void on_node_state_changed(RoadmapID /*id*/, const RoadmapNode & /*node*/,
+                                       RoadmapNode::State /*old_state*/) {}
+};
+
+// Fans notifications out to several observers, so one roadmap can feed
+// multiple indexes at once.
+class LINES_API RoadmapObserverList final : public RoadmapObserver {
+    std::vector<RoadmapObserver *> _observers;
+
+  public:
+    void add(RoadmapObserver &observer) { _observers.push_back(&observer); }
+
+    void remove(RoadmapObserver &observer) { std::erase(_observers, &observer); }
+
+    LINES_NODISCARD auto size() const -> std::size_t { return _observers.size(); }
+
+    void on_node_added(RoadmapID id, const RoadmapNode &node) override {
+        for (auto *observer : _observers) {
+            observer->on_node_added(id, node);
+        }
+    }
+
+    void on_node_removed(RoadmapID id, const RoadmapNode &node) override {
+        for (auto *observer : _observers) {
+            observer->on_node_removed(id, node);
+        }
+    }
+
+    void on_node_state_changed(RoadmapID id, const RoadmapNode &node,
+                               RoadmapNode::State old_state) override {
+        for (auto *observer : _observers) {
+            observer->on_node_state_changed(id, node, old_state);
+        }
+    }
 };
 
+// Tree of nodes addressed by id.
+//
+// Ancestry and subtree queries read Euler-tour labels, which the first
+// query after a structural change brings up to date. Likewise, progress()
+// recounts the subtrees changed since the last count. These queries write
+// to the roadmap even though they are const, so they must not run
+// concurrently with each other until one of each kind ran after the last
+// edit.
 class LINES_API Roadmap {
+    static LINES_CONSTEXPR std::size_t UNLABELED = std::numeric_limits<std::size_t>::max();
+
+    // Pre-order position of a node and one past the last position of its
+    // subtree
+    struct Label {
+        std::size_t pre = UNLABELED;
+        std::size_t end = UNLABELED;
+    };
+
     RoadmapInfo _info;
-    std::vector<std::shared_ptr<RoadmapNode>> nodes;
+    std::pmr::vector<std::shared_ptr<RoadmapNode>> nodes;
+    // Min-heap of ids of empty slots. Slots filled through an explicit id stay
+    // behind and are dropped when they come up.
+    std::pmr::vector<RoadmapNode::NodeID> _free_ids;
+    detail::ObserverHook<RoadmapObserver, RoadmapID> _hook;
+
+    // Edits only move nodes at or after the pre-order position where they
+    // happen, positions below _dirty_from keep their labels and the relabel
+    // resumes the walk there
+    mutable std::pmr::vector<Label> _labels; // by id
+    mutable std::pmr::vector<RoadmapNode::NodeID> _order; // by pre-order position
+    mutable std::size_t _dirty_from = 0; // UNLABELED once labels are current
 
+    friend class RoadmapBuilder;
+
+    // Lowest unused id, amortized O(log n) in the number of removed nodes
     auto free_id() -> RoadmapNode::NodeID;
+    void push_free_id(RoadmapNode::NodeID id);
+    // Fills the empty node list with copies of the nodes of `other`
+    void copy_nodes(const Roadmap &other);
+    // Replaces the contents of an attached roadmap with those of a detached
+    // one, reporting the old nodes as removed and the new ones as added
+    void assign(Roadmap &&other);
+    // Node with `id`, throws std::out_of_range if there is none
+    LINES_NODISCARD auto node_at(RoadmapNode::NodeID id) const -> const RoadmapNode &;
+    // Whether the label of the node with `id` is current
+    LINES_NODISCARD auto labeled(RoadmapNode::NodeID id) const -> bool {
+        return id < _labels.size() && _labels[id].pre < _dirty_from;
+    }
+    void dirty_from(std::size_t position) { _dirty_from = std::min(_dirty_from, position); }
+    void relabel() const;
+    auto label(RoadmapNode::NodeID id) const -> const Label &;
+    // Sets the jump of `node`, the one of `parent` has to be current
+    static void set_jump(RoadmapNode &node, const RoadmapNode &parent);
+    // Sets the jumps of the subtree of `top`, which has a parent
+    void rejump(RoadmapNode &top);
+    // Counts the nodes below `top` that are not counted, O(their number
+    // plus the number of their children)
+    void count(RoadmapNode &top) const;
+    // Ancestor of `node` at `depth`, which is at most its own depth
+    static auto lift(const RoadmapNode *node, std::size_t depth) -> const RoadmapNode *;
+    static auto common_ancestor(const RoadmapNode *first, const RoadmapNode *second)
+        -> const RoadmapNode *;
 
   public:
+    using allocator_type = Allocator;
+
     static LINES_CONSTEXPR RoadmapNode::NodeID ROOT_ID = 0;
+    // Without an explicit allocator the roadmap and all of its nodes use the
+    // allocator of `info`
     explicit Roadmap(RoadmapInfo info);
-    Roadmap(const Roadmap &) = default;
+    Roadmap(std::allocator_arg_t tag, const allocator_type &alloc, RoadmapInfo info);
+    // Copies hold copies of the nodes and start detached
+    Roadmap(std::allocator_arg_t tag, const allocator_type &alloc, const Roadmap &other);
+    // Takes the nodes over if `alloc` equals the allocator of `other`,
+    // copies them otherwise
+    Roadmap(std::allocator_arg_t tag, const allocator_type &alloc, Roadmap &&other);
+    Roadmap(const Roadmap &other);
     Roadmap(Roadmap &&) = default;
-    auto operator=(const Roadmap &) -> Roadmap & = default;
-    auto operator=(Roadmap &&) -> Roadmap & = default;
+    // An attached roadmap keeps its attachment and reports the replaced
+    // nodes as removed and the assigned ones as added. A detached one takes
+    // over the attachment of a moved-from roadmap, like a move construction.
+    auto operator=(const Roadmap &other) -> Roadmap &;
+    auto operator=(Roadmap &&other) -> Roadmap &;
     ~Roadmap() = default;
     auto operator[](RoadmapNode::NodeID id) -> RoadmapNode::NodePtr;
 
@@ -108,15 +326,79 @@ class LINES_API Roadmap {
 
     auto add_node(const RoadmapNode::NodePtr &parent, const RoadmapNodeInfo &info)
         -> RoadmapNode::NodePtr;
+    auto add_node(const RoadmapNode::NodePtr &parent, RoadmapNodeInfo &&info)
+        -> RoadmapNode::NodePtr;
+    // Adds the node under a given unused id instead of the next free one,
+    // used to restore saved roadmaps with their original ids
+    auto add_node(const RoadmapNode::NodePtr &parent, RoadmapNodeInfo &&info,
+                  RoadmapNode::NodeID id) -> RoadmapNode::NodePtr;
 
+    // The children of the node move to the end of the children of its parent,
+    // their subtrees are rejumped in time linear in their size
     void remove_node(RoadmapNode::NodeID id);
+    // Removes the node with all of its descendants, children before their
+    // parents, in time linear in their number plus the siblings of the node.
+    // Returns the number of removed nodes. Throws std::out_of_range if there
+    // is no node with `id`.
+    auto remove_subtree(RoadmapNode::NodeID id) -> std::size_t;
 
     LINES_NODISCARD auto size() const -> std::size_t;
 
+    // Ancestry and subtree queries, O(1) while the structure is unchanged,
+    // depth() always. They throw std::out_of_range if there is no node with
+    // one of the ids.
+    //
+    // Whether `id` is `top` or one of its descendants
+    LINES_NODISCARD auto in_subtree(RoadmapNode::NodeID id, RoadmapNode::NodeID top) const
+        -> bool;
+    // Whether `ancestor` is a proper ancestor of `id`
+    LINES_NODISCARD auto is_ancestor(RoadmapNode::NodeID ancestor, RoadmapNode::NodeID id) const
+        -> bool;
+    // 0 for the root
+    LINES_NODISCARD auto depth(RoadmapNode::NodeID id) const -> std::size_t;
+    // Number of nodes in the subtree, the node included
+    LINES_NODISCARD auto subtree_size(RoadmapNode::NodeID id) const -> std::size_t;
+    LINES_NODISCARD auto preorder_index(RoadmapNode::NodeID id) const -> std::size_t;
+    // Ids of the subtree in pre-order, valid until the next structural change
+    LINES_NODISCARD auto subtree_span(RoadmapNode::NodeID id) const
+        -> std::span<const RoadmapNode::NodeID>;
+
+    // Counts of the subtree of the node by state, O(1) unless nodes were
+    // added or removed below it since the last call. Throws std::out_of_range
+    // if there is no node with `id`.
+    LINES_NODISCARD auto progress(RoadmapNode::NodeID id) const -> RoadmapProgress;
+
+    // Lowest common ancestor and path queries in O(log depth), through jump
+    // pointers the edits keep current. A node counts as its own ancestor.
+    // Throw std::out_of_range if there is no node with one of the ids.
+    LINES_NODISCARD auto lca(RoadmapNode::NodeID first, RoadmapNode::NodeID second) const
+        -> RoadmapNode::NodeID;
+    // Number of edges between the nodes
+    LINES_NODISCARD auto distance(RoadmapNode::NodeID first, RoadmapNode::NodeID second) const
+        -> std::size_t;
+    // Ids from `first` up to the common ancestor and down to `second`, both
+    // ends included
+    LINES_NODISCARD auto path(RoadmapNode::NodeID first, RoadmapNode::NodeID second) const
+        -> std::vector<RoadmapNode::NodeID>;
+
+    LINES_NODISCARD auto get_allocator() const -> allocator_type;
+
+    // Copies of the roadmap info, info() reads it in place
     LINES_NODISCARD auto title() const -> std::string;
 
     LINES_NODISCARD auto description() const -> std::optional<std::string>;
 
     LINES_NODISCARD auto tags() const -> std::vector<std::string>;
+
+    LINES_NODISCARD auto info() const -> const RoadmapInfo &;
+
+    // Routes notifications of the roadmap and its nodes to `observer` under
+    // `id`, which visits every node. Copies of a roadmap start detached.
+    void attach(RoadmapObserver &observer, RoadmapID id);
+    void detach();
+    LINES_NODISCARD auto attached() const -> bool;
+    LINES_NODISCARD auto id() const -> std::optional<RoadmapID>;
+    // Observer the roadmap is attached to, nullptr while detached
+    LINES_NODISCARD auto observer() const -> RoadmapObserver *;
 };
 }; // namespace Lines
@@ -16,47 +16,123 @@
 #include "roadmaps.hpp"
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
 #include <queue>
 #include <ranges>
 #include <stack>
+#include <type_traits>
+#include <utility>
 
 namespace Lines::Roadmaps {
+// What a visitor returns to steer a traversal. Visitors may also return
+// void, which is the same as always returning Continue and costs nothing.
+enum class Visit : std::uint8_t {
+    Continue,
+    // The children of the visited node are not visited
+    SkipChildren,
+    // Nothing is visited after this node
+    Stop,
+};
+
+// Set of node states
+class LINES_API StateFilter {
+    std::uint8_t _mask = 0xF;
+
+  public:
+    // Every state
+    LINES_CONSTEXPR StateFilter() = default;
+    LINES_CONSTEXPR StateFilter(std::initializer_list<RoadmapNode::State> states) : _mask(0) {
+        for (const auto state : states) {
+            _mask |= static_cast<std::uint8_t>(1U << static_cast<unsigned>(state));
+        }
+    }
+
+    LINES_NODISCARD LINES_CONSTEXPR auto contains(RoadmapNode::State state) const -> bool {
+        return (_mask >> static_cast<unsigned>(state) & 1U) != 0;
+    }
+};
+
+// Bounds of a traversal. Nodes below max_depth, where the root is at depth
+// 0, are not visited. Nodes in a state outside `states` are not visited and
+// neither are their descendants; the root is always visited.
+struct LINES_API TraversalLimits {
+    static LINES_CONSTEXPR std::size_t UNLIMITED = std::numeric_limits<std::size_t>::max();
+
+    std::size_t max_depth = UNLIMITED;
+    StateFilter states;
+};
+
 namespace detail {
-template <typename Fn> void dfs_impl(const Roadmap &rmap, const Fn &fn) {
+template <typename Fn, typename Node> auto visit(const Fn &fn, const Node &node) -> Visit {
+    using Result = std::invoke_result_t<const Fn &, const Node &>;
+    static_assert(std::is_void_v<Result> || std::is_same_v<Result, Visit>,
+                  "Roadmaps: visitors return void or Roadmaps::Visit");
+    if constexpr (std::is_void_v<Result>) {
+        fn(node);
+        return Visit::Continue;
+    } else {
+        return fn(node);
+    }
+}
+
+template <typename Fn>
+void dfs_impl(const Roadmap &rmap, const Fn &fn, const TraversalLimits &limits = {}) {
     auto root = rmap.root();
 
-    std::stack<RoadmapNode::NodePtr> stack;
-    stack.push(root);
+    std::stack<std::pair<RoadmapNode::NodePtr, std::size_t>> stack;
+    stack.emplace(root, 0);
 
     while (!stack.empty()) {
-        const auto node = stack.top();
+        const auto [node, depth] = std::move(stack.top());
         const auto nptr = node.lock();
         stack.pop();
 
-        fn(node);
+        if (depth != 0 && !limits.states.contains(nptr->state())) {
+            continue;
+        }
+        const Visit visit = detail::visit(fn, node);
+        if (visit == Visit::Stop) {
+            return;
+        }
+        if (visit == Visit::SkipChildren || depth >= limits.max_depth) {
+            continue;
+        }
 
         for (const auto &child : std::ranges::reverse_view(nptr->children())) {
-            stack.push(child);
+            stack.emplace(child, depth + 1);
         }
     }
 }
 
-template <typename Fn> void bfs_impl(const Roadmap &rmap, const Fn &fn) {
+template <typename Fn>
+void bfs_impl(const Roadmap &rmap, const Fn &fn, const TraversalLimits &limits = {}) {
     auto root = rmap.root();
 
-    std::queue<RoadmapNode::NodePtr> queue;
+    std::queue<std::pair<RoadmapNode::NodePtr, std::size_t>> queue;
 
-    queue.push(root);
+    queue.emplace(root, 0);
 
     while (!queue.empty()) {
-        const auto node = queue.front();
+        const auto [node, depth] = std::move(queue.front());
         const auto nptr = node.lock();
 
         queue.pop();
 
-        fn(node);
+        if (depth != 0 && !limits.states.contains(nptr->state())) {
+            continue;
+        }
+        const Visit visit = detail::visit(fn, node);
+        if (visit == Visit::Stop) {
+            return;
+        }
+        if (visit == Visit::SkipChildren || depth >= limits.max_depth) {
+            continue;
+        }
         for (const auto &child : nptr->children()) {
-            queue.push(child);
+            queue.emplace(child, depth + 1);
         }
     }
 }
@@ -65,11 +141,15 @@ LINES_API auto dfs(const Roadmap &rmap) -> std::vector<RoadmapNode::NodePtr>;
 
 LINES_API auto bfs(const Roadmap &rmap) -> std::vector<RoadmapNode::NodePtr>;
 
-template <typename Fn> void dfs_foreach(const Roadmap &rmap, Fn &&visitor) {
-    detail::dfs_impl(rmap, std::forward<Fn>(visitor));
+// Visitors are called with the RoadmapNode::NodePtr of every node and may
+// return a Visit
+template <typename Fn>
+void dfs_foreach(const Roadmap &rmap, Fn &&visitor, const TraversalLimits &limits = {}) {
+    detail::dfs_impl(rmap, std::forward<Fn>(visitor), limits);
 }
 
-template <typename Fn> void bfs_foreach(const Roadmap &rmap, Fn &&visitor) {
-    detail::bfs_impl(rmap, std::forward<Fn>(visitor));
+template <typename Fn>
+void bfs_foreach(const Roadmap &rmap, Fn &&visitor, const TraversalLimits &limits = {}) {
+    detail::bfs_impl(rmap, std::forward<Fn>(visitor), limits);
 }
 } // namespace Lines::Roadmaps
@@ -0,0 +1,103 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/search/text_index.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_observer.hpp"
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Lines::Search {
+enum class Field : uint8_t { Title, Description };
+
+struct LINES_API SearchHit {
+    std::uint32_t id; // TaskID or RoadmapNode::NodeID
+    Field field;
+    MatchQuality quality;
+    std::uint32_t position;
+};
+
+// Title and description indexes kept in sync with attached tasks.
+// Results hold one hit per task, title matches rank above description
+// matches of the same quality.
+class LINES_API TaskSearchIndex : public TaskObserver {
+    TextIndex _titles;
+    TextIndex _descriptions;
+
+  public:
+    TaskSearchIndex() = default;
+    TaskSearchIndex(const TaskSearchIndex &) = delete;
+    TaskSearchIndex(TaskSearchIndex &&) = delete;
+    auto operator=(const TaskSearchIndex &) -> TaskSearchIndex & = delete;
+    auto operator=(TaskSearchIndex &&) -> TaskSearchIndex & = delete;
+    ~TaskSearchIndex() override = default;
+
+    // Indexes `task` under `id` and attaches the index to it. Throws
+    // std::invalid_argument if `task` is already attached, share it through a
+    // TaskObserverList instead.
+    void track(Task &task, TaskID id);
+    void untrack(Task &task);
+
+    void insert(TaskID id, const Task &task);
+    void erase(TaskID id);
+
+    LINES_NODISCARD auto size() const -> std::size_t { return _titles.size(); }
+    LINES_NODISCARD auto search(std::string_view query, MatchMode mode = MatchMode::Substring,
+                                std::size_t limit = TextIndex::NO_LIMIT) const
+        -> std::vector<SearchHit>;
+
+    void on_title_changed(TaskID id, const Task &task, const std::pmr::string &old_title) override;
+    void on_description_changed(TaskID id, const Task &task,
+                                const std::optional<std::pmr::string> &old_description) override;
+};
+
+// Title and description indexes over the nodes of one roadmap, the root
+// node is not indexed.
+class LINES_API RoadmapSearchIndex : public RoadmapObserver {
+    TextIndex _titles;
+    TextIndex _descriptions;
+
+    void insert(const RoadmapNode &node);
+    void erase(const RoadmapNode &node);
+
+  public:
+    RoadmapSearchIndex() = default;
+    RoadmapSearchIndex(const RoadmapSearchIndex &) = delete;
+    RoadmapSearchIndex(RoadmapSearchIndex &&) = delete;
+    auto operator=(const RoadmapSearchIndex &) -> RoadmapSearchIndex & = delete;
+    auto operator=(RoadmapSearchIndex &&) -> RoadmapSearchIndex & = delete;
+    ~RoadmapSearchIndex() override = default;
+
+    // Indexes the current nodes of `rmap` and attaches the index to it. Throws
+    // std::invalid_argument if `rmap` is already attached, share it through a
+    // RoadmapObserverList instead.
+    void track(Roadmap &rmap, RoadmapID id = 0);
+    // Removes the nodes of `rmap` and detaches the index from it. Throws
+    // std::invalid_argument if `rmap` is not attached to this index.
+    void untrack(Roadmap &rmap);
+
+    LINES_NODISCARD auto size() const -> std::size_t { return _titles.size(); }
+    LINES_NODISCARD auto search(std::string_view query, MatchMode mode = MatchMode::Substring,
+                                std::size_t limit = TextIndex::NO_LIMIT) const
+        -> std::vector<SearchHit>;
+
+    void on_node_added(RoadmapID id, const RoadmapNode &node) override;
+    void on_node_removed(RoadmapID id, const RoadmapNode &node) override;
+};
+} // namespace Lines::Search
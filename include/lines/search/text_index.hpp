@@ -0,0 +1,86 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/containers/roaring.hpp"
+#include "lines/detail/macro.h"
+#include "lines/execution/executor.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Lines::Search {
+using DocID = std::uint32_t;
+
+enum class MatchMode : uint8_t {
+    Substring, // query occurs anywhere in the text
+    Prefix     // query occurs at the start of a word
+};
+
+// Ordered from the weakest to the strongest match
+enum class MatchQuality : uint8_t { Substring, WordPrefix, Prefix, Exact };
+
+struct LINES_API TextMatch {
+    DocID doc;
+    MatchQuality quality;
+    std::uint32_t position;
+    std::uint32_t length; // length of the matched text
+};
+
+// ASCII case folding, other bytes (including UTF-8 sequences) are kept as is
+LINES_NODISCARD LINES_API auto fold_case(std::string_view text) -> std::string;
+
+// Position of the first occurrence of `needle` in `haystack` at or after `from`,
+// std::string_view::npos if there is none. Uses SIMD when available.
+LINES_NODISCARD LINES_API auto find(std::string_view haystack, std::string_view needle,
+                                    std::size_t from = 0) -> std::size_t;
+
+// Trigram index over short texts. Candidates are found by intersecting the
+// posting lists of the query trigrams and then verified against the stored
+// case-folded text. Queries shorter than a trigram verify every document.
+class LINES_API TextIndex {
+    using Bitmap = Containers::RoaringBitmap;
+
+    std::unordered_map<std::uint32_t, Bitmap> _postings;
+    std::vector<std::string> _texts;
+    Bitmap _docs;
+
+    LINES_NODISCARD auto candidates(std::string_view folded) const -> Bitmap;
+
+  public:
+    static LINES_CONSTEXPR std::size_t NO_LIMIT = std::numeric_limits<std::size_t>::max();
+
+    void insert(DocID doc, std::string_view text);
+    // Indexes texts[i] under first + i, same as inserting them one by one.
+    // Folding and trigram extraction run in chunks on `executor`, the
+    // postings of the chunks are merged on the calling thread.
+    void insert(DocID first, std::span<const std::string_view> texts,
+                Execution::Executor &executor = Execution::default_executor());
+    void erase(DocID doc);
+    void update(DocID doc, std::string_view text);
+
+    LINES_NODISCARD auto contains(DocID doc) const -> bool { return _docs.contains(doc); }
+    LINES_NODISCARD auto size() const -> std::size_t { return _docs.cardinality(); }
+
+    // Returns matches ordered by quality, then by shorter text, then by id
+    LINES_NODISCARD auto search(std::string_view query, MatchMode mode = MatchMode::Substring,
+                                std::size_t limit = NO_LIMIT) const -> std::vector<TextMatch>;
+};
+} // namespace Lines::Search
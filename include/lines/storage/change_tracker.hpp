@@ -0,0 +1,148 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/containers/roaring.hpp"
+#include "lines/detail/macro.h"
+#include "lines/detail/memory.hpp"
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/storage/workspace.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_observer.hpp"
+#include "lines/tasks/task_repeat.hpp"
+#include "lines/temporal/timepoint.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace Lines::Storage {
+// Typed deltas, each one carries the new value of what it describes
+namespace Delta {
+struct LINES_API TaskTitle {
+    TaskID task;
+    std::pmr::string title;
+};
+
+struct LINES_API TaskDescription {
+    TaskID task;
+    std::optional<std::pmr::string> description;
+};
+
+struct LINES_API TaskTags {
+    TaskID task;
+    Tags tags;
+};
+
+struct LINES_API TaskDeadline {
+    TaskID task;
+    std::optional<Temporal::TimePoint> deadline;
+};
+
+struct LINES_API TaskCompletion {
+    TaskID task;
+    bool completed;
+};
+
+struct LINES_API TaskRepeatRule {
+    TaskID task;
+    std::optional<Lines::TaskRepeatRule> rule;
+};
+
+struct LINES_API NodeAdded {
+    RoadmapID roadmap;
+    RoadmapNode::NodeID node;
+    RoadmapNode::NodeID parent;
+    RoadmapNodeInfo info;
+    RoadmapNode::State state;
+};
+
+struct LINES_API NodeRemoved {
+    RoadmapID roadmap;
+    RoadmapNode::NodeID node;
+};
+
+struct LINES_API NodeState {
+    RoadmapID roadmap;
+    RoadmapNode::NodeID node;
+    RoadmapNode::State state;
+};
+} // namespace Delta
+
+using Change = std::variant<Delta::TaskTitle, Delta::TaskDescription, Delta::TaskTags,
+                            Delta::TaskDeadline, Delta::TaskCompletion, Delta::TaskRepeatRule,
+                            Delta::NodeAdded, Delta::NodeRemoved, Delta::NodeState>;
+
+// Opt-in change tracking for attached tasks and roadmaps. Every notification
+// marks the item in a dirty set and records a delta, repeated changes of the
+// same value overwrite the pending delta in place:
+//
+//   - a task field keeps its latest value
+//   - a node state change of a node added in the batch updates the NodeAdded
+//   - removing a childless node added in the batch cancels both deltas
+//
+// so the batch grows with the number of distinct edits, not with their
+// count. Not synchronized, feed it from one thread at a time.
+class LINES_API ChangeTracker final : public TaskObserver, public RoadmapObserver {
+    std::vector<std::optional<Change>> _changes; // nullopt marks a cancelled delta
+    std::size_t _live = 0;
+    // Pending delta of a (task, field) or (roadmap, node) pair
+    std::unordered_map<std::uint64_t, std::size_t> _task_slots;
+    std::unordered_map<std::uint64_t, std::size_t> _node_slots;
+    Containers::RoaringBitmap _dirty_tasks;
+    Containers::RoaringBitmap _dirty_roadmaps;
+
+    void record_task(TaskID id, Change change);
+    void push(Change change);
+    void drop(std::size_t slot);
+
+  public:
+    // Tasks and roadmaps changed since the last take_changes()
+    LINES_NODISCARD auto dirty_tasks() const -> const Containers::RoaringBitmap & {
+        return _dirty_tasks;
+    }
+    LINES_NODISCARD auto dirty_roadmaps() const -> const Containers::RoaringBitmap & {
+        return _dirty_roadmaps;
+    }
+    // Number of pending deltas
+    LINES_NODISCARD auto size() const -> std::size_t { return _live; }
+    LINES_NODISCARD auto empty() const -> bool { return _live == 0; }
+
+    // Pending deltas in the order of their first change, clears the tracker
+    auto take_changes() -> std::vector<Change>;
+
+    void on_title_changed(TaskID id, const Task &task, const std::pmr::string &old_title) override;
+    void on_description_changed(TaskID id, const Task &task,
+                                const std::optional<std::pmr::string> &old_description) override;
+    void on_tags_changed(TaskID id, const Task &task, const Tags &old_tags) override;
+    void on_deadline_changed(TaskID id, const Task &task,
+                             const std::optional<Temporal::TimePoint> &old_deadline) override;
+    void on_completion_changed(TaskID id, const Task &task) override;
+    void on_repeat_rule_changed(TaskID id, const Task &task) override;
+
+    void on_node_added(RoadmapID id, const RoadmapNode &node) override;
+    void on_node_removed(RoadmapID id, const RoadmapNode &node) override;
+    void on_node_state_changed(RoadmapID id, const RoadmapNode &node,
+                               RoadmapNode::State old_state) override;
+};
+
+// Applies deltas taken from a tracker to another copy of the workspace.
+// Throws std::out_of_range for unknown tasks, roadmaps or nodes.
+LINES_API void apply_changes(Workspace &workspace, std::span<const Change> changes);
+} // namespace Lines::Storage
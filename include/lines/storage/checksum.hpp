@@ -0,0 +1,27 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Lines::Storage {
+// CRC-32C (Castagnoli). Uses the SSE4.2 crc32 instruction when available.
+// Passing the result of a previous call as `crc` continues the checksum.
+LINES_NODISCARD LINES_API auto crc32c(std::span<const std::byte> bytes, std::uint32_t crc = 0)
+    -> std::uint32_t;
+} // namespace Lines::Storage
@@ -0,0 +1,215 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_observer.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Lines::Storage {
+// Epoch based reclamation. Readers pin the current epoch for as long as they
+// hold pointers into shared data, writers unlink objects first and retire
+// them under epoch(); an object retired under an epoch below safe_epoch() is
+// unreachable by every reader and may be freed. Writers advance() the epoch
+// only when they want to free something, so readers rarely miss the cache
+// line holding it.
+class LINES_API EpochDomain {
+  public:
+    static LINES_CONSTEXPR std::size_t SLOTS = 128;
+
+  private:
+    // One cache line per reader slot, 0 marks a free slot
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> epoch{0};
+    };
+
+    std::atomic<std::uint64_t> _epoch{1};
+    std::array<Slot, SLOTS> _slots{};
+
+  public:
+    class LINES_API Guard {
+        EpochDomain *_domain = nullptr;
+        std::size_t _slot = 0;
+
+        friend class EpochDomain;
+        Guard(EpochDomain &domain, std::size_t slot) : _domain(&domain), _slot(slot) {}
+
+      public:
+        Guard() = default;
+        Guard(const Guard &) = delete;
+        Guard(Guard &&other) noexcept
+            : _domain(std::exchange(other._domain, nullptr)), _slot(other._slot) {}
+        auto operator=(const Guard &) -> Guard & = delete;
+        auto operator=(Guard &&other) noexcept -> Guard & {
+            std::swap(_domain, other._domain);
+            std::swap(_slot, other._slot);
+            return *this;
+        }
+        ~Guard() {
+            if (_domain != nullptr) {
+                _domain->_slots[_slot].epoch.store(0, std::memory_order_release);
+            }
+        }
+    };
+
+    EpochDomain() = default;
+    EpochDomain(const EpochDomain &) = delete;
+    EpochDomain(EpochDomain &&) = delete;
+    auto operator=(const EpochDomain &) -> EpochDomain & = delete;
+    auto operator=(EpochDomain &&) -> EpochDomain & = delete;
+    ~EpochDomain() = default;
+
+    // Announces a reader, waits only when all slots are taken
+    LINES_NODISCARD auto pin() -> Guard;
+    // Epoch to retire just unlinked objects under
+    LINES_NODISCARD auto epoch() const -> std::uint64_t { return _epoch.load(); }
+    void advance() { _epoch.fetch_add(1); }
+    LINES_NODISCARD auto safe_epoch() const -> std::uint64_t;
+};
+
+// Task collection for many readers and a few writers. Tasks are spread over
+// shards by id, every shard has a writer lock and an immutable chunked
+// directory that writers replace by path copying: an update copies the task,
+// one chunk of 64 pointers and the directory, then publishes the new
+// directory with a single store. Readers never lock, they pin an epoch and
+// see each shard as of one point in time; replaced objects are freed once no
+// pinned reader can reach them.
+//
+// Updates to different shards are not ordered with respect to each other.
+// Stored tasks are immutable copies and never attached to observers.
+class LINES_API ConcurrentTaskStore {
+    static LINES_CONSTEXPR std::size_t CHUNK = 64;
+
+    struct Chunk {
+        std::array<const Task *, CHUNK> tasks{};
+    };
+
+    struct Directory {
+        std::size_t size = 0;
+        std::vector<const Chunk *> chunks;
+    };
+
+    struct Retired {
+        const void *object;
+        void (*destroy)(const void *);
+        std::uint64_t epoch;
+    };
+
+    // Readers only touch the line holding root, writers' locking stays off it
+    struct Shard {
+        alignas(64) std::atomic<const Directory *> root{nullptr};
+        alignas(64) std::mutex mutex;
+        std::vector<Retired> retired; // guarded by mutex
+    };
+
+    mutable EpochDomain _domain;
+    std::size_t _shard_count;
+    std::unique_ptr<Shard[]> _shards;
+    std::atomic<TaskID> _next{0};
+
+    LINES_NODISCARD auto shard_of(TaskID id) const -> Shard & { return _shards[id % _shard_count]; }
+    LINES_NODISCARD auto position(TaskID id) const -> std::size_t { return id / _shard_count; }
+    LINES_NODISCARD static auto lookup(const Directory *root, std::size_t position)
+        -> const Task * {
+        return position < root->size ? root->chunks[position / CHUNK]->tasks[position % CHUNK]
+                                     : nullptr;
+    }
+
+    // Publishes `task` at `position` of a locked shard, nullptr erases. The
+    // replaced task, chunk and directory are retired.
+    void replace(Shard &shard, std::size_t position, std::unique_ptr<const Task> task);
+    void collect(Shard &shard);
+
+  public:
+    // Consistent view of every shard, holds readers' epoch pinned while alive
+    class LINES_API Snapshot {
+        EpochDomain::Guard _guard;
+        std::vector<const Directory *> _roots;
+
+        friend class ConcurrentTaskStore;
+        Snapshot(const ConcurrentTaskStore &store, EpochDomain::Guard guard);
+
+      public:
+        Snapshot(const Snapshot &) = delete;
+        Snapshot(Snapshot &&) = default;
+        auto operator=(const Snapshot &) -> Snapshot & = delete;
+        auto operator=(Snapshot &&) -> Snapshot & = default;
+        ~Snapshot() = default;
+
+        // nullptr for ids that were never inserted or are erased
+        LINES_NODISCARD auto find(TaskID id) const -> const Task *;
+        LINES_NODISCARD auto size() const -> std::size_t;
+
+        // Calls fn(TaskID, const Task &) for every task, shard by shard
+        template <typename F> void for_each(F &&fn) const {
+            for (std::size_t shard = 0; shard < _roots.size(); ++shard) {
+                const Directory *root = _roots[shard];
+                for (std::size_t position = 0; position < root->size; ++position) {
+                    if (const Task *task = lookup(root, position)) {
+                        fn(static_cast<TaskID>(position * _roots.size() + shard), *task);
+                    }
+                }
+            }
+        }
+    };
+
+    // Throws std::invalid_argument for zero shards
+    explicit ConcurrentTaskStore(std::size_t shards = 16);
+    ConcurrentTaskStore(const ConcurrentTaskStore &) = delete;
+    ConcurrentTaskStore(ConcurrentTaskStore &&) = delete;
+    auto operator=(const ConcurrentTaskStore &) -> ConcurrentTaskStore & = delete;
+    auto operator=(ConcurrentTaskStore &&) -> ConcurrentTaskStore & = delete;
+    // Readers must be gone
+    ~ConcurrentTaskStore();
+
+    // Stores a detached copy of `task` under a fresh id
+    auto insert(Task task) -> TaskID;
+    // Applies fn(Task &) to a copy of the task and publishes it. Throws
+    // std::out_of_range for unknown ids, nothing is published if fn throws.
+    template <typename F> void update(TaskID id, F &&fn) {
+        Shard &shard = shard_of(id);
+        const std::lock_guard lock{shard.mutex};
+        const Task *current = lookup(shard.root.load(std::memory_order_relaxed), position(id));
+        if (current == nullptr) {
+            throw std::out_of_range("ConcurrentTaskStore::update: unknown task");
+        }
+        auto task = std::make_unique<Task>(*current);
+        std::forward<F>(fn)(*task);
+        replace(shard, position(id), std::move(task));
+    }
+    // Returns false for unknown ids
+    auto erase(TaskID id) -> bool;
+
+    // Calls fn(const Task *) with the current version of the task, or nullptr
+    template <typename F> auto read(TaskID id, F &&fn) const -> decltype(auto) {
+        const auto guard = _domain.pin();
+        return std::forward<F>(fn)(lookup(shard_of(id).root.load(), position(id)));
+    }
+    LINES_NODISCARD auto snapshot() const -> Snapshot;
+
+    LINES_NODISCARD auto shard_count() const -> std::size_t { return _shard_count; }
+    // Replaced objects not freed yet, because a reader may still see them
+    LINES_NODISCARD auto pending_reclamation() const -> std::size_t;
+};
+} // namespace Lines::Storage
@@ -0,0 +1,85 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace Lines::Storage {
+// Unbuffered file handle with explicit durability. Failures throw
+// std::system_error.
+class LINES_API File {
+    int _fd = -1;
+
+  public:
+    enum class Mode : std::uint8_t {
+        Read,
+        Append,  // creates the file if it does not exist
+        Truncate // creates the file or empties an existing one
+    };
+
+    File() = default;
+    File(const std::filesystem::path &path, Mode mode);
+    File(const File &) = delete;
+    File(File &&other) noexcept;
+    auto operator=(const File &) -> File & = delete;
+    auto operator=(File &&other) noexcept -> File &;
+    ~File();
+
+    LINES_NODISCARD auto is_open() const -> bool { return _fd >= 0; }
+
+    // Reads up to buffer.size() bytes, returns 0 at the end of the file
+    auto read(std::span<std::byte> buffer) -> std::size_t;
+    void write(std::span<const std::byte> bytes);
+    // Blocks until written data has reached the storage device
+    void sync();
+    void close();
+};
+
+// Read-only mapping of a whole file. Pages are loaded on first access, so
+// mapping costs the same for any file size. The mapping stays valid when the
+// file is replaced by a rename.
+class LINES_API MappedFile {
+    const std::byte *_data = nullptr;
+    std::size_t _size = 0;
+
+  public:
+    MappedFile() = default;
+    explicit MappedFile(const std::filesystem::path &path);
+    MappedFile(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    auto operator=(const MappedFile &) -> MappedFile & = delete;
+    auto operator=(MappedFile &&other) noexcept -> MappedFile &;
+    ~MappedFile();
+
+    LINES_NODISCARD auto bytes() const -> std::span<const std::byte> { return {_data, _size}; }
+    LINES_NODISCARD auto size() const -> std::size_t { return _size; }
+};
+
+LINES_NODISCARD LINES_API auto read_file(const std::filesystem::path &path)
+    -> std::vector<std::byte>;
+
+// Makes a rename or a new file in `dir` durable. No-op where unsupported.
+LINES_API void sync_directory(const std::filesystem::path &dir);
+
+// Writes `bytes` to a temporary file next to `path`, syncs it and renames
+// it over `path`, so readers see either the old or the new contents.
+LINES_API void write_file_atomically(const std::filesystem::path &path,
+                                     std::span<const std::byte> bytes);
+} // namespace Lines::Storage
@@ -0,0 +1,142 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/storage/file.hpp"
+#include "lines/storage/workspace.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_observer.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+// A journal directory holds numbered generations:
+//
+//   snapshot-<G>      workspace snapshot of everything logged before log G
+//   journal-<G>.log   mutations recorded after snapshot G
+//
+// Logs start with "LNWL", u16 version, u16 reserved, u64 generation and
+// continue with frames of u32 payload length, u32 CRC-32C of the payload and
+// the payload, a record type byte followed by its fields. A torn or corrupt
+// frame ends the replay of its log, so a crash loses at most the records
+// that were not committed yet.
+namespace Lines::Storage {
+inline LINES_CONSTEXPR std::uint16_t JOURNAL_VERSION = 1;
+
+struct LINES_API JournalOptions {
+    enum class SyncPolicy : std::uint8_t {
+        EveryCommit, // commit() returns once the records are on the device
+        Interval,    // commit() writes, the device is synced at most once per sync_interval,
+                     // by a background thread when no later commit does it
+        Never        // leaves syncing to the operating system
+    };
+
+    SyncPolicy sync = SyncPolicy::EveryCommit;
+    std::chrono::milliseconds sync_interval{100}; // NOLINT
+};
+
+// Records mutations of attached tasks and roadmaps into the log of a journal
+// directory. Appending only encodes the record into memory, commit() writes
+// everything appended so far. Concurrent commits are grouped: one caller
+// writes and syncs the batch while the others wait for it.
+//
+// Tasks and roadmaps are identified by the ids they are attached under,
+// which are their positions in the recovered Workspace.
+class LINES_API Journal final : public TaskObserver, public RoadmapObserver {
+  public:
+    using Generation = std::uint64_t;
+
+  private:
+    std::filesystem::path _dir;
+    JournalOptions _options;
+
+    std::mutex _mutex;
+    std::condition_variable _committed;
+    std::vector<std::byte> _pending;
+    std::uint64_t _appended = 0; // records appended
+    std::uint64_t _durable = 0;  // records written out by commit()
+    bool _writing = false;       // a commit leader is writing a batch
+    bool _unsynced = false;      // written records wait for an Interval sync
+    File _log;
+    Generation _generation = 0;
+    std::chrono::steady_clock::time_point _last_sync;
+    std::exception_ptr _failure; // a failed write leaves the log unusable
+    std::condition_variable_any _sync_wanted;
+    std::jthread _syncer; // SyncPolicy::Interval only
+
+    std::thread _compaction;
+    std::exception_ptr _compaction_error;
+
+    void append(const std::vector<std::byte> &payload);
+    void open_log(Generation generation);
+    void run_syncer(std::stop_token stop);
+
+  public:
+    // Starts a new log after the newest generation found in `dir`, the
+    // directory is created if needed. Existing files are left for recover().
+    explicit Journal(std::filesystem::path dir, JournalOptions options = {});
+    Journal(const Journal &) = delete;
+    Journal(Journal &&) = delete;
+    auto operator=(const Journal &) -> Journal & = delete;
+    auto operator=(Journal &&) -> Journal & = delete;
+    // Commits pending records and waits for a running compaction
+    ~Journal() override;
+
+    // Loads the newest snapshot of `dir` and replays the logs written after it.
+    // Throws SnapshotError if a record does not fit the recovered state.
+    LINES_NODISCARD static auto recover(const std::filesystem::path &dir) -> Workspace;
+
+    LINES_NODISCARD auto generation() const -> Generation { return _generation; }
+    LINES_NODISCARD auto directory() const -> const std::filesystem::path & { return _dir; }
+
+    // Records a task or roadmap that is new or replaces the one under `id`.
+    // Nodes the roadmap already has are recorded along with it.
+    void task_added(TaskID id, const Task &task);
+    void roadmap_added(RoadmapID id, const Roadmap &rmap);
+
+    void on_title_changed(TaskID id, const Task &task, const std::pmr::string &old_title) override;
+    void on_description_changed(TaskID id, const Task &task,
+                                const std::optional<std::pmr::string> &old_description) override;
+    void on_tags_changed(TaskID id, const Task &task, const Tags &old_tags) override;
+    void on_deadline_changed(TaskID id, const Task &task,
+                             const std::optional<Temporal::TimePoint> &old_deadline) override;
+    void on_completion_changed(TaskID id, const Task &task) override;
+    void on_repeat_rule_changed(TaskID id, const Task &task) override;
+
+    void on_node_added(RoadmapID id, const RoadmapNode &node) override;
+    void on_node_removed(RoadmapID id, const RoadmapNode &node) override;
+    void on_node_state_changed(RoadmapID id, const RoadmapNode &node,
+                               RoadmapNode::State old_state) override;
+
+    // Writes every record appended before the call, syncing per the policy
+    void commit();
+
+    // Switches to a new log and folds the previous generations into a
+    // snapshot on a background thread, then deletes the files it replaces.
+    // At most one compaction runs at a time.
+    void compact();
+    // Blocks until the running compaction finishes, rethrows its failure
+    void wait_for_compaction();
+};
+} // namespace Lines::Storage
@@ -0,0 +1,145 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/detail/memory.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Lines::Storage {
+// Thrown on malformed JSON or on input that does not match the expected shape
+class LINES_API JsonError : public std::runtime_error {
+  public:
+    using std::runtime_error::runtime_error;
+};
+
+// Streaming JSON writer. Output is compact and buffered, memory use does not
+// depend on the size of the document. Nesting is checked with assertions only.
+class LINES_API JsonWriter {
+    static LINES_CONSTEXPR std::size_t BUFFER_SIZE = 64 * 1024;
+
+    std::ostream &_out;
+    std::string _buffer;
+    std::vector<bool> _empty; // per open container, true until it has an element
+    bool _after_key = false;
+
+    void separate();
+    void put(char chr);
+    void put(std::string_view str);
+    void quoted(std::string_view str);
+
+  public:
+    explicit JsonWriter(std::ostream &out);
+    JsonWriter(const JsonWriter &) = delete;
+    JsonWriter(JsonWriter &&) = delete;
+    auto operator=(const JsonWriter &) -> JsonWriter & = delete;
+    auto operator=(JsonWriter &&) -> JsonWriter & = delete;
+    ~JsonWriter();
+
+    auto begin_object() -> JsonWriter &;
+    auto end_object() -> JsonWriter &;
+    auto begin_array() -> JsonWriter &;
+    auto end_array() -> JsonWriter &;
+    auto key(std::string_view name) -> JsonWriter &;
+    auto string(std::string_view value) -> JsonWriter &;
+    auto integer(std::int64_t value) -> JsonWriter &;
+    auto boolean(bool value) -> JsonWriter &;
+    auto null() -> JsonWriter &;
+
+    // Hands buffered output to the stream
+    void flush();
+};
+
+enum class JsonToken : std::uint8_t {
+    BeginObject,
+    EndObject,
+    BeginArray,
+    EndArray,
+    Key,
+    String,
+    Number,
+    Boolean,
+    Null,
+    End // the top-level value has been read completely
+};
+
+// Pull parser over a stream. The input is read through a fixed-size buffer
+// and strings are decoded into one reusable buffer, which take_string() can
+// move into the destination. Strings use the allocator of the reader.
+class LINES_API JsonReader {
+    static LINES_CONSTEXPR std::size_t BUFFER_SIZE = 64 * 1024;
+
+    enum class Expect : std::uint8_t { Value, FirstValue, FirstKey, Key, Separator, Done };
+
+    std::istream &_in;
+    std::vector<char> _buffer;
+    std::size_t _pos = 0;
+    std::size_t _end = 0;
+    std::size_t _offset = 0; // input offset of _buffer[0]
+    std::vector<char> _stack; // '{' or '[' per open container
+    Expect _expect = Expect::Value;
+    std::optional<JsonToken> _peeked;
+    std::pmr::string _string;
+    std::string _number;
+    bool _boolean = false;
+
+    auto fill() -> bool;
+    auto peek_char() -> int;
+    auto get_char() -> int;
+    auto skip_whitespace() -> int;
+    void expect_literal(std::string_view rest);
+    void read_string();
+    void read_escape();
+    void read_number();
+    void value_done();
+    auto read_token() -> JsonToken;
+    [[noreturn]] void fail(std::string_view message) const;
+
+  public:
+    using allocator_type = Allocator;
+
+    explicit JsonReader(std::istream &in, const allocator_type &alloc = {});
+
+    LINES_NODISCARD auto get_allocator() const -> allocator_type { return _string.get_allocator(); }
+
+    auto next() -> JsonToken;
+    // Reads ahead one token without consuming it. The value of the peeked
+    // token replaces the value of the last one.
+    auto peek() -> JsonToken;
+
+    // Value of the last Key or String token, valid until the next call to next()
+    LINES_NODISCARD auto string() const -> std::string_view { return _string; }
+    // Moves the value of the last Key or String token out of the reader
+    auto take_string() -> std::pmr::string;
+    // Value of the last Number token, which must be an integer
+    LINES_NODISCARD auto integer() const -> std::int64_t;
+    LINES_NODISCARD auto boolean() const -> bool { return _boolean; }
+
+    // Reads one whole value, including everything nested in it
+    void skip();
+    // Reads the next token and throws unless it is `token`
+    void expect(JsonToken token);
+    // Input offset of the next unread byte, for error messages
+    LINES_NODISCARD auto offset() const -> std::size_t { return _offset + _pos; }
+};
+} // namespace Lines::Storage
@@ -0,0 +1,52 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/storage/json.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_repeat.hpp"
+
+// JSON representation of tasks and roadmaps. Time points are integer seconds
+// since the epoch, weekdays are integers with Monday = 0.
+//
+//   task    {"title": "..", "description": "..", "tags": [".."], "deadline": 0,
+//            "completed": false, "repeat": rule}
+//   rule    {"interval": 86400, "unit": "days", "end": 0} or {"weekdays": [0, 4], "end": 0}
+//   roadmap {"title": "..", "description": "..", "tags": [".."], "nodes": [node]}
+//   node    {"title": "..", "description": "..", "tags": [".."], "state": "completed",
+//            "children": [node]}
+//
+// Optional members are omitted when empty. Readers accept members in any
+// order, except that nodes and children are built as soon as they are read,
+// so the title, description and tags of their owner have to precede them.
+// Unknown members are skipped.
+namespace Lines::Storage {
+void LINES_API write_json(JsonWriter &writer, const TaskRepeatRule &rule);
+void LINES_API write_json(JsonWriter &writer, const Task &task);
+// Writes `node` together with its subtree
+void LINES_API write_json(JsonWriter &writer, const RoadmapNode &node);
+// Writes the roadmap, the root node itself is implicit
+void LINES_API write_json(JsonWriter &writer, const Roadmap &rmap);
+
+// Readers consume exactly one value and allocate with the allocator of the
+// reader, so strings are moved out of it without copying.
+LINES_NODISCARD LINES_API auto read_repeat_rule(JsonReader &reader) -> TaskRepeatRule;
+LINES_NODISCARD LINES_API auto read_task(JsonReader &reader) -> Task;
+LINES_NODISCARD LINES_API auto read_roadmap(JsonReader &reader) -> Roadmap;
+// Reads a node with its subtree and adds it to `rmap` under `parent`
+LINES_API auto read_node(JsonReader &reader, Roadmap &rmap, const RoadmapNode::NodePtr &parent)
+    -> RoadmapNode::NodePtr;
+} // namespace Lines::Storage
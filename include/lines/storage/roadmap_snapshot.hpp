@@ -0,0 +1,204 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/detail/memory.hpp"
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/storage/snapshot_format.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// Roadmap records are 40 bytes wide:
+//
+//   0  title        StringRef      24 first node  u32
+//   8  description  StringRef      28 node count  u32
+//   16 first tag    u32            32 flags       u32
+//   20 tag count    u32            36 reserved    u32
+//
+// Node records are 48 bytes wide and follow their roadmap in pre-order, the
+// root node is implicit:
+//
+//   0  title        StringRef      24 id                u64
+//   8  description  StringRef      32 parent id         u64
+//   16 first tag    u32            40 state u8, flags u8, 2 reserved bytes
+//   20 tag count    u32            44 descendant count  u32
+//
+// The descendant count lets readers walk the tree without an index: the
+// children of a node start right after it, each one followed by its
+// descendants.
+namespace Lines::Storage {
+class NodeRange;
+
+// Read-only view of one node record, strings point into the image
+class LINES_API NodeView {
+    std::span<const std::byte> _nodes; // node records of the roadmap
+    std::size_t _index{};
+    std::span<const std::byte> _strings;
+    std::span<const std::byte> _tags;
+
+    LINES_NODISCARD auto record() const -> const std::byte *;
+
+    friend class NodeRange;
+
+  public:
+    static LINES_CONSTEXPR std::size_t RECORD_SIZE = 48;
+
+    NodeView() = default;
+    NodeView(std::span<const std::byte> nodes, std::size_t index,
+             std::span<const std::byte> strings, std::span<const std::byte> tags);
+
+    // Position of the node in the pre-order of its roadmap
+    LINES_NODISCARD auto index() const -> std::size_t { return _index; }
+    LINES_NODISCARD auto id() const -> RoadmapNode::NodeID;
+    LINES_NODISCARD auto parent_id() const -> RoadmapNode::NodeID;
+    LINES_NODISCARD auto state() const -> RoadmapNode::State;
+    LINES_NODISCARD auto title() const -> std::string_view;
+    LINES_NODISCARD auto description() const -> std::optional<std::string_view>;
+    LINES_NODISCARD auto tag_count() const -> std::size_t;
+    LINES_NODISCARD auto tag(std::size_t index) const -> std::string_view;
+    LINES_NODISCARD auto descendant_count() const -> std::size_t;
+    LINES_NODISCARD auto children() const -> NodeRange;
+
+    LINES_NODISCARD auto to_info(const Allocator &alloc = {}) const -> RoadmapNodeInfo;
+};
+
+// Sibling nodes of a roadmap, visited by skipping over their descendants
+class LINES_API NodeRange : public std::ranges::view_interface<NodeRange> {
+    std::span<const std::byte> _nodes;
+    std::size_t _first{};
+    std::size_t _last{};
+    std::span<const std::byte> _strings;
+    std::span<const std::byte> _tags;
+
+  public:
+    class Iterator {
+        NodeView _node;
+        std::size_t _last{};
+
+      public:
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = NodeView;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        Iterator(NodeView node, std::size_t last) : _node(node), _last(last) {}
+
+        auto operator*() const -> NodeView { return _node; }
+        auto operator++() -> Iterator &;
+        auto operator++(int) -> Iterator {
+            Iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+        auto operator==(const Iterator &other) const -> bool {
+            return _node.index() == other._node.index();
+        }
+    };
+
+    NodeRange() = default;
+    // Siblings starting at `first`, none of them reaches past `last`
+    NodeRange(std::span<const std::byte> nodes, std::size_t first, std::size_t last,
+              std::span<const std::byte> strings, std::span<const std::byte> tags)
+        : _nodes(nodes), _first(first), _last(last), _strings(strings), _tags(tags) {}
+
+    LINES_NODISCARD auto begin() const -> Iterator {
+        return Iterator{NodeView{_nodes, _first, _strings, _tags}, _last};
+    }
+    LINES_NODISCARD auto end() const -> Iterator {
+        return Iterator{NodeView{_nodes, _last, _strings, _tags}, _last};
+    }
+};
+
+// Read-only view of one roadmap record and its nodes
+class LINES_API RoadmapView {
+    const std::byte *_record;
+    std::span<const std::byte> _nodes;
+    std::span<const std::byte> _strings;
+    std::span<const std::byte> _tags;
+
+  public:
+    static LINES_CONSTEXPR std::size_t RECORD_SIZE = 40;
+
+    // `nodes` holds the node records of this roadmap
+    RoadmapView(const std::byte *record, std::span<const std::byte> nodes,
+                std::span<const std::byte> strings, std::span<const std::byte> tags);
+
+    LINES_NODISCARD auto title() const -> std::string_view;
+    LINES_NODISCARD auto description() const -> std::optional<std::string_view>;
+    LINES_NODISCARD auto tag_count() const -> std::size_t;
+    LINES_NODISCARD auto tag(std::size_t index) const -> std::string_view;
+
+    // Nodes without the root, in pre-order
+    LINES_NODISCARD auto node_count() const -> std::size_t {
+        return _nodes.size() / NodeView::RECORD_SIZE;
+    }
+    LINES_NODISCARD auto node(std::size_t index) const -> NodeView;
+    // Children of the root
+    LINES_NODISCARD auto children() const -> NodeRange;
+
+    // Materializes the roadmap with its node ids as a detached Roadmap
+    LINES_NODISCARD auto to_roadmap(const Allocator &alloc = {}) const -> Roadmap;
+};
+
+// Reads the roadmap sections of a snapshot in place
+class LINES_API RoadmapSnapshot {
+    SnapshotImage _image;
+    std::span<const std::byte> _strings;
+    std::span<const std::byte> _records;
+    std::span<const std::byte> _nodes;
+    std::span<const std::byte> _tags;
+
+  public:
+    RoadmapSnapshot() = default;
+    explicit RoadmapSnapshot(std::span<const std::byte> bytes, Verify verify = Verify::Checksums);
+
+    LINES_NODISCARD auto size() const -> std::size_t {
+        return _records.size() / RoadmapView::RECORD_SIZE;
+    }
+    LINES_NODISCARD auto empty() const -> bool { return _records.empty(); }
+    LINES_NODISCARD auto operator[](std::size_t index) const -> RoadmapView;
+
+    LINES_NODISCARD auto roadmaps() const {
+        return std::views::iota(std::size_t{0}, size()) |
+               std::views::transform([this](std::size_t index) { return (*this)[index]; });
+    }
+};
+
+// Serializes roadmaps into roadmap snapshot sections
+class LINES_API RoadmapSnapshotWriter {
+    StringTableWriter _strings;
+    std::vector<std::byte> _records;
+    std::vector<std::byte> _nodes;
+    std::vector<std::byte> _tags;
+
+    template <typename Item> auto write_info(std::byte *record, const Item &item) -> std::uint8_t;
+
+  public:
+    void add(const Roadmap &rmap);
+    LINES_NODISCARD auto size() const -> std::size_t {
+        return _records.size() / RoadmapView::RECORD_SIZE;
+    }
+
+    // Moves the collected sections into `writer` and leaves this writer empty
+    void write_sections(SnapshotWriter &writer);
+};
+} // namespace Lines::Storage
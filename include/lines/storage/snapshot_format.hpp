@@ -0,0 +1,122 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Snapshot images are little-endian and laid out as
+//
+//   header    "LNSP", u16 version, u16 section count, u32 table checksum, u32 reserved
+//   table     u32 kind, u32 checksum, u64 offset, u64 size   (one entry per section)
+//   payloads  section contents, each starting at an 8-byte boundary
+//
+// Checksums are CRC-32C, the table checksum covers the section table.
+// Readers skip sections of unknown kinds.
+namespace Lines::Storage {
+inline LINES_CONSTEXPR std::uint16_t SNAPSHOT_VERSION = 1;
+
+enum class SectionKind : std::uint32_t {
+    Strings = 1,  // string table, referenced by StringRef
+    Tasks = 2,    // fixed-width task records
+    TaskTags = 3, // StringRef runs referenced by task records
+    RoadmapStrings = 4,
+    Roadmaps = 5,     // fixed-width roadmap records
+    RoadmapNodes = 6, // fixed-width node records, in pre-order per roadmap
+    RoadmapTags = 7,
+};
+
+enum class Verify : std::uint8_t {
+    Checksums, // header, bounds and every section checksum
+    Structure  // header and bounds only, for callers that trust the bytes
+};
+
+// Thrown when a snapshot image is malformed or fails verification
+class LINES_API SnapshotError : public std::runtime_error {
+  public:
+    using std::runtime_error::runtime_error;
+};
+
+// Location of a string in the string table, stored as two u32 values
+struct LINES_API StringRef {
+    static LINES_CONSTEXPR std::size_t SIZE = 8;
+
+    std::uint32_t offset;
+    std::uint32_t length;
+};
+
+// Collects strings into a string table, equal strings are stored once
+class LINES_API StringTableWriter {
+    struct Hash {
+        using is_transparent = void;
+        auto operator()(std::string_view str) const -> std::size_t {
+            return std::hash<std::string_view>{}(str);
+        }
+    };
+
+    std::vector<std::byte> _bytes;
+    std::unordered_map<std::string, StringRef, Hash, std::equal_to<>> _refs;
+
+  public:
+    auto add(std::string_view str) -> StringRef;
+    LINES_NODISCARD auto size() const -> std::size_t { return _bytes.size(); }
+    // Hands the table out and leaves the writer empty
+    auto take() -> std::vector<std::byte>;
+};
+
+// Assembles sections into a snapshot image
+class LINES_API SnapshotWriter {
+    std::vector<std::pair<SectionKind, std::vector<std::byte>>> _sections;
+
+  public:
+    void add_section(SectionKind kind, std::vector<std::byte> payload);
+    // Returns the image and leaves the writer empty
+    LINES_NODISCARD auto finish() -> std::vector<std::byte>;
+};
+
+// Validated view over the sections of a snapshot image. The bytes are used
+// in place and must outlive the image.
+class LINES_API SnapshotImage {
+    struct Section {
+        SectionKind kind;
+        std::span<const std::byte> payload;
+    };
+
+    std::uint16_t _version{};
+    std::vector<Section> _sections;
+
+  public:
+    SnapshotImage() = default;
+    explicit SnapshotImage(std::span<const std::byte> bytes, Verify verify = Verify::Checksums);
+
+    LINES_NODISCARD auto version() const -> std::uint16_t { return _version; }
+    // Payload of the first section of `kind`, empty if there is none
+    LINES_NODISCARD auto section(SectionKind kind) const -> std::span<const std::byte>;
+};
+
+// Resolves the StringRef stored at `ref` against `strings`
+LINES_NODISCARD LINES_API auto read_string(std::span<const std::byte> strings,
+                                           const std::byte *ref) -> std::string_view;
+void LINES_API write_string_ref(std::byte *dst, StringRef ref);
+} // namespace Lines::Storage
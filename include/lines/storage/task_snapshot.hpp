@@ -0,0 +1,113 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/detail/memory.hpp"
+#include "lines/storage/snapshot_format.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_repeat.hpp"
+#include "lines/temporal/timepoint.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// Task records are 64 bytes wide:
+//
+//   0  title        StringRef      32 rule interval  i64 seconds
+//   8  description  StringRef      40 rule end       i64 seconds since epoch
+//   16 first tag    u32            48 rule unit      StringRef
+//   20 tag count    u32            56 flags u16, rule kind u8, weekday mask u8
+//   24 deadline     i64 seconds    60 reserved u32
+//
+// Weekday rules are stored as a set, so their order is not preserved.
+namespace Lines::Storage {
+// Read-only view of one task record, strings point into the image
+class LINES_API TaskView {
+    const std::byte *_record;
+    std::span<const std::byte> _strings;
+    std::span<const std::byte> _tags;
+
+  public:
+    static LINES_CONSTEXPR std::size_t RECORD_SIZE = 64;
+
+    TaskView(const std::byte *record, std::span<const std::byte> strings,
+             std::span<const std::byte> tags);
+
+    LINES_NODISCARD auto title() const -> std::string_view;
+    LINES_NODISCARD auto description() const -> std::optional<std::string_view>;
+    LINES_NODISCARD auto tag_count() const -> std::size_t;
+    LINES_NODISCARD auto tag(std::size_t index) const -> std::string_view;
+    LINES_NODISCARD auto deadline() const -> std::optional<Temporal::TimePoint>;
+    LINES_NODISCARD auto completed() const -> bool;
+    LINES_NODISCARD auto has_repeat_rule() const -> bool;
+    LINES_NODISCARD auto repeat_rule(const Allocator &alloc = {}) const
+        -> std::optional<TaskRepeatRule>;
+
+    // Materializes the record as a detached Task. Throws SnapshotError if the
+    // record does not describe a valid task.
+    LINES_NODISCARD auto to_task(const Allocator &alloc = {}) const -> Task;
+};
+
+// Reads a task snapshot in place. Opening only validates the image, records
+// are decoded on access.
+class LINES_API TaskSnapshot {
+    SnapshotImage _image;
+    std::span<const std::byte> _strings;
+    std::span<const std::byte> _records;
+    std::span<const std::byte> _tags;
+
+  public:
+    explicit TaskSnapshot(std::span<const std::byte> bytes, Verify verify = Verify::Checksums);
+
+    LINES_NODISCARD auto size() const -> std::size_t {
+        return _records.size() / TaskView::RECORD_SIZE;
+    }
+    LINES_NODISCARD auto empty() const -> bool { return _records.empty(); }
+    // Unchecked, `index` must be below size()
+    LINES_NODISCARD auto operator[](std::size_t index) const -> TaskView;
+    // Throws std::out_of_range if `index` is out of range
+    LINES_NODISCARD auto at(std::size_t index) const -> TaskView;
+
+    LINES_NODISCARD auto tasks() const {
+        return std::views::iota(std::size_t{0}, size()) |
+               std::views::transform([this](std::size_t index) { return (*this)[index]; });
+    }
+};
+
+// Serializes tasks into task snapshot sections
+class LINES_API TaskSnapshotWriter {
+    StringTableWriter _strings;
+    std::vector<std::byte> _records;
+    std::vector<std::byte> _tags;
+
+  public:
+    void add(const Task &task);
+    LINES_NODISCARD auto size() const -> std::size_t {
+        return _records.size() / TaskView::RECORD_SIZE;
+    }
+
+    // Moves the collected sections into `writer` and leaves this writer empty
+    void write_sections(SnapshotWriter &writer);
+    LINES_NODISCARD auto finish() -> std::vector<std::byte>;
+};
+
+LINES_NODISCARD LINES_API auto write_task_snapshot(std::span<const Task> tasks)
+    -> std::vector<std::byte>;
+} // namespace Lines::Storage
@@ -0,0 +1,95 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/detail/memory.hpp"
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/storage/file.hpp"
+#include "lines/storage/roadmap_snapshot.hpp"
+#include "lines/storage/snapshot_format.hpp"
+#include "lines/storage/task_snapshot.hpp"
+#include "lines/tasks/task.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Lines::Storage {
+// Tasks and roadmaps persisted together. A task is identified by its
+// position (its TaskID), a roadmap likewise by its RoadmapID.
+struct LINES_API Workspace {
+    std::vector<Task> tasks;
+    std::vector<Roadmap> roadmaps;
+};
+
+// Writes the task sections followed by the roadmap sections. Nodes keep
+// their ids, so ids recorded elsewhere stay valid after a reload.
+LINES_NODISCARD LINES_API auto write_workspace_snapshot(const Workspace &workspace)
+    -> std::vector<std::byte>;
+LINES_NODISCARD LINES_API auto read_workspace_snapshot(std::span<const std::byte> bytes,
+                                                       Verify verify = Verify::Checksums)
+    -> Workspace;
+// Replaces the file at `path` atomically with a snapshot of `workspace`
+LINES_API void save_workspace_snapshot(const std::filesystem::path &path,
+                                       const Workspace &workspace);
+
+// Workspace snapshot file mapped into memory. Opening maps the file and reads
+// the section tables only, tasks and roadmaps are read in place afterwards.
+// The first mutable access to an item promotes it into a Task or Roadmap
+// owned by the workspace, the snapshot itself never changes.
+class LINES_API MappedWorkspace {
+    MappedFile _file;
+    TaskSnapshot _tasks;
+    RoadmapSnapshot _roadmaps;
+    Allocator _alloc;
+    std::unordered_map<TaskID, Task> _promoted_tasks;
+    std::unordered_map<RoadmapID, Roadmap> _promoted_roadmaps;
+
+  public:
+    // Checksums are not verified by default, that would read the whole file.
+    // Promoted items are allocated with `alloc`.
+    explicit MappedWorkspace(const std::filesystem::path &path, Verify verify = Verify::Structure,
+                             const Allocator &alloc = {});
+    MappedWorkspace(const MappedWorkspace &) = delete;
+    MappedWorkspace(MappedWorkspace &&) = default;
+    auto operator=(const MappedWorkspace &) -> MappedWorkspace & = delete;
+    auto operator=(MappedWorkspace &&) -> MappedWorkspace & = default;
+    ~MappedWorkspace() = default;
+
+    LINES_NODISCARD auto task_count() const -> std::size_t { return _tasks.size(); }
+    LINES_NODISCARD auto roadmap_count() const -> std::size_t { return _roadmaps.size(); }
+
+    // Contents of the file, without promoted changes
+    LINES_NODISCARD auto tasks() const -> const TaskSnapshot & { return _tasks; }
+    LINES_NODISCARD auto roadmaps() const -> const RoadmapSnapshot & { return _roadmaps; }
+
+    // Mutable item, promoted from the snapshot on first access
+    auto task(TaskID id) -> Task &;
+    auto roadmap(RoadmapID id) -> Roadmap &;
+    // Promoted item or nullptr if `id` is still only in the snapshot
+    LINES_NODISCARD auto find_task(TaskID id) const -> const Task *;
+    LINES_NODISCARD auto find_roadmap(RoadmapID id) const -> const Roadmap *;
+    LINES_NODISCARD auto promoted_count() const -> std::size_t {
+        return _promoted_tasks.size() + _promoted_roadmaps.size();
+    }
+
+    // Current state with promoted items in place of their records
+    LINES_NODISCARD auto to_workspace() const -> Workspace;
+    // Writes the current state atomically, `path` may be the mapped file
+    void save(const std::filesystem::path &path) const;
+};
+} // namespace Lines::Storage
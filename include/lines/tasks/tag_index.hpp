@@ -0,0 +1,142 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/containers/roaring.hpp"
+#include "lines/detail/macro.h"
+#include "lines/execution/executor.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_observer.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Lines {
+using TagId = std::uint32_t;
+
+// Maps tag strings to dense ids. Ids are never reused, so they stay valid
+// for the lifetime of the interner.
+class LINES_API TagInterner {
+    struct Hash {
+        using is_transparent = void;
+        auto operator()(std::string_view str) const -> std::size_t {
+            return std::hash<std::string_view>{}(str);
+        }
+    };
+
+    std::unordered_map<std::string, TagId, Hash, std::equal_to<>> _ids;
+    std::vector<std::string_view> _names;
+
+  public:
+    TagInterner() = default;
+    TagInterner(const TagInterner &) = delete;
+    TagInterner(TagInterner &&) = default;
+    auto operator=(const TagInterner &) -> TagInterner & = delete;
+    auto operator=(TagInterner &&) -> TagInterner & = default;
+    ~TagInterner() = default;
+
+    auto intern(std::string_view tag) -> TagId;
+    LINES_NODISCARD auto find(std::string_view tag) const -> std::optional<TagId>;
+    LINES_NODISCARD auto name(TagId id) const -> std::string_view;
+    LINES_NODISCARD auto size() const -> std::size_t { return _names.size(); }
+};
+
+// Boolean expression over tags. `~query` is taken relative to all tasks of
+// the index it is evaluated against.
+class LINES_API TagQuery {
+  public:
+    enum class Op : uint8_t { Tag, And, Or, Not };
+
+  private:
+    Op _op;
+    std::string _tag;
+    std::vector<TagQuery> _operands;
+
+    TagQuery(Op op, std::vector<TagQuery> operands) : _op(op), _operands(std::move(operands)) {}
+
+  public:
+    explicit TagQuery(std::string tag) : _op(Op::Tag), _tag(std::move(tag)) {}
+
+    LINES_NODISCARD static auto all_of(std::vector<TagQuery> operands) -> TagQuery {
+        return TagQuery{Op::And, std::move(operands)};
+    }
+    LINES_NODISCARD static auto any_of(std::vector<TagQuery> operands) -> TagQuery {
+        return TagQuery{Op::Or, std::move(operands)};
+    }
+
+    LINES_NODISCARD friend auto operator&(TagQuery lhs, TagQuery rhs) -> TagQuery {
+        return all_of({std::move(lhs), std::move(rhs)});
+    }
+    LINES_NODISCARD friend auto operator|(TagQuery lhs, TagQuery rhs) -> TagQuery {
+        return any_of({std::move(lhs), std::move(rhs)});
+    }
+    LINES_NODISCARD friend auto operator~(TagQuery query) -> TagQuery {
+        return TagQuery{Op::Not, {std::move(query)}};
+    }
+
+    LINES_NODISCARD auto op() const -> Op { return _op; }
+    LINES_NODISCARD auto tag() const -> const std::string & { return _tag; }
+    LINES_NODISCARD auto operands() const -> const std::vector<TagQuery> & { return _operands; }
+};
+
+// Inverted index from tags to the ids of tasks carrying them. Tasks
+// registered through track() keep the index current when their tags change.
+class LINES_API TagIndex : public TaskObserver {
+    using Bitmap = Containers::RoaringBitmap;
+
+    TagInterner _interner;
+    std::vector<Bitmap> _postings;
+    Bitmap _tasks;
+
+    void add_tags(TaskID id, std::span<const std::pmr::string> tags);
+    void remove_tags(TaskID id, std::span<const std::pmr::string> tags);
+
+  public:
+    TagIndex() = default;
+    TagIndex(const TagIndex &) = delete;
+    TagIndex(TagIndex &&) = delete;
+    auto operator=(const TagIndex &) -> TagIndex & = delete;
+    auto operator=(TagIndex &&) -> TagIndex & = delete;
+    ~TagIndex() override = default;
+
+    // Indexes `task` under `id` and attaches the index to it. Throws
+    // std::invalid_argument if `task` is already attached, share it through a
+    // TaskObserverList instead.
+    void track(Task &task, TaskID id);
+    // Removes `task` from the index and detaches it
+    void untrack(Task &task);
+
+    void insert(TaskID id, std::span<const std::pmr::string> tags);
+    // Indexes the tags of tasks[i] under first + i, same as inserting them
+    // one by one. Chunks of tasks collect their postings on `executor`, tags
+    // are interned while the chunks are merged on the calling thread.
+    void insert(TaskID first, std::span<const Task> tasks,
+                Execution::Executor &executor = Execution::default_executor());
+    void erase(TaskID id, std::span<const std::pmr::string> tags);
+
+    LINES_NODISCARD auto interner() const -> const TagInterner & { return _interner; }
+    LINES_NODISCARD auto tasks() const -> const Containers::RoaringBitmap & { return _tasks; }
+    LINES_NODISCARD auto tasks_with(std::string_view tag) const -> Containers::RoaringBitmap;
+    LINES_NODISCARD auto tasks_with(TagId tag) const -> const Containers::RoaringBitmap &;
+    LINES_NODISCARD auto query(const TagQuery &query) const -> Containers::RoaringBitmap;
+
+    void on_tags_changed(TaskID id, const Task &task, const Tags &old_tags) override;
+};
+} // namespace Lines
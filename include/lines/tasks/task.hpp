@@ -14,39 +14,74 @@
 #pragma once
 
 #include "lines/detail/macro.h"
+#include "lines/detail/memory.hpp"
 #include "lines/tasks/task_info.hpp"
+#include "lines/tasks/task_observer.hpp"
 #include "lines/tasks/task_repeat.hpp"
 #include "lines/temporal/timepoint.hpp"
 
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace Lines {
 class LINES_API Task {
     TaskInfo _info;
     std::optional<TaskRepeatRule> _repeat_rule;
     std::optional<Temporal::TimePoint> _deadline;
     bool _completed{};
+    detail::TaskHook _hook;
+
+    void set_completed(bool completed);
+    // Takes over the contents of a detached `task`, notifying the observer
+    // of every field that changes
+    void assign(Task &&task);
 
   public:
+    using allocator_type = Allocator;
+
+    // Without an explicit allocator the task uses the allocator of `info`
     explicit Task(TaskInfo info, std::optional<TaskRepeatRule> rule = std::nullopt);
+    Task(std::allocator_arg_t tag, const allocator_type &alloc, TaskInfo info,
+         std::optional<TaskRepeatRule> rule = std::nullopt);
+    Task(std::allocator_arg_t tag, const allocator_type &alloc, const Task &task);
+    Task(std::allocator_arg_t tag, const allocator_type &alloc, Task &&task);
     Task(const Task &task) = default;
-    auto operator=(const Task &task) -> Task & = default;
+    // Assigning to an attached task keeps its attachment and notifies the
+    // observer of every field that changes. A detached target of a move
+    // takes over the attachment of the source instead, and an attached
+    // source of a move is copied so that its own observer stays accurate.
+    auto operator=(const Task &task) -> Task &;
     Task(Task &&) = default;
-    auto operator=(Task &&) -> Task & = default;
+    auto operator=(Task &&task) -> Task &;
     ~Task() = default;
 
     LINES_NODISCARD auto completed() const -> bool;
     void complete();
     void uncomplete();
 
-    void set_title(const std::string &title);
-    void set_description(const std::string &description);
-    void set_tags(std::vector<std::string> tags);
+    LINES_NODISCARD auto get_allocator() const -> allocator_type;
+
+    void set_title(std::string_view title);
+    // std::nullopt clears the description
+    void set_description(std::optional<std::string_view> description);
+    void set_tags(Tags tags);
+    void set_tags(const std::vector<std::string> &tags);
+    void set_tags(std::initializer_list<std::string_view> tags);
     void set_repeat_rule(const std::optional<TaskRepeatRule> &rule);
 
     LINES_NODISCARD auto deadline() const -> const std::optional<Temporal::TimePoint> &;
 
-    LINES_NODISCARD auto title() const -> const std::string &;
-    LINES_NODISCARD auto description() const -> const std::optional<std::string> &;
-    LINES_NODISCARD auto tags() const -> const std::vector<std::string> &;
+    // Views into the task, info() reads the allocator-aware fields in place
+    LINES_NODISCARD auto title() const -> std::string_view;
+    LINES_NODISCARD auto description() const -> std::optional<std::string_view>;
+    // Copy of the tags, info().tags reads them in place
+    LINES_NODISCARD auto tags() const -> std::vector<std::string>;
+    LINES_NODISCARD auto repeat_rule() const -> const std::optional<TaskRepeatRule> &;
+    LINES_NODISCARD auto info() const -> const TaskInfo &;
 
     LINES_NODISCARD auto next_deadline(const Temporal::TimePoint &completed_at) const
         -> std::optional<Temporal::TimePoint>;
@@ -55,5 +90,13 @@ class LINES_API Task {
     void advance_deadline();
     void set_deadline(const std::optional<Temporal::TimePoint> &deadline);
     LINES_NODISCARD auto is_active(const Temporal::TimePoint &tp) const -> bool;
+
+    // Routes notifications of the mutating members to `observer` under `id`.
+    // Moved-from tasks hand the attachment over and copies start detached,
+    // see the assignment operators for assigning to an attached task.
+    void attach(TaskObserver &observer, TaskID id);
+    void detach();
+    LINES_NODISCARD auto attached() const -> bool;
+    LINES_NODISCARD auto id() const -> std::optional<TaskID>;
 };
 } // namespace Lines
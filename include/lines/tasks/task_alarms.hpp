@@ -0,0 +1,119 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/execution/timer.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_observer.hpp"
+#include "lines/temporal/timepoint.hpp"
+
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <vector>
+
+namespace Lines {
+class NextDueAwaitable;
+
+// Reports tracked tasks as their deadlines pass. Uncompleted tasks with a
+// deadline wait in a min-heap, the alarms keep one timer in the queue for
+// the earliest of them. Each task is reported once per deadline, either to
+// a coroutine waiting in next_due() or, while none waits, to take().
+//
+// The alarms and their tasks belong to the thread driving the timer queue,
+// usually an event loop calling run_due().
+class LINES_API TaskAlarms final : public TaskObserver, private Execution::TimerQueue::Timer {
+    struct Entry {
+        bool tracked = false;
+        bool armed = false; // has a current alarm in the heap
+        // Bumped whenever the alarm of the task changes, older heap and due
+        // entries are stale
+        std::uint32_t generation = 0;
+    };
+    struct Alarm {
+        Temporal::TimePoint deadline;
+        TaskID id;
+        std::uint32_t generation;
+    };
+
+    Execution::TimerQueue &_timers;
+    std::vector<Entry> _entries;
+    std::vector<Alarm> _heap; // min-heap, stale alarms are skipped
+    std::size_t _armed = 0;
+    std::deque<Alarm> _due;
+    std::deque<NextDueAwaitable *> _waiters;
+
+    friend class NextDueAwaitable;
+
+    void arm(TaskID id, const Task &task);
+    void retire(Entry &entry);
+    void rearm();
+    void fire() override;
+
+  public:
+    explicit TaskAlarms(Execution::TimerQueue &timers) : _timers(timers) {}
+    TaskAlarms(const TaskAlarms &) = delete;
+    TaskAlarms(TaskAlarms &&) = delete;
+    auto operator=(const TaskAlarms &) -> TaskAlarms & = delete;
+    auto operator=(TaskAlarms &&) -> TaskAlarms & = delete;
+    // Coroutines waiting in next_due() have to be finished or destroyed first
+    ~TaskAlarms() override;
+
+    // Watches `task` under `id` and attaches the alarms to it. Throws
+    // std::invalid_argument if `task` is already attached, share it through a
+    // TaskObserverList instead.
+    void track(Task &task, TaskID id);
+    // Stops watching `task` and detaches it
+    void untrack(Task &task);
+
+    // Throws std::invalid_argument if `id` is already watched
+    void insert(TaskID id, const Task &task);
+    void erase(TaskID id);
+
+    // Next task whose deadline passed and that nobody took yet
+    auto take() -> std::optional<TaskID>;
+
+    void on_deadline_changed(TaskID id, const Task &task,
+                             const std::optional<Temporal::TimePoint> &old_deadline) override;
+    void on_completion_changed(TaskID id, const Task &task) override;
+};
+
+// co_await next_due(alarms) resumes with the id of the next task whose
+// deadline passed. Waiting coroutines are served first come, first served.
+class LINES_API NextDueAwaitable {
+    TaskAlarms &_alarms;
+    std::optional<TaskID> _id;
+    std::coroutine_handle<> _handle;
+
+    friend class TaskAlarms;
+
+  public:
+    explicit NextDueAwaitable(TaskAlarms &alarms) : _alarms(alarms) {}
+    NextDueAwaitable(const NextDueAwaitable &) = delete;
+    NextDueAwaitable(NextDueAwaitable &&) = delete;
+    auto operator=(const NextDueAwaitable &) -> NextDueAwaitable & = delete;
+    auto operator=(NextDueAwaitable &&) -> NextDueAwaitable & = delete;
+    ~NextDueAwaitable();
+
+    auto await_ready() -> bool;
+    void await_suspend(std::coroutine_handle<> handle);
+    LINES_NODISCARD auto await_resume() const -> TaskID { return *_id; }
+};
+
+LINES_NODISCARD inline auto next_due(TaskAlarms &alarms) -> NextDueAwaitable {
+    return NextDueAwaitable{alarms};
+}
+} // namespace Lines
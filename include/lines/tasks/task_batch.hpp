@@ -0,0 +1,84 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/containers/bitset.hpp"
+#include "lines/detail/macro.h"
+#include "lines/execution/executor.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/temporal/timepoint.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+// Batch evaluation of task predicates over columns.
+// Deadlines are encoded as seconds since epoch, a missing deadline is stored as
+// NO_DEADLINE, which compares greater than any real deadline, so the kernels
+// need no branch for it.
+namespace Lines::Tasks {
+static LINES_CONSTEXPR std::int64_t NO_DEADLINE = std::numeric_limits<std::int64_t>::max();
+
+LINES_NODISCARD LINES_API auto encode_deadline(const std::optional<Temporal::TimePoint> &deadline)
+    -> std::int64_t;
+
+LINES_NODISCARD LINES_API auto decode_deadline(std::int64_t deadline)
+    -> std::optional<Temporal::TimePoint>;
+
+LINES_NODISCARD LINES_API auto deadline_column(std::span<const Task> tasks)
+    -> std::vector<std::int64_t>;
+
+LINES_NODISCARD LINES_API auto completion_bitset(std::span<const Task> tasks)
+    -> Containers::Bitset;
+
+// Bit i is set if deadlines[i] < tp. Entries without a deadline are never set.
+LINES_NODISCARD LINES_API auto deadline_passed(std::span<const std::int64_t> deadlines,
+                                               const Temporal::TimePoint &tp)
+    -> Containers::Bitset;
+
+// Column equivalent of Task::is_active: !completed && (no deadline || tp <= deadline)
+LINES_NODISCARD LINES_API auto is_active(std::span<const std::int64_t> deadlines,
+                                         const Containers::Bitset &completed,
+                                         const Temporal::TimePoint &tp) -> Containers::Bitset;
+
+// !completed && deadline < tp
+LINES_NODISCARD LINES_API auto is_overdue(std::span<const std::int64_t> deadlines,
+                                          const Containers::Bitset &completed,
+                                          const Temporal::TimePoint &tp) -> Containers::Bitset;
+
+// Gather path: deadlines are collected block by block, no full column is allocated.
+LINES_NODISCARD LINES_API auto is_active(std::span<const Task> tasks,
+                                         const Temporal::TimePoint &tp) -> Containers::Bitset;
+
+LINES_NODISCARD LINES_API auto is_overdue(std::span<const Task> tasks,
+                                          const Temporal::TimePoint &tp) -> Containers::Bitset;
+
+// Gather path split into blocks of words that run on `executor`
+LINES_NODISCARD LINES_API auto is_active(std::span<const Task> tasks, const Temporal::TimePoint &tp,
+                                         Execution::Executor &executor) -> Containers::Bitset;
+
+LINES_NODISCARD LINES_API auto is_overdue(std::span<const Task> tasks,
+                                          const Temporal::TimePoint &tp,
+                                          Execution::Executor &executor) -> Containers::Bitset;
+
+// Same result as calling advance_deadline(completed_at) on every task in order.
+// Chunks of tasks run on `executor`, each grouped by the kind of repeat rule.
+// Attached tasks are updated on the calling thread afterwards in index order,
+// so observers receive the notifications of the serial loop.
+// Weekday rules with no weekdays get no deadline, the serial loop never ends.
+LINES_API void advance_deadlines(std::span<Task> tasks, const Temporal::TimePoint &completed_at,
+                                 Execution::Executor &executor = Execution::default_executor());
+} // namespace Lines::Tasks
@@ -0,0 +1,110 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/containers/roaring.hpp"
+#include "lines/detail/macro.h"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_observer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Lines {
+// "Blocked by" relations between tasks, kept acyclic.
+//
+// Tasks carry a topological order that is maintained incrementally with the
+// algorithm of Pearce and Kelly ("A Dynamic Topological Sort Algorithm for
+// Directed Acyclic Graphs"): a dependency that already agrees with the order
+// costs O(1), otherwise only the tasks ordered between its two ends are
+// searched and reordered. A dependency closing a cycle is found by the same
+// search and rejected.
+//
+// The ready set, uncompleted tasks whose blockers are all completed, is
+// updated with every change instead of being searched for.
+class LINES_API TaskDependencyGraph : public TaskObserver {
+    struct Node {
+        bool present = false;
+        bool completed = false;
+        std::uint32_t open_blockers = 0; // blockers not completed yet
+        std::uint32_t mark = 0;          // search stamp
+        std::uint64_t order = 0;
+        std::vector<TaskID> blockers;
+        std::vector<TaskID> dependents;
+    };
+
+    std::vector<Node> _nodes;
+    Containers::RoaringBitmap _ready;
+    std::uint64_t _next_order = 0;
+    std::uint32_t _mark = 0;
+    std::size_t _size = 0;
+    std::size_t _edges = 0;
+
+    LINES_NODISCARD auto node(TaskID id) -> Node &;
+    LINES_NODISCARD auto node(TaskID id) const -> const Node &;
+    void update_ready(TaskID id);
+    // Moves the region between `blocker` and `blocked` so that blocker comes
+    // first, throws if blocked reaches blocker
+    void reorder(TaskID blocked, TaskID blocker);
+
+  public:
+    TaskDependencyGraph() = default;
+    TaskDependencyGraph(const TaskDependencyGraph &) = delete;
+    TaskDependencyGraph(TaskDependencyGraph &&) = delete;
+    auto operator=(const TaskDependencyGraph &) -> TaskDependencyGraph & = delete;
+    auto operator=(TaskDependencyGraph &&) -> TaskDependencyGraph & = delete;
+    ~TaskDependencyGraph() override = default;
+
+    // Adds `task` under `id` and attaches the graph to it, so that its
+    // completion updates the ready set. Throws std::invalid_argument if
+    // `task` is already attached, share it through a TaskObserverList instead.
+    void track(Task &task, TaskID id);
+    // Removes `task` with its dependencies and detaches it
+    void untrack(Task &task);
+
+    // Throws std::invalid_argument if `id` is already present. New tasks
+    // come last in the topological order.
+    void insert(TaskID id, bool completed = false);
+    // Removes the task and every dependency it takes part in
+    void erase(TaskID id);
+    void set_completed(TaskID id, bool completed);
+
+    // Makes `blocked` wait for `blocker`. Returns false if it already does.
+    // Throws std::out_of_range for absent tasks and std::invalid_argument if
+    // the dependency would close a cycle, the graph is left unchanged then.
+    auto add_dependency(TaskID blocked, TaskID blocker) -> bool;
+    // Returns false if there was no such dependency
+    auto remove_dependency(TaskID blocked, TaskID blocker) -> bool;
+
+    LINES_NODISCARD auto contains(TaskID id) const -> bool;
+    LINES_NODISCARD auto size() const -> std::size_t { return _size; }
+    LINES_NODISCARD auto dependency_count() const -> std::size_t { return _edges; }
+    LINES_NODISCARD auto blockers(TaskID id) const -> std::span<const TaskID>;
+    LINES_NODISCARD auto dependents(TaskID id) const -> std::span<const TaskID>;
+
+    // Uncompleted tasks none of whose blockers is uncompleted
+    LINES_NODISCARD auto ready() const -> const Containers::RoaringBitmap & { return _ready; }
+    LINES_NODISCARD auto is_ready(TaskID id) const -> bool { return _ready.contains(id); }
+
+    // True if `lhs` comes before `rhs` in the topological order, every
+    // blocker comes before the tasks it blocks
+    LINES_NODISCARD auto precedes(TaskID lhs, TaskID rhs) const -> bool;
+    // Every task, blockers before the tasks they block
+    LINES_NODISCARD auto topological_order() const -> std::vector<TaskID>;
+
+    void on_completion_changed(TaskID id, const Task &task) override;
+};
+} // namespace Lines
@@ -14,29 +14,58 @@
 #pragma once
 
 #include "lines/detail/macro.h"
+#include "lines/detail/memory.hpp"
 
+#include <initializer_list>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Lines {
 struct LINES_API TaskInfo {
+    using allocator_type = Allocator;
+
     TaskInfo() = default;
+    explicit TaskInfo(const allocator_type &alloc) : title(alloc), tags(alloc) {}
     TaskInfo(const TaskInfo &) = default; // LCOV_EXCL_LINE
     TaskInfo(TaskInfo &&) = default;
+    TaskInfo(std::allocator_arg_t /*tag*/, const allocator_type &alloc, const TaskInfo &other)
+        : title(other.title, alloc),
+          description(detail::copy_optional_string(other.description, alloc)),
+          tags(other.tags, alloc) {}
+    TaskInfo(std::allocator_arg_t /*tag*/, const allocator_type &alloc, TaskInfo &&other)
+        : title(std::move(other.title), alloc),
+          description(detail::move_optional_string(std::move(other.description), alloc)),
+          tags(std::move(other.tags), alloc) {}
     auto operator=(const TaskInfo &) -> TaskInfo & = default;
     auto operator=(TaskInfo &&) -> TaskInfo & = default;
-    explicit TaskInfo(std::string title, std::optional<std::string> desc = std::nullopt,
-                      std::vector<std::string> tags = {})
-        : title(std::move(title)), description(std::move(desc)), tags(std::move(tags)) {
+    explicit TaskInfo(std::string_view title, std::optional<std::string_view> desc = std::nullopt,
+                      std::initializer_list<std::string_view> tags = {})
+        : TaskInfo(std::allocator_arg, allocator_type{}, title, desc, tags) {}
+    // Tags held in a std::vector, as before the allocator-aware layout
+    TaskInfo(std::string_view title, std::optional<std::string_view> desc,
+             const std::vector<std::string> &tags)
+        : TaskInfo(title, desc) {
+        this->tags = detail::make_tags(tags, get_allocator());
+    }
+    TaskInfo(std::allocator_arg_t /*tag*/, const allocator_type &alloc, std::string_view title,
+             std::optional<std::string_view> desc = std::nullopt,
+             std::initializer_list<std::string_view> tags = {})
+        : title(title, alloc), description(detail::make_optional_string(desc, alloc)),
+          tags(detail::make_tags(tags, alloc)) {
         if (this->title.empty()) {
             throw std::invalid_argument("TaskInfo: title must not be empty"); // LCOV_EXCL_LINE
         }
     }
     ~TaskInfo() = default;
-    std::string title;
-    std::optional<std::string> description;
-    std::vector<std::string> tags;
+
+    LINES_NODISCARD auto get_allocator() const -> allocator_type { return title.get_allocator(); }
+
+    std::pmr::string title;
+    std::optional<std::pmr::string> description;
+    Tags tags;
 };
 } // namespace Lines
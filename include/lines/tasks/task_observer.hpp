@@ -0,0 +1,114 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/detail/memory.hpp"
+#include "lines/detail/observer_hook.hpp"
+#include "lines/temporal/timepoint.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Lines {
+class Task;
+
+// Identifier a task is attached under. Ids are chosen by whoever owns the
+// task collection, usually the position of the task in it.
+using TaskID = std::uint32_t;
+
+// Receives notifications from the mutating members of an attached Task.
+// Every callback is invoked after the change has been applied, `task` is the
+// updated task and the `old_*` arguments hold the replaced values.
+class LINES_API TaskObserver {
+  public:
+    TaskObserver() = default;
+    TaskObserver(const TaskObserver &) = default;
+    TaskObserver(TaskObserver &&) = default;
+    auto operator=(const TaskObserver &) -> TaskObserver & = default;
+    auto operator=(TaskObserver &&) -> TaskObserver & = default;
+    virtual ~TaskObserver() = default;
+
+    virtual void on_title_changed(TaskID /*id*/, const Task & /*task*/,
+                                  const std::pmr::string & /*old_title*/) {}
+    virtual void on_description_changed(
+        TaskID /*id*/, const Task & /*task*/,
+        const std::optional<std::pmr::string> & /*old_description*/) {}
+    virtual void on_tags_changed(TaskID /*id*/, const Task & /*task*/, const Tags & /*old_tags*/) {
+    }
+    virtual void on_deadline_changed(TaskID /*id*/, const Task & /*task*/,
+                                     const std::optional<Temporal::TimePoint> & /*old_deadline*/) {
+    }
+    virtual void on_completion_changed(TaskID /*id*/, const Task & /*task*/) {}
+    virtual void on_repeat_rule_changed(TaskID /*id*/, const Task & /*task*/) {}
+};
+
+// Fans notifications out to several observers, so one task can feed
+// multiple indexes at once.
+class LINES_API TaskObserverList final : public TaskObserver {
+    std::vector<TaskObserver *> _observers;
+
+  public:
+    void add(TaskObserver &observer) { _observers.push_back(&observer); }
+
+    void remove(TaskObserver &observer) { std::erase(_observers, &observer); }
+
+    LINES_NODISCARD auto size() const -> std::size_t { return _observers.size(); }
+
+    void on_title_changed(TaskID id, const Task &task, const std::pmr::string &old_title) override {
+        for (auto *observer : _observers) {
+            observer->on_title_changed(id, task, old_title);
+        }
+    }
+
+    void on_description_changed(TaskID id, const Task &task,
+                                const std::optional<std::pmr::string> &old_description) override {
+        for (auto *observer : _observers) {
+            observer->on_description_changed(id, task, old_description);
+        }
+    }
+
+    void on_tags_changed(TaskID id, const Task &task, const Tags &old_tags) override {
+        for (auto *observer : _observers) {
+            observer->on_tags_changed(id, task, old_tags);
+        }
+    }
+
+    void on_deadline_changed(TaskID id, const Task &task,
+                             const std::optional<Temporal::TimePoint> &old_deadline) override {
+        for (auto *observer : _observers) {
+            observer->on_deadline_changed(id, task, old_deadline);
+        }
+    }
+
+    void on_completion_changed(TaskID id, const Task &task) override {
+        for (auto *observer : _observers) {
+            observer->on_completion_changed(id, task);
+        }
+    }
+
+    void on_repeat_rule_changed(TaskID id, const Task &task) override {
+        for (auto *observer : _observers) {
+            observer->on_repeat_rule_changed(id, task);
+        }
+    }
+};
+
+namespace detail {
+using TaskHook = ObserverHook<TaskObserver, TaskID>;
+} // namespace detail
+} // namespace Lines
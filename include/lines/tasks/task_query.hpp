@@ -0,0 +1,231 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/containers/roaring.hpp"
+#include "lines/detail/macro.h"
+#include "lines/execution/executor.hpp"
+#include "lines/tasks/tag_index.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_observer.hpp"
+#include "lines/temporal/timepoint.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Lines {
+// Boolean expression over task properties. Like TagQuery, `~predicate` is
+// taken relative to all tasks the predicate is evaluated against.
+class LINES_API TaskPredicate {
+  public:
+    enum class Op : std::uint8_t {
+        All,
+        Tag,
+        Completed,
+        Repeating,
+        HasDeadline,
+        DeadlineIn,
+        TitlePrefix,
+        And,
+        Or,
+        Not
+    };
+
+  private:
+    Op _op;
+    std::string _text; // tag or title prefix
+    std::optional<Temporal::TimePoint> _from;
+    std::optional<Temporal::TimePoint> _to;
+    std::vector<TaskPredicate> _operands;
+
+    TaskPredicate(Op op, std::vector<TaskPredicate> operands)
+        : _op(op), _operands(std::move(operands)) {}
+
+  public:
+    LINES_NODISCARD static auto all() -> TaskPredicate { return TaskPredicate{Op::All, {}}; }
+    LINES_NODISCARD static auto tag(std::string tag) -> TaskPredicate;
+    LINES_NODISCARD static auto completed() -> TaskPredicate {
+        return TaskPredicate{Op::Completed, {}};
+    }
+    LINES_NODISCARD static auto repeating() -> TaskPredicate {
+        return TaskPredicate{Op::Repeating, {}};
+    }
+    LINES_NODISCARD static auto has_deadline() -> TaskPredicate {
+        return TaskPredicate{Op::HasDeadline, {}};
+    }
+    // Deadline in [from, to), a missing bound is open. Tasks without a
+    // deadline never match.
+    LINES_NODISCARD static auto deadline_in(std::optional<Temporal::TimePoint> from,
+                                            std::optional<Temporal::TimePoint> to)
+        -> TaskPredicate;
+    // Case sensitive
+    LINES_NODISCARD static auto title_prefix(std::string prefix) -> TaskPredicate;
+
+    LINES_NODISCARD static auto all_of(std::vector<TaskPredicate> operands) -> TaskPredicate {
+        return TaskPredicate{Op::And, std::move(operands)};
+    }
+    LINES_NODISCARD static auto any_of(std::vector<TaskPredicate> operands) -> TaskPredicate {
+        return TaskPredicate{Op::Or, std::move(operands)};
+    }
+
+    // Chains like `a & b & c` build one flat conjunction, which the planner
+    // can order as a whole
+    LINES_NODISCARD friend auto operator&(TaskPredicate lhs, TaskPredicate rhs) -> TaskPredicate {
+        if (lhs._op == Op::And) {
+            lhs._operands.push_back(std::move(rhs));
+            return lhs;
+        }
+        return all_of({std::move(lhs), std::move(rhs)});
+    }
+    LINES_NODISCARD friend auto operator|(TaskPredicate lhs, TaskPredicate rhs) -> TaskPredicate {
+        if (lhs._op == Op::Or) {
+            lhs._operands.push_back(std::move(rhs));
+            return lhs;
+        }
+        return any_of({std::move(lhs), std::move(rhs)});
+    }
+    LINES_NODISCARD friend auto operator~(TaskPredicate predicate) -> TaskPredicate {
+        return TaskPredicate{Op::Not, {std::move(predicate)}};
+    }
+
+    LINES_NODISCARD auto op() const -> Op { return _op; }
+    LINES_NODISCARD auto text() const -> const std::string & { return _text; }
+    LINES_NODISCARD auto from() const -> const std::optional<Temporal::TimePoint> & {
+        return _from;
+    }
+    LINES_NODISCARD auto to() const -> const std::optional<Temporal::TimePoint> & { return _to; }
+    LINES_NODISCARD auto operands() const -> const std::vector<TaskPredicate> & {
+        return _operands;
+    }
+
+    // Evaluates the predicate on a single task, without any index
+    LINES_NODISCARD auto matches(const Task &task) const -> bool;
+};
+
+enum class TaskOrder : std::uint8_t {
+    Id,
+    // Earliest deadline first, tasks without a deadline last, ties by id
+    Deadline
+};
+
+struct LINES_API TaskQuery {
+    static LINES_CONSTEXPR std::size_t NO_LIMIT = std::numeric_limits<std::size_t>::max();
+
+    TaskPredicate where = TaskPredicate::all();
+    TaskOrder order = TaskOrder::Id;
+    std::size_t offset = 0;
+    std::size_t limit = NO_LIMIT;
+};
+
+// Indexes over tracked tasks that TaskQuery is planned against: tag
+// postings, bitmaps of completed, repeating and dated tasks, and ordered
+// indexes over deadlines and titles.
+//
+// A conjunction starts from its most selective operand, estimated from
+// bitmap cardinalities and bounded walks of the ordered indexes, and narrows
+// it down operand by operand. An operand is intersected (or, when negated,
+// subtracted) as a bitmap while that is cheaper than checking it on the
+// remaining candidates; once few candidates are left the rest is scanned.
+// Ordering by deadline either walks the deadline index until the page is
+// filled or keeps a bounded heap over the matches, whichever visits less.
+class LINES_API TaskQueryIndex : public TaskObserver {
+    using Bitmap = Containers::RoaringBitmap;
+    using Titles = std::set<std::pair<std::string, TaskID>>;
+    using Deadlines = std::set<std::pair<Temporal::TimePoint, TaskID>>;
+
+    struct Entry {
+        bool tracked = false;
+        std::optional<Temporal::TimePoint> deadline;
+        Titles::const_iterator title;
+    };
+
+    class Explain;
+
+    TagIndex _tags;
+    Bitmap _completed;
+    Bitmap _repeating;
+    Bitmap _dated;
+    Titles _titles;
+    Deadlines _deadlines;
+    std::vector<Entry> _entries;
+
+    // nullptr for ids that are not indexed
+    LINES_NODISCARD auto entry(TaskID id) -> Entry *;
+    LINES_NODISCARD auto entry(TaskID id) const -> const Entry *;
+    void set_deadline(TaskID id, Entry &entry, const std::optional<Temporal::TimePoint> &deadline);
+    // Everything but the tags
+    void add_entry(TaskID id, const Task &task);
+
+    LINES_NODISCARD auto estimate(const TaskPredicate &predicate, std::size_t cap) const
+        -> std::size_t;
+    LINES_NODISCARD auto test(const TaskPredicate &predicate, TaskID id) const -> bool;
+    auto lookup(const TaskPredicate &predicate, Explain *explain, std::size_t depth,
+                std::string &method) const -> Bitmap;
+    auto conjunction(const TaskPredicate &predicate, Explain *explain, std::size_t depth,
+                     std::string &method) const -> Bitmap;
+    auto execute(const TaskQuery &query, Explain *explain) const -> std::vector<TaskID>;
+    auto by_deadline(const Bitmap &matches, std::size_t count, Explain *explain) const
+        -> std::vector<TaskID>;
+
+  public:
+    TaskQueryIndex() = default;
+    TaskQueryIndex(const TaskQueryIndex &) = delete;
+    TaskQueryIndex(TaskQueryIndex &&) = delete;
+    auto operator=(const TaskQueryIndex &) -> TaskQueryIndex & = delete;
+    auto operator=(TaskQueryIndex &&) -> TaskQueryIndex & = delete;
+    ~TaskQueryIndex() override = default;
+
+    // Indexes `task` under `id` and attaches the index to it. Throws
+    // std::invalid_argument if `task` is already attached, share it through a
+    // TaskObserverList instead.
+    void track(Task &task, TaskID id);
+    // Removes `task` from the index and detaches it
+    void untrack(Task &task);
+
+    // Throws std::invalid_argument if `id` is already indexed
+    void insert(TaskID id, const Task &task);
+    // Indexes tasks[i] under first + i, the tag postings are built on
+    // `executor` (see TagIndex::insert). Throws std::invalid_argument, with
+    // nothing indexed, if one of the ids is already indexed.
+    void insert(TaskID first, std::span<const Task> tasks,
+                Execution::Executor &executor = Execution::default_executor());
+    // `task` is the indexed task, its tags locate the postings to update
+    void erase(TaskID id, const Task &task);
+
+    LINES_NODISCARD auto size() const -> std::size_t { return _titles.size(); }
+    LINES_NODISCARD auto tags() const -> const TagIndex & { return _tags; }
+
+    // Ids of the tasks matching `predicate`
+    LINES_NODISCARD auto select(const TaskPredicate &predicate) const -> Containers::RoaringBitmap;
+    // Ids of the matching tasks in query order, paged by offset and limit
+    LINES_NODISCARD auto run(const TaskQuery &query) const -> std::vector<TaskID>;
+    // Runs `query` and describes how: one line per plan step with the access
+    // path taken and the number of candidates left after it
+    LINES_NODISCARD auto explain(const TaskQuery &query) const -> std::string;
+
+    void on_title_changed(TaskID id, const Task &task, const std::pmr::string &old_title) override;
+    void on_tags_changed(TaskID id, const Task &task, const Tags &old_tags) override;
+    void on_deadline_changed(TaskID id, const Task &task,
+                             const std::optional<Temporal::TimePoint> &old_deadline) override;
+    void on_completion_changed(TaskID id, const Task &task) override;
+    void on_repeat_rule_changed(TaskID id, const Task &task) override;
+};
+} // namespace Lines
@@ -14,22 +14,26 @@
 #pragma once
 
 #include "lines/detail/macro.h"
+#include "lines/detail/memory.hpp"
 #include "lines/temporal/date.hpp"
 #include "lines/temporal/datetime.hpp"
 #include "lines/temporal/timepoint.hpp"
 
+#include <algorithm>
 #include <optional>
+#include <string>
 #include <variant>
+#include <vector>
 
 namespace Lines {
 namespace TaskRepeat {
 struct LINES_API EveryUnit {
     Temporal::Seconds interval;
-    std::string unit_str;
+    std::pmr::string unit_str;
 };
 
 struct LINES_API EveryWeekday {
-    std::vector<Temporal::Weekday> weekdays;
+    std::pmr::vector<Temporal::Weekday> weekdays;
 };
 } // namespace TaskRepeat
 
@@ -38,6 +42,26 @@ struct LINES_API TaskRepeatRule {
     RepeatType repeat_type;
     std::optional<Temporal::TimePoint> end;
 
+    // Copy of the rule whose storage comes from `alloc`
+    LINES_NODISCARD auto copy(const Allocator &alloc) const -> TaskRepeatRule {
+        return TaskRepeatRule{
+            .repeat_type = std::visit(
+                [&](const auto &v) -> RepeatType {
+                    using T = std::decay_t<decltype(v)>;
+                    LINES_CONSTEXPR_IF(std::is_same_v<T, TaskRepeat::EveryUnit>) {
+                        return TaskRepeat::EveryUnit{
+                            .interval = v.interval,
+                            .unit_str = std::pmr::string(v.unit_str, alloc)};
+                    }
+                    else {
+                        return TaskRepeat::EveryWeekday{
+                            .weekdays = std::pmr::vector<Temporal::Weekday>(v.weekdays, alloc)};
+                    }
+                },
+                repeat_type),
+            .end = end};
+    }
+
     LINES_NODISCARD auto next_deadline(const Temporal::TimePoint &completed_at) const
         -> std::optional<Temporal::TimePoint> {
         return std::visit(
@@ -0,0 +1,72 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/tasks/task.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+// Orderings of task collections. Results are permutations: position k holds
+// the index into `tasks` of the k-th task in order. Functions taking a
+// permutation reorder it in place and may be given any subset of indices.
+//
+// Deadlines are sorted as the seconds encoding of task_batch.hpp with an LSD
+// radix sort, a missing deadline encodes as the greatest key and so sorts
+// last. Every sort here is stable.
+namespace Lines::Tasks {
+enum class SortKey : std::uint8_t {
+    Deadline,  // earliest first, no deadline last
+    Completed, // uncompleted first
+    Title      // byte-wise
+};
+
+// Identity permutation of `tasks`. Throws std::length_error for more tasks
+// than a std::uint32_t can index.
+LINES_NODISCARD LINES_API auto identity_permutation(std::span<const Task> tasks)
+    -> std::vector<std::uint32_t>;
+
+LINES_NODISCARD LINES_API auto sort_by_deadline(std::span<const Task> tasks)
+    -> std::vector<std::uint32_t>;
+LINES_API void sort_by_deadline(std::span<std::uint32_t> permutation,
+                                std::span<const Task> tasks);
+// Reorders the tasks themselves, attachments move along with them
+LINES_API void sort_by_deadline(std::span<Task> tasks);
+
+// Sorts by the first key, ties by the second and so on. The whole range is
+// sorted by the first key only, each run of tasks tied on it is then sorted
+// by the remaining keys, so titles are rarely compared when deadlines differ.
+LINES_API void sort_by(std::span<std::uint32_t> permutation, std::span<const Task> tasks,
+                       std::span<const SortKey> keys);
+LINES_API void sort_by(std::span<std::uint32_t> permutation, std::span<const Task> tasks,
+                       std::initializer_list<SortKey> keys = {SortKey::Deadline,
+                                                              SortKey::Completed, SortKey::Title});
+
+// The `k` tasks with the earliest deadlines in deadline order, ties in input
+// order. Keeps a heap of k entries, O(n log k) instead of sorting everything.
+LINES_NODISCARD LINES_API auto top_by_deadline(std::span<const Task> tasks, std::size_t k)
+    -> std::vector<std::uint32_t>;
+LINES_NODISCARD LINES_API auto top_by_deadline(std::span<const std::uint32_t> permutation,
+                                               std::span<const Task> tasks, std::size_t k)
+    -> std::vector<std::uint32_t>;
+
+// Moves tasks[permutation[k]] to position k. Throws std::invalid_argument unless
+// `permutation` holds every index of `tasks` exactly once.
+LINES_API void apply_permutation(std::span<Task> tasks,
+                                 std::span<const std::uint32_t> permutation);
+} // namespace Lines::Tasks
@@ -0,0 +1,131 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#pragma once
+
+#include "lines/detail/macro.h"
+#include "lines/tasks/tag_index.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_observer.hpp"
+#include "lines/temporal/timepoint.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Lines {
+// Number of tasks by status. Every task is exactly one of completed, active
+// or overdue, with the meaning of Task::is_active() at the current time.
+struct LINES_API TaskCounts {
+    std::size_t total = 0;
+    std::size_t completed = 0;
+    std::size_t active = 0;
+    std::size_t overdue = 0;
+
+    auto operator==(const TaskCounts &) const -> bool = default;
+};
+
+// Counters over a set of tasks, kept current by the notifications of the
+// tracked tasks instead of being recomputed. A mutation costs O(1) plus the
+// number of tags of the task, arming a deadline costs O(log n).
+//
+// Time only moves through advance_to(): uncompleted tasks with a deadline
+// wait in a min-heap ordered by deadline, and advancing pops the ones that
+// fell behind, so going overdue is paid once per task rather than by a scan.
+// Moving the clock backwards reclassifies everything.
+//
+// Mutations and the per-tag reads belong to one thread. snapshot() may be
+// called from any thread and never blocks the writer.
+class LINES_API TaskStatistics final : public TaskObserver {
+    enum class Status : std::uint8_t { Completed, Active, Overdue };
+
+    struct Entry {
+        bool tracked = false;
+        Status status = Status::Active;
+        // Bumped on every (dis)arming, heap entries of older generations are stale
+        std::uint32_t generation = 0;
+        std::optional<Temporal::TimePoint> deadline;
+        std::vector<TagId> tags;
+    };
+
+    struct Due {
+        Temporal::TimePoint deadline;
+        TaskID id;
+        std::uint32_t generation;
+    };
+
+    Temporal::TimePoint _now;
+    TaskCounts _counts;
+    TagInterner _interner;
+    std::vector<TaskCounts> _tag_counts;
+    std::vector<Entry> _entries;
+    std::vector<Due> _cursor; // min-heap of armed deadlines, stale entries are skipped
+    std::size_t _armed = 0;
+
+    // Seqlock over the published copy of _counts
+    std::atomic<std::uint64_t> _sequence{0};
+    std::array<std::atomic<std::size_t>, 4> _published{};
+
+    LINES_NODISCARD auto status_of(bool completed,
+                                   const std::optional<Temporal::TimePoint> &deadline) const
+        -> Status;
+    void count(const Entry &entry, bool add);
+    void set_status(Entry &entry, Status status);
+    void set_tags(Entry &entry, const Tags &tags);
+    void arm(TaskID id, Entry &entry);
+    void disarm(Entry &entry);
+    void rebuild_cursor();
+    void refresh(TaskID id, const Task &task);
+    void publish();
+
+  public:
+    explicit TaskStatistics(const Temporal::TimePoint &now);
+    TaskStatistics(const TaskStatistics &) = delete;
+    TaskStatistics(TaskStatistics &&) = delete;
+    auto operator=(const TaskStatistics &) -> TaskStatistics & = delete;
+    auto operator=(TaskStatistics &&) -> TaskStatistics & = delete;
+    ~TaskStatistics() override = default;
+
+    // Counts `task` under `id` and attaches the statistics to it. Throws
+    // std::invalid_argument if `task` is already attached, share it through a
+    // TaskObserverList instead.
+    void track(Task &task, TaskID id);
+    // Stops counting `task` and detaches it
+    void untrack(Task &task);
+
+    // Throws std::invalid_argument if `id` is already counted
+    void insert(TaskID id, const Task &task);
+    void erase(TaskID id);
+
+    // Moves the clock to `now`, returns the number of tasks that went overdue
+    auto advance_to(const Temporal::TimePoint &now) -> std::size_t;
+    LINES_NODISCARD auto now() const -> const Temporal::TimePoint & { return _now; }
+
+    LINES_NODISCARD auto counts() const -> const TaskCounts & { return _counts; }
+    LINES_NODISCARD auto counts(std::string_view tag) const -> TaskCounts;
+    LINES_NODISCARD auto counts(TagId tag) const -> TaskCounts;
+    LINES_NODISCARD auto interner() const -> const TagInterner & { return _interner; }
+
+    // Consistent copy of counts() as of the last completed mutation
+    LINES_NODISCARD auto snapshot() const -> TaskCounts;
+
+    void on_tags_changed(TaskID id, const Task &task, const Tags &old_tags) override;
+    void on_deadline_changed(TaskID id, const Task &task,
+                             const std::optional<Temporal::TimePoint> &old_deadline) override;
+    void on_completion_changed(TaskID id, const Task &task) override;
+};
+} // namespace Lines
@@ -0,0 +1,317 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/containers/roaring.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+using Container = Lines::Containers::RoaringBitmap::Container;
+
+auto word_of(std::uint16_t low) -> std::size_t { return low / 64U; }
+
+auto bit_of(std::uint16_t low) -> std::uint64_t { return std::uint64_t{1} << (low % 64U); }
+} // namespace
+
+// Container
+
+void Container::to_bitmap() {
+    _bitmap.assign(BITMAP_WORDS, 0);
+    for (const std::uint16_t low : _array) {
+        _bitmap[word_of(low)] |= bit_of(low);
+    }
+    _array.clear();
+    _array.shrink_to_fit();
+}
+
+void Container::to_array() {
+    std::vector<std::uint16_t> array;
+    array.reserve(_cardinality);
+    for_each([&](std::uint16_t low) { array.push_back(low); });
+    _array = std::move(array);
+    _bitmap.clear();
+    _bitmap.shrink_to_fit();
+}
+
+void Container::normalize() {
+    if (is_bitmap()) {
+        std::uint32_t cardinality = 0;
+        for (const std::uint64_t word : _bitmap) {
+            cardinality += static_cast<std::uint32_t>(std::popcount(word));
+        }
+        _cardinality = cardinality;
+        if (_cardinality <= ARRAY_LIMIT) {
+            to_array();
+        }
+    } else {
+        _cardinality = static_cast<std::uint32_t>(_array.size());
+        if (_cardinality > ARRAY_LIMIT) {
+            to_bitmap();
+        }
+    }
+}
+
+auto Container::contains(std::uint16_t low) const -> bool {
+    if (is_bitmap()) {
+        return (_bitmap[word_of(low)] & bit_of(low)) != 0;
+    }
+    return std::ranges::binary_search(_array, low);
+}
+
+auto Container::add(std::uint16_t low) -> bool {
+    if (is_bitmap()) {
+        std::uint64_t &word = _bitmap[word_of(low)];
+        if ((word & bit_of(low)) != 0) {
+            return false;
+        }
+        word |= bit_of(low);
+        ++_cardinality;
+        return true;
+    }
+    const auto it = std::ranges::lower_bound(_array, low);
+    if (it != _array.end() && *it == low) {
+        return false;
+    }
+    _array.insert(it, low);
+    ++_cardinality;
+    if (_cardinality > ARRAY_LIMIT) {
+        to_bitmap();
+    }
+    return true;
+}
+
+auto Container::remove(std::uint16_t low) -> bool {
+    if (is_bitmap()) {
+        std::uint64_t &word = _bitmap[word_of(low)];
+        if ((word & bit_of(low)) == 0) {
+            return false;
+        }
+        word &= ~bit_of(low);
+        if (--_cardinality <= ARRAY_LIMIT) {
+            to_array();
+        }
+        return true;
+    }
+    const auto it = std::ranges::lower_bound(_array, low);
+    if (it == _array.end() || *it != low) {
+        return false;
+    }
+    _array.erase(it);
+    --_cardinality;
+    return true;
+}
+
+auto Container::intersect(const Container &lhs, const Container &rhs) -> Container {
+    Container result;
+    if (lhs.is_bitmap() && rhs.is_bitmap()) {
+        result._bitmap.resize(BITMAP_WORDS);
+        for (std::size_t i = 0; i < BITMAP_WORDS; ++i) {
+            result._bitmap[i] = lhs._bitmap[i] & rhs._bitmap[i];
+        }
+    } else if (lhs.is_bitmap() || rhs.is_bitmap()) {
+        const Container &array = lhs.is_bitmap() ? rhs : lhs;
+        const Container &bitmap = lhs.is_bitmap() ? lhs : rhs;
+        std::ranges::copy_if(array._array, std::back_inserter(result._array),
+                             [&](std::uint16_t low) { return bitmap.contains(low); });
+    } else {
+        std::ranges::set_intersection(lhs._array, rhs._array, std::back_inserter(result._array));
+    }
+    result.normalize();
+    return result;
+}
+
+auto Container::unite(const Container &lhs, const Container &rhs) -> Container {
+    Container result;
+    if (lhs.is_bitmap() || rhs.is_bitmap()) {
+        const Container &bitmap = lhs.is_bitmap() ? lhs : rhs;
+        const Container &other = lhs.is_bitmap() ? rhs : lhs;
+        result._bitmap = bitmap._bitmap;
+        if (other.is_bitmap()) {
+            for (std::size_t i = 0; i < BITMAP_WORDS; ++i) {
+                result._bitmap[i] |= other._bitmap[i];
+            }
+        } else {
+            for (const std::uint16_t low : other._array) {
+                result._bitmap[word_of(low)] |= bit_of(low);
+            }
+        }
+    } else {
+        result._array.reserve(lhs._array.size() + rhs._array.size());
+        std::ranges::set_union(lhs._array, rhs._array, std::back_inserter(result._array));
+    }
+    result.normalize();
+    return result;
+}
+
+auto Container::subtract(const Container &lhs, const Container &rhs) -> Container {
+    Container result;
+    if (lhs.is_bitmap()) {
+        result._bitmap = lhs._bitmap;
+        if (rhs.is_bitmap()) {
+            for (std::size_t i = 0; i < BITMAP_WORDS; ++i) {
+                result._bitmap[i] &= ~rhs._bitmap[i];
+            }
+        } else {
+            for (const std::uint16_t low : rhs._array) {
+                result._bitmap[word_of(low)] &= ~bit_of(low);
+            }
+        }
+    } else if (rhs.is_bitmap()) {
+        std::ranges::copy_if(lhs._array, std::back_inserter(result._array),
+                             [&](std::uint16_t low) { return !rhs.contains(low); });
+    } else {
+        std::ranges::set_difference(lhs._array, rhs._array, std::back_inserter(result._array));
+    }
+    result.normalize();
+    return result;
+}
+
+// RoaringBitmap
+
+Lines::Containers::RoaringBitmap::RoaringBitmap(std::initializer_list<Value> values) {
+    for (const Value value : values) {
+        add(value);
+    }
+}
+
+auto Lines::Containers::RoaringBitmap::find(std::uint16_t key) const -> std::size_t {
+    return static_cast<std::size_t>(std::ranges::lower_bound(_keys, key) - _keys.begin());
+}
+
+auto Lines::Containers::RoaringBitmap::add(Value value) -> bool {
+    const auto key = static_cast<std::uint16_t>(value >> 16U);
+    const auto low = static_cast<std::uint16_t>(value & 0xFFFFU);
+    const std::size_t pos = find(key);
+    if (pos == _keys.size() || _keys[pos] != key) {
+        _keys.insert(_keys.begin() + static_cast<std::ptrdiff_t>(pos), key);
+        _containers.insert(_containers.begin() + static_cast<std::ptrdiff_t>(pos), Container{});
+    }
+    return _containers[pos].add(low);
+}
+
+auto Lines::Containers::RoaringBitmap::remove(Value value) -> bool {
+    const auto key = static_cast<std::uint16_t>(value >> 16U);
+    const std::size_t pos = find(key);
+    if (pos == _keys.size() || _keys[pos] != key) {
+        return false;
+    }
+    if (!_containers[pos].remove(static_cast<std::uint16_t>(value & 0xFFFFU))) {
+        return false;
+    }
+    if (_containers[pos].cardinality() == 0) {
+        _keys.erase(_keys.begin() + static_cast<std::ptrdiff_t>(pos));
+        _containers.erase(_containers.begin() + static_cast<std::ptrdiff_t>(pos));
+    }
+    return true;
+}
+
+auto Lines::Containers::RoaringBitmap::contains(Value value) const -> bool {
+    const auto key = static_cast<std::uint16_t>(value >> 16U);
+    const std::size_t pos = find(key);
+    return pos != _keys.size() && _keys[pos] == key &&
+           _containers[pos].contains(static_cast<std::uint16_t>(value & 0xFFFFU));
+}
+
+auto Lines::Containers::RoaringBitmap::cardinality() const -> std::size_t {
+    std::size_t total = 0;
+    for (const Container &container : _containers) {
+        total += container.cardinality();
+    }
+    return total;
+}
+
+void Lines::Containers::RoaringBitmap::clear() {
+    _keys.clear();
+    _containers.clear();
+}
+
+auto Lines::Containers::RoaringBitmap::to_vector() const -> std::vector<Value> {
+    std::vector<Value> values;
+    values.reserve(cardinality());
+    for_each([&](Value value) { values.push_back(value); });
+    return values;
+}
+
+auto Lines::Containers::RoaringBitmap::operator&=(const RoaringBitmap &other) -> RoaringBitmap & {
+    std::vector<std::uint16_t> keys;
+    std::vector<Container> containers;
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < _keys.size() && j < other._keys.size()) {
+        if (_keys[i] < other._keys[j]) {
+            ++i;
+        } else if (other._keys[j] < _keys[i]) {
+            ++j;
+        } else {
+            Container container = Container::intersect(_containers[i], other._containers[j]);
+            if (container.cardinality() != 0) {
+                keys.push_back(_keys[i]);
+                containers.push_back(std::move(container));
+            }
+            ++i;
+            ++j;
+        }
+    }
+    _keys = std::move(keys);
+    _containers = std::move(containers);
+    return *this;
+}
+
+auto Lines::Containers::RoaringBitmap::operator|=(const RoaringBitmap &other) -> RoaringBitmap & {
+    std::vector<std::uint16_t> keys;
+    std::vector<Container> containers;
+    keys.reserve(_keys.size() + other._keys.size());
+    containers.reserve(_keys.size() + other._keys.size());
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < _keys.size() || j < other._keys.size()) {
+        if (j == other._keys.size() || (i < _keys.size() && _keys[i] < other._keys[j])) {
+            keys.push_back(_keys[i]);
+            containers.push_back(std::move(_containers[i++]));
+        } else if (i == _keys.size() || other._keys[j] < _keys[i]) {
+            keys.push_back(other._keys[j]);
+            containers.push_back(other._containers[j++]);
+        } else {
+            keys.push_back(_keys[i]);
+            containers.push_back(Container::unite(_containers[i++], other._containers[j++]));
+        }
+    }
+    _keys = std::move(keys);
+    _containers = std::move(containers);
+    return *this;
+}
+
+auto Lines::Containers::RoaringBitmap::operator-=(const RoaringBitmap &other) -> RoaringBitmap & {
+    std::size_t out = 0;
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < _keys.size(); ++i) {
+        while (j < other._keys.size() && other._keys[j] < _keys[i]) {
+            ++j;
+        }
+        if (j < other._keys.size() && other._keys[j] == _keys[i]) {
+            _containers[i] = Container::subtract(_containers[i], other._containers[j]);
+            if (_containers[i].cardinality() == 0) {
+                continue;
+            }
+        }
+        if (out != i) {
+            _keys[out] = _keys[i];
+            _containers[out] = std::move(_containers[i]);
+        }
+        ++out;
+    }
+    _keys.resize(out);
+    _containers.resize(out);
+    return *this;
+}
@@ -0,0 +1,39 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/execution/executor.hpp"
+#include "lines/execution/work_stealing.hpp"
+
+#include <atomic>
+
+namespace {
+std::atomic<Lines::Execution::Executor *> installed{nullptr};
+} // namespace
+
+void Lines::Execution::InlineExecutor::bulk(std::size_t count, FunctionRef<void(std::size_t)> fn) {
+    for (std::size_t i = 0; i < count; ++i) {
+        fn(i);
+    }
+}
+
+auto Lines::Execution::default_executor() -> Executor & {
+    if (Executor *executor = installed.load(std::memory_order_acquire)) {
+        return *executor;
+    }
+    static WorkStealingExecutor pool;
+    return pool;
+}
+
+void Lines::Execution::set_default_executor(Executor *executor) {
+    installed.store(executor, std::memory_order_release);
+}
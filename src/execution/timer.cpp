@@ -0,0 +1,171 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/execution/timer.hpp"
+#include "lines/temporal/clocks.hpp"
+
+#include <chrono>
+
+auto Lines::Execution::SystemClock::now() const -> Temporal::TimePoint {
+    return Temporal::UTCClock::now();
+}
+
+Lines::Execution::TimerQueue::Timer::~Timer() { disarm(); }
+
+void Lines::Execution::TimerQueue::Timer::disarm() {
+    // run_due() sets _firing before it clears _queue, one of them is always
+    // seen. fire() may have rescheduled the timer, hence the loop.
+    while (true) {
+        TimerQueue *queue = _queue.load();
+        if (queue == nullptr) {
+            queue = _firing.load();
+        }
+        if (queue == nullptr) {
+            break;
+        }
+        queue->release(*this);
+    }
+}
+
+void Lines::Execution::TimerQueue::release(Timer &timer) {
+    std::unique_lock lock{_mutex};
+    if (_current == &timer && _driver == std::this_thread::get_id()) {
+        // Destroyed by its own fire(), run_due() must not touch it again
+        _current = nullptr;
+        timer._firing.store(nullptr);
+    } else {
+        _fired.wait(lock, [&] { return _current != &timer; });
+    }
+    if (timer._queue.load() == this) {
+        _timers.erase(timer._position);
+        timer._queue.store(nullptr);
+    }
+}
+
+Lines::Execution::TimerQueue::~TimerQueue() {
+    std::unique_lock lock{_mutex};
+    while (!_timers.empty()) {
+        Timer *timer = _timers.begin()->second;
+        _timers.erase(_timers.begin());
+        timer->_queue.store(nullptr);
+        lock.unlock();
+        timer->abandon();
+        lock.lock();
+    }
+}
+
+void Lines::Execution::TimerQueue::schedule(Timer &timer, const Temporal::TimePoint &at) {
+    {
+        const std::lock_guard lock{_mutex};
+        if (timer._queue.load() == this) {
+            _timers.erase(timer._position);
+        }
+        timer._position = _timers.emplace(at, &timer);
+        timer._queue.store(this);
+        _woken = true;
+    }
+    _changed.notify_all();
+}
+
+auto Lines::Execution::TimerQueue::cancel(Timer &timer) -> bool {
+    const std::lock_guard lock{_mutex};
+    if (timer._queue.load() != this) {
+        return false;
+    }
+    _timers.erase(timer._position);
+    timer._queue.store(nullptr);
+    return true;
+}
+
+auto Lines::Execution::TimerQueue::run_due() -> std::size_t {
+    const Temporal::TimePoint now = _clock.now();
+    std::size_t fired = 0;
+    std::unique_lock lock{_mutex};
+    const auto settle = [this] {
+        if (_current != nullptr) {
+            _current->_firing.store(nullptr);
+            _current = nullptr;
+        }
+        _fired.notify_all();
+    };
+    while (!_timers.empty() && _timers.begin()->first <= now) {
+        Timer *timer = _timers.begin()->second;
+        _timers.erase(_timers.begin());
+        timer->_firing.store(this);
+        timer->_queue.store(nullptr);
+        _current = timer;
+        _driver = std::this_thread::get_id();
+        // The timer may reschedule or destroy itself, destroying it from
+        // another thread waits for settle()
+        lock.unlock();
+        try {
+            timer->fire();
+        } catch (...) {
+            lock.lock();
+            settle();
+            throw;
+        }
+        ++fired;
+        lock.lock();
+        settle();
+    }
+    return fired;
+}
+
+auto Lines::Execution::TimerQueue::next_wakeup() const -> std::optional<Temporal::TimePoint> {
+    const std::lock_guard lock{_mutex};
+    if (_timers.empty()) {
+        return std::nullopt;
+    }
+    return _timers.begin()->first;
+}
+
+auto Lines::Execution::TimerQueue::pending() const -> std::size_t {
+    const std::lock_guard lock{_mutex};
+    return _timers.size();
+}
+
+void Lines::Execution::TimerQueue::run(std::stop_token stop) {
+    while (!stop.stop_requested()) {
+        run_due();
+        std::unique_lock lock{_mutex};
+        if (!_woken) {
+            const auto woken = [this] { return _woken; };
+            if (_timers.empty()) {
+                _changed.wait(lock, stop, woken);
+            } else {
+                // Time points have a resolution of seconds
+                const auto wait = _timers.begin()->first - _clock.now();
+                if (wait.count() > 0) {
+                    _changed.wait_for(lock, stop, std::chrono::seconds{wait.count()}, woken);
+                }
+            }
+        }
+        _woken = false;
+    }
+}
+
+void Lines::Execution::TimerQueue::wake() {
+    {
+        const std::lock_guard lock{_mutex};
+        _woken = true;
+    }
+    _changed.notify_all();
+}
+
+auto Lines::Execution::default_timers() -> TimerQueue & {
+    static const SystemClock clock;
+    static TimerQueue queue{clock};
+    static const TimerThread thread{queue};
+    return queue;
+}
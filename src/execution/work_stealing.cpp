@@ -0,0 +1,204 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/execution/work_stealing.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+
+struct Lines::Execution::WorkStealingExecutor::Bulk {
+    FunctionRef<void(std::size_t)> fn;
+    // Jobs are indexed by their first index, which no two jobs share
+    std::unique_ptr<Job[]> jobs;
+    std::atomic<std::size_t> remaining;
+    std::atomic<bool> failed{false};
+    std::exception_ptr error{};
+};
+
+namespace {
+LINES_CONSTEXPR std::size_t NOT_A_WORKER = std::numeric_limits<std::size_t>::max();
+// Rounds an idle worker looks for work before it goes to sleep
+LINES_CONSTEXPR int IDLE_ROUNDS = 64;
+
+// Worker the current thread is, if any
+struct CurrentWorker {
+    const void *executor = nullptr;
+    std::size_t index = NOT_A_WORKER;
+};
+thread_local CurrentWorker current_worker;
+} // namespace
+
+Lines::Execution::WorkStealingExecutor::WorkStealingExecutor(std::size_t threads) {
+    if (threads == 0) {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    _workers.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        _workers.push_back(std::make_unique<Worker>());
+    }
+    // Started once every deque exists, workers steal from each other right away
+    for (std::size_t i = 0; i < threads; ++i) {
+        _workers[i]->thread = std::jthread{[this, i] { work(i); }};
+    }
+}
+
+Lines::Execution::WorkStealingExecutor::~WorkStealingExecutor() {
+    {
+        const std::lock_guard lock{_sleep_mutex};
+        _stopping = true;
+    }
+    _sleep.notify_all();
+    for (auto &worker : _workers) {
+        worker->thread.join();
+    }
+}
+
+void Lines::Execution::WorkStealingExecutor::work(std::size_t index) {
+    current_worker = CurrentWorker{.executor = this, .index = index};
+    for (;;) {
+        const std::uint64_t signals = _signals.load();
+        Job *job = nullptr;
+        for (int round = 0; round < IDLE_ROUNDS && job == nullptr; ++round) {
+            job = find_job(index);
+            if (job == nullptr) {
+                std::this_thread::yield();
+            }
+        }
+        if (job != nullptr) {
+            run(job);
+            continue;
+        }
+        std::unique_lock lock{_sleep_mutex};
+        if (_stopping) {
+            return;
+        }
+        ++_sleepers;
+        // Anything pushed after `signals` was read changes it
+        _sleep.wait(lock, [&] { return _stopping || _signals.load() != signals; });
+        --_sleepers;
+    }
+}
+
+void Lines::Execution::WorkStealingExecutor::signal() {
+    ++_signals;
+    if (_sleepers.load() != 0) {
+        const std::lock_guard lock{_sleep_mutex};
+        _sleep.notify_one();
+    }
+}
+
+void Lines::Execution::WorkStealingExecutor::push(Job *job) {
+    if (current_worker.executor == this) {
+        _workers[current_worker.index]->jobs.push(job);
+    } else {
+        const std::lock_guard lock{_injected_mutex};
+        _injected.push_back(job);
+        ++_injected_size;
+    }
+    signal();
+}
+
+auto Lines::Execution::WorkStealingExecutor::find_job(std::size_t self) -> Job * {
+    if (self != NOT_A_WORKER) {
+        if (const auto job = _workers[self]->jobs.pop()) {
+            return *job;
+        }
+    }
+    if (_injected_size.load() != 0) {
+        const std::lock_guard lock{_injected_mutex};
+        if (!_injected.empty()) {
+            Job *job = _injected.front();
+            _injected.pop_front();
+            --_injected_size;
+            return job;
+        }
+    }
+    const std::size_t start = self != NOT_A_WORKER ? self + 1 : 0;
+    for (std::size_t i = 0; i < _workers.size(); ++i) {
+        const std::size_t victim = (start + i) % _workers.size();
+        if (victim == self) {
+            continue;
+        }
+        if (const auto job = _workers[victim]->jobs.steal()) {
+            return *job;
+        }
+    }
+    return nullptr;
+}
+
+void Lines::Execution::WorkStealingExecutor::run(Job *job) {
+    Bulk &bulk = *job->bulk;
+    const std::size_t begin = job->begin;
+    std::size_t end = job->end;
+    // Keep the lower half, offer the upper one to thieves
+    while (end - begin > 1) {
+        const std::size_t middle = begin + (end - begin) / 2;
+        Job &upper = bulk.jobs[middle];
+        upper = Job{.bulk = &bulk, .begin = middle, .end = end};
+        push(&upper);
+        end = middle;
+    }
+    if (!bulk.failed.load(std::memory_order_relaxed)) {
+        try {
+            bulk.fn(begin);
+        } catch (...) {
+            if (!bulk.failed.exchange(true)) {
+                bulk.error = std::current_exception();
+            }
+        }
+    }
+    if (bulk.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // The owner of the bulk may return as soon as it sees zero, so
+        // nothing of it is touched from here on
+        const std::lock_guard lock{_done_mutex};
+        _done.notify_all();
+    }
+}
+
+void Lines::Execution::WorkStealingExecutor::bulk(std::size_t count,
+                                                  FunctionRef<void(std::size_t)> fn) {
+    if (count == 0) {
+        return;
+    }
+    Bulk bulk{.fn = fn, .jobs = std::make_unique<Job[]>(count), .remaining = count};
+    Job &root = bulk.jobs[0];
+    root = Job{.bulk = &bulk, .begin = 0, .end = count};
+    const auto done = [&] { return bulk.remaining.load(std::memory_order_acquire) == 0; };
+
+    if (current_worker.executor == this) {
+        // Nested in a job: blocking would take the worker from the pool
+        const std::size_t self = current_worker.index;
+        run(&root);
+        while (!done()) {
+            if (Job *job = find_job(self)) {
+                run(job);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    } else {
+        push(&root);
+        while (!done()) {
+            if (Job *job = find_job(NOT_A_WORKER)) {
+                run(job);
+                continue;
+            }
+            std::unique_lock lock{_done_mutex};
+            _done.wait(lock, done);
+        }
+    }
+    if (bulk.error) {
+        std::rethrow_exception(bulk.error);
+    }
+}
@@ -0,0 +1,500 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/roadmaps/flat_roadmap.hpp"
+#include "lines/roadmaps/roadmap_views.hpp"
+#include "lines/roadmaps/roadmaps_algorithms.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+auto info_of(const Lines::Roadmap &rmap, const Lines::Allocator &alloc) -> Lines::RoadmapInfo {
+    Lines::RoadmapInfo info{alloc};
+    info.title = rmap.info().title;
+    info.description = Lines::detail::copy_optional_string(rmap.info().description, alloc);
+    info.tags = rmap.info().tags;
+    return info;
+}
+
+// Counts of a single node in `state`
+auto one(Lines::RoadmapNode::State state) -> std::array<std::uint32_t, 4> {
+    std::array<std::uint32_t, 4> counts{};
+    counts[static_cast<std::size_t>(state)] = 1;
+    return counts;
+}
+
+auto negated(std::array<std::uint32_t, 4> counts) -> std::array<std::uint32_t, 4> {
+    for (std::uint32_t &count : counts) {
+        count = 0U - count;
+    }
+    return counts;
+}
+} // namespace
+
+Lines::FlatRoadmap::FlatRoadmap(RoadmapInfo info)
+    : FlatRoadmap(std::allocator_arg, info.get_allocator(), std::move(info)) {}
+
+Lines::FlatRoadmap::FlatRoadmap(std::allocator_arg_t /*tag*/, const allocator_type &alloc,
+                                RoadmapInfo info)
+    : _info(std::allocator_arg, alloc, std::move(info)), _links(alloc), _infos(alloc),
+      _labels(alloc), _order(alloc), _jumps(alloc),
+      _counts(alloc) {
+    if (_info.title.empty()) {
+        throw std::invalid_argument("FlatRoadmap: title cannot be empty");
+    }
+    _links.emplace_back().live = true;
+    _infos.emplace_back(RoadmapNodeInfo{std::allocator_arg, alloc, "Root", "Root node"});
+    _jumps.emplace_back();
+    _counts.push_back(one(State::NotCompleted));
+    _size = 1;
+}
+
+Lines::FlatRoadmap::FlatRoadmap(const Roadmap &rmap)
+    : FlatRoadmap(std::allocator_arg, rmap.get_allocator(), rmap) {}
+
+Lines::FlatRoadmap::FlatRoadmap(std::allocator_arg_t /*tag*/, const allocator_type &alloc,
+                                const Roadmap &rmap)
+    : FlatRoadmap(std::allocator_arg, alloc, info_of(rmap, alloc)) {
+    std::size_t slots = 1;
+    Roadmaps::dfs_foreach(rmap, [&](const RoadmapNode::NodePtr &node) {
+        slots = std::max(slots, node.lock()->id() + 1);
+    });
+    if (slots >= NONE) {
+        throw std::length_error("FlatRoadmap: too many nodes");
+    }
+    _links.resize(slots);
+    _infos.resize(slots, RoadmapNodeInfo{alloc});
+
+    // Pre-order appends every child after its elder siblings
+    Roadmaps::dfs_foreach(rmap, [&](const RoadmapNode::NodePtr &node) {
+        const auto nptr = node.lock();
+        const auto index = static_cast<std::uint32_t>(nptr->id());
+        Links &links = _links[index];
+        links.live = true;
+        links.state = nptr->state();
+        RoadmapNodeInfo &info = _infos[index];
+        info.title = nptr->info().title;
+        info.description = detail::copy_optional_string(nptr->info().description, alloc);
+        info.tags = nptr->info().tags;
+        if (index != ROOT_ID) {
+            append_child(static_cast<std::uint32_t>(nptr->parent().lock()->id()), index);
+            ++_size;
+        }
+    });
+    // Holes between the imported ids are reused lowest first
+    for (auto index = static_cast<std::uint32_t>(_links.size() - 1); index > ROOT_ID; --index) {
+        if (!_links[index].live) {
+            _links[index].next_sibling = _free;
+            _free = index;
+        }
+    }
+    recount();
+}
+
+void Lines::FlatRoadmap::throw_stale() {
+    throw std::out_of_range("FlatRoadmap: stale node handle");
+}
+
+auto Lines::FlatRoadmap::allocate() -> std::uint32_t {
+    std::uint32_t index = _free;
+    if (index != NONE) {
+        _free = std::exchange(_links[index].next_sibling, NONE);
+    } else {
+        if (_links.size() >= NONE) {
+            throw std::length_error("FlatRoadmap: too many nodes");
+        }
+        index = static_cast<std::uint32_t>(_links.size());
+        _links.emplace_back();
+        try {
+            _infos.emplace_back();
+            _counts.emplace_back();
+        } catch (...) {
+            _links.pop_back();
+            _infos.resize(index);
+            throw;
+        }
+    }
+    _links[index].live = true;
+    ++_size;
+    return index;
+}
+
+void Lines::FlatRoadmap::release(std::uint32_t index) {
+    Links &links = _links[index];
+    links = Links{.next_sibling = _free, .generation = links.generation + 1};
+    _free = index;
+    _infos[index] = RoadmapNodeInfo{get_allocator()};
+    --_size;
+}
+
+void Lines::FlatRoadmap::append_child(std::uint32_t parent, std::uint32_t child) {
+    Links &links = _links[child];
+    links.parent = parent;
+    links.next_sibling = NONE;
+    set_jump(child);
+    const std::uint32_t first = _links[parent].first_child;
+    if (first == NONE) {
+        _links[parent].first_child = child;
+        links.prev_sibling = child;
+        return;
+    }
+    const std::uint32_t last = _links[first].prev_sibling;
+    _links[last].next_sibling = child;
+    links.prev_sibling = last;
+    _links[first].prev_sibling = child;
+}
+
+void Lines::FlatRoadmap::splice_children(std::uint32_t from, std::uint32_t to) {
+    const std::uint32_t first = std::exchange(_links[from].first_child, NONE);
+    if (first == NONE) {
+        return;
+    }
+    for (std::uint32_t child = first; child != NONE; child = _links[child].next_sibling) {
+        _links[child].parent = to;
+    }
+    const std::uint32_t to_first = _links[to].first_child;
+    if (to_first == NONE) {
+        _links[to].first_child = first;
+        return;
+    }
+    const std::uint32_t to_last = _links[to_first].prev_sibling;
+    const std::uint32_t last = _links[first].prev_sibling;
+    _links[to_last].next_sibling = first;
+    _links[first].prev_sibling = to_last;
+    _links[to_first].prev_sibling = last;
+}
+
+void Lines::FlatRoadmap::unlink(std::uint32_t index) {
+    const Links &links = _links[index];
+    Links &parent = _links[links.parent];
+    if (parent.first_child == index) {
+        parent.first_child = links.next_sibling;
+    } else {
+        _links[links.prev_sibling].next_sibling = links.next_sibling;
+    }
+    if (links.next_sibling != NONE) {
+        _links[links.next_sibling].prev_sibling = links.prev_sibling;
+    } else if (parent.first_child != NONE) {
+        // The node was the last child
+        _links[parent.first_child].prev_sibling = links.prev_sibling;
+    }
+}
+
+auto Lines::FlatRoadmap::add_node(NodeHandle parent, RoadmapNodeInfo info) -> NodeHandle {
+    if (!contains(parent)) {
+        throw std::invalid_argument("FlatRoadmap::add_node: stale parent handle");
+    }
+    if (info.title.empty()) {
+        throw std::invalid_argument("FlatRoadmap::add_node: title cannot be empty");
+    }
+    // Moved in before a slot is taken, so a throwing copy leaves nothing behind
+    RoadmapNodeInfo stored{std::allocator_arg, get_allocator(), std::move(info)};
+    if (labeled(parent.index)) {
+        dirty_from(_labels[parent.index].end);
+    }
+    const std::uint32_t index = allocate();
+    if (index < _labels.size()) {
+        // The slot may hold the label of a node removed before the last relabel
+        _labels[index].pre = NONE;
+    }
+    _infos[index] = std::move(stored);
+    append_child(parent.index, index);
+    _counts[index] = {};
+    count_up(index, one(State::NotCompleted));
+    return handle(index);
+}
+
+void Lines::FlatRoadmap::remove_node(NodeHandle node) {
+    const std::uint32_t index = slot(node);
+    if (index == ROOT_ID) {
+        throw std::invalid_argument("FlatRoadmap::remove_node: attempt to remove root");
+    }
+    if (labeled(index)) {
+        dirty_from(_labels[index].pre);
+    }
+    const std::uint32_t moved = _links[index].first_child;
+    count_up(_links[index].parent, negated(one(_links[index].state)));
+    unlink(index);
+    splice_children(index, _links[index].parent);
+    release(index);
+    // The moved children are last among their new siblings
+    for (std::uint32_t child = moved; child != NONE; child = _links[child].next_sibling) {
+        rejump(child);
+    }
+}
+
+auto Lines::FlatRoadmap::remove_subtree(NodeHandle node) -> std::size_t {
+    const std::uint32_t top = slot(node);
+    if (top == ROOT_ID) {
+        throw std::invalid_argument("FlatRoadmap::remove_subtree: attempt to remove root");
+    }
+    if (labeled(top)) {
+        dirty_from(_labels[top].pre);
+    }
+    count_up(_links[top].parent, negated(_counts[top]));
+    unlink(top);
+    // Post-order: descend to the first leaf, free it and continue with its
+    // next sibling, or with the parent once it ran out of children
+    std::size_t removed = 0;
+    std::uint32_t index = top;
+    while (true) {
+        if (_links[index].first_child != NONE) {
+            index = _links[index].first_child;
+            continue;
+        }
+        const std::uint32_t parent = _links[index].parent;
+        const std::uint32_t next = _links[index].next_sibling;
+        release(index);
+        ++removed;
+        if (index == top) {
+            return removed;
+        }
+        _links[parent].first_child = next;
+        index = next != NONE ? next : parent;
+    }
+}
+
+void Lines::FlatRoadmap::count_up(std::uint32_t index, const Counts &delta) {
+    for (; index != NONE; index = _links[index].parent) {
+        Counts &counts = _counts[index];
+        for (std::size_t state = 0; state < counts.size(); ++state) {
+            counts[state] += delta[state];
+        }
+    }
+}
+
+void Lines::FlatRoadmap::recount() {
+    _counts.assign(_links.size(), Counts{});
+    // Children are done before their parents
+    for (const NodeHandle node : Roadmaps::postorder(*this)) {
+        Counts &counts = _counts[node.index];
+        ++counts[static_cast<std::size_t>(_links[node.index].state)];
+        const std::uint32_t parent = _links[node.index].parent;
+        if (parent != NONE) {
+            for (std::size_t state = 0; state < counts.size(); ++state) {
+                _counts[parent][state] += counts[state];
+            }
+        }
+    }
+}
+
+auto Lines::FlatRoadmap::find(NodeID id) const -> std::optional<NodeHandle> {
+    if (id >= _links.size() || !_links[id].live) {
+        return std::nullopt;
+    }
+    return handle(static_cast<std::uint32_t>(id));
+}
+
+void Lines::FlatRoadmap::relabel() const {
+    _labels.resize(_links.size());
+    std::uint32_t position = _dirty_from;
+    std::uint32_t index = ROOT_ID;
+    // Moves to the pre-order successor, closing the subtrees it leaves.
+    // False past the last node.
+    const auto advance = [&] {
+        if (_links[index].first_child != NONE) {
+            index = _links[index].first_child;
+            return true;
+        }
+        _labels[index].end = position;
+        while (index != ROOT_ID) {
+            if (_links[index].next_sibling != NONE) {
+                index = _links[index].next_sibling;
+                return true;
+            }
+            index = _links[index].parent;
+            _labels[index].end = position;
+        }
+        return false;
+    };
+
+    bool more = true;
+    if (position != 0) {
+        // Continue after the last node whose label is current
+        index = _order[position - 1].index;
+        more = advance();
+    }
+    _order.resize(_size);
+    for (; more; more = advance()) {
+        _labels[index].pre = position;
+        _order[position] = handle(index);
+        ++position;
+    }
+    _dirty_from = NONE;
+}
+
+void Lines::FlatRoadmap::set_jump(std::uint32_t index) {
+    if (_jumps.size() < _links.size()) {
+        _jumps.resize(_links.size());
+    }
+    const std::uint32_t parent = _links[index].parent;
+    const Jump &up = _jumps[parent];
+    const Jump &far = _jumps[up.jump];
+    // Jumps of equal length twice in a row merge into one twice as long
+    const bool merge = up.depth - far.depth == far.depth - _jumps[far.jump].depth;
+    _jumps[index] = Jump{.jump = merge ? far.jump : parent, .depth = up.depth + 1};
+}
+
+void Lines::FlatRoadmap::rejump(std::uint32_t top) {
+    // Pre-order over the subtree, parents are rejumped before children
+    std::uint32_t index = top;
+    while (true) {
+        set_jump(index);
+        if (_links[index].first_child != NONE) {
+            index = _links[index].first_child;
+            continue;
+        }
+        while (index != top && _links[index].next_sibling == NONE) {
+            index = _links[index].parent;
+        }
+        if (index == top) {
+            return;
+        }
+        index = _links[index].next_sibling;
+    }
+}
+
+auto Lines::FlatRoadmap::lift(std::uint32_t index, std::uint32_t depth) const -> std::uint32_t {
+    while (_jumps[index].depth > depth) {
+        const std::uint32_t jump = _jumps[index].jump;
+        index = _jumps[jump].depth >= depth ? jump : _links[index].parent;
+    }
+    return index;
+}
+
+auto Lines::FlatRoadmap::common_ancestor(std::uint32_t first, std::uint32_t second) const
+    -> std::uint32_t {
+    const auto &jump = _jumps;
+    first = lift(first, jump[second].depth);
+    second = lift(second, jump[first].depth);
+    // At equal depths the jumps have equal lengths
+    while (first != second) {
+        if (jump[first].jump != jump[second].jump) {
+            first = jump[first].jump;
+            second = jump[second].jump;
+        } else {
+            first = _links[first].parent;
+            second = _links[second].parent;
+        }
+    }
+    return first;
+}
+
+auto Lines::FlatRoadmap::distance(NodeHandle first, NodeHandle second) const -> std::size_t {
+    const std::uint32_t from = slot(first);
+    const std::uint32_t to = slot(second);
+    const std::uint32_t top = common_ancestor(from, to);
+    return _jumps[from].depth + _jumps[to].depth - 2 * _jumps[top].depth;
+}
+
+auto Lines::FlatRoadmap::path(NodeHandle first, NodeHandle second) const
+    -> std::vector<NodeHandle> {
+    const std::uint32_t from = slot(first);
+    const std::uint32_t to = slot(second);
+    const std::uint32_t top = common_ancestor(from, to);
+    std::vector<NodeHandle> path;
+    path.reserve(_jumps[from].depth + _jumps[to].depth - 2 * _jumps[top].depth + 1);
+    for (std::uint32_t index = from; index != top; index = _links[index].parent) {
+        path.push_back(handle(index));
+    }
+    path.push_back(handle(top));
+    const std::size_t turn = path.size();
+    for (std::uint32_t index = to; index != top; index = _links[index].parent) {
+        path.push_back(handle(index));
+    }
+    std::reverse(path.begin() + static_cast<std::ptrdiff_t>(turn), path.end());
+    return path;
+}
+
+auto Lines::FlatRoadmap::prev_sibling(NodeHandle node) const -> NodeHandle {
+    const std::uint32_t index = slot(node);
+    if (index == ROOT_ID || _links[_links[index].parent].first_child == index) {
+        return {};
+    }
+    return handle(_links[index].prev_sibling);
+}
+
+auto Lines::FlatRoadmap::last_child(NodeHandle node) const -> NodeHandle {
+    const std::uint32_t first = _links[slot(node)].first_child;
+    return first == NONE ? NodeHandle{} : handle(_links[first].prev_sibling);
+}
+
+auto Lines::FlatRoadmap::out_degree(NodeHandle node) const -> std::size_t {
+    std::size_t degree = 0;
+    for (std::uint32_t child = _links[slot(node)].first_child; child != NONE;
+         child = _links[child].next_sibling) {
+        ++degree;
+    }
+    return degree;
+}
+
+auto Lines::FlatRoadmap::info(NodeHandle node) const -> const RoadmapNodeInfo & {
+    return _infos[slot(node)];
+}
+
+auto Lines::FlatRoadmap::state(NodeHandle node) const -> State { return _links[slot(node)].state; }
+
+void Lines::FlatRoadmap::set_state(NodeHandle node, State state) {
+    const std::uint32_t index = slot(node);
+    const State old_state = std::exchange(_links[index].state, state);
+    if (old_state != state) {
+        Counts delta = one(state);
+        --delta[static_cast<std::size_t>(old_state)];
+        count_up(index, delta);
+    }
+}
+
+auto Lines::FlatRoadmap::progress(NodeHandle node) const -> RoadmapProgress {
+    const Counts &counts = _counts[slot(node)];
+    const auto of = [&](State state) -> std::size_t {
+        return counts[static_cast<std::size_t>(state)];
+    };
+    return RoadmapProgress{.total = of(State::NotCompleted) + of(State::Completed) +
+                                    of(State::Skipped) + of(State::InProgress),
+                           .not_completed = of(State::NotCompleted),
+                           .completed = of(State::Completed),
+                           .skipped = of(State::Skipped),
+                           .in_progress = of(State::InProgress)};
+}
+
+auto Lines::FlatRoadmap::to_roadmap() const -> Roadmap {
+    const allocator_type alloc = get_allocator();
+    Roadmap rmap{std::allocator_arg, alloc, _info};
+    Roadmaps::dfs_foreach(*this, [&](NodeHandle node) {
+        const std::uint32_t index = node.index;
+        RoadmapNode::NodePtr added = rmap.root();
+        if (index != ROOT_ID) {
+            added = rmap.add_node(rmap[_links[index].parent],
+                                  RoadmapNodeInfo{std::allocator_arg, alloc, _infos[index]}, index);
+        }
+        added.lock()->set_state(_links[index].state);
+    });
+    return rmap;
+}
+
+auto Lines::Roadmaps::dfs(const FlatRoadmap &rmap) -> std::vector<NodeHandle> {
+    std::vector<NodeHandle> result;
+    result.reserve(rmap.size());
+    dfs_foreach(rmap, [&](NodeHandle node) { result.push_back(node); });
+    return result;
+}
+
+auto Lines::Roadmaps::bfs(const FlatRoadmap &rmap) -> std::vector<NodeHandle> {
+    std::vector<NodeHandle> result;
+    result.reserve(rmap.size());
+    bfs_foreach(rmap, [&](NodeHandle node) { result.push_back(node); });
+    return result;
+}
@@ -0,0 +1,123 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/roadmaps/roadmap_builder.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+Lines::RoadmapBuilder::RoadmapBuilder(RoadmapInfo info)
+    : RoadmapBuilder(std::allocator_arg, info.get_allocator(), std::move(info)) {}
+
+Lines::RoadmapBuilder::RoadmapBuilder(std::allocator_arg_t /*tag*/, const allocator_type &alloc,
+                                      RoadmapInfo info)
+    : _info(std::allocator_arg, alloc, std::move(info)), _parents(alloc), _infos(alloc),
+      _path(alloc) {
+    if (_info.title.empty()) {
+        throw std::invalid_argument("RoadmapBuilder: title cannot be empty");
+    }
+    _path.push_back(Roadmap::ROOT_ID);
+}
+
+void Lines::RoadmapBuilder::reserve(std::size_t nodes) {
+    _parents.reserve(nodes);
+    _infos.reserve(nodes);
+}
+
+auto Lines::RoadmapBuilder::add(NodeID parent, RoadmapNodeInfo info) -> NodeID {
+    if (parent > _parents.size()) {
+        throw std::invalid_argument("RoadmapBuilder::add: unknown parent");
+    }
+    if (info.title.empty()) {
+        throw std::invalid_argument("RoadmapBuilder::add: title cannot be empty");
+    }
+    _infos.push_back(std::move(info));
+    _parents.push_back(parent);
+    // Rebuilt by the next add_at_depth() if there is one
+    _path.clear();
+    return _parents.size();
+}
+
+auto Lines::RoadmapBuilder::add_at_depth(std::size_t depth, RoadmapNodeInfo info) -> NodeID {
+    if (_path.empty()) {
+        // The walk continues under the last node given to add()
+        for (NodeID node = _parents.size(); node != Roadmap::ROOT_ID; node = _parents[node - 1]) {
+            _path.push_back(node);
+        }
+        _path.push_back(Roadmap::ROOT_ID);
+        std::ranges::reverse(_path);
+    }
+    if (depth == 0 || depth > _path.size()) {
+        throw std::invalid_argument("RoadmapBuilder::add_at_depth: depth out of range");
+    }
+    if (info.title.empty()) {
+        throw std::invalid_argument("RoadmapBuilder::add_at_depth: title cannot be empty");
+    }
+    _infos.push_back(std::move(info));
+    _parents.push_back(_path[depth - 1]);
+    _path.resize(depth);
+    _path.push_back(_parents.size());
+    return _parents.size();
+}
+
+auto Lines::RoadmapBuilder::build() -> Roadmap {
+    const allocator_type alloc = get_allocator();
+    Roadmap rmap{std::allocator_arg, alloc, _info};
+    const std::size_t count = _parents.size();
+
+    std::vector<std::size_t> degrees(count + 1);
+    for (const NodeID parent : _parents) {
+        ++degrees[parent];
+    }
+    rmap.nodes.reserve(count + 1);
+    rmap.nodes[Roadmap::ROOT_ID]->_children.reserve(degrees[Roadmap::ROOT_ID]);
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto &parent = rmap.nodes[_parents[i]];
+        auto node = std::allocate_shared<RoadmapNode>(alloc, i + 1, std::move(_infos[i]),
+                                                      RoadmapNode::NodePtr{parent}, alloc);
+        node->_children.reserve(degrees[i + 1]);
+        parent->add_child(node);
+        Roadmap::set_jump(*node, *parent);
+        rmap.nodes.push_back(std::move(node));
+    }
+
+    _parents.clear();
+    _infos.clear();
+    _path.assign(1, Roadmap::ROOT_ID);
+    return rmap;
+}
+
+auto Lines::RoadmapBuilder::build_flat() -> FlatRoadmap {
+    const std::size_t count = _parents.size();
+    if (count >= std::numeric_limits<std::uint32_t>::max() - 1) {
+        throw std::length_error("RoadmapBuilder::build_flat: too many nodes");
+    }
+    FlatRoadmap rmap{std::allocator_arg, get_allocator(), _info};
+    rmap._links.resize(count + 1);
+    rmap._infos.reserve(count + 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto index = static_cast<std::uint32_t>(i + 1);
+        rmap._links[index].live = true;
+        rmap._infos.push_back(std::move(_infos[i]));
+        rmap.append_child(static_cast<std::uint32_t>(_parents[i]), index);
+    }
+    rmap._size = count + 1;
+    rmap.recount();
+
+    _parents.clear();
+    _infos.clear();
+    _path.assign(1, Roadmap::ROOT_ID);
+    return rmap;
+}
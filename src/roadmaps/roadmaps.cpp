@@ -1,34 +1,70 @@
 #include "lines/roadmaps/roadmaps.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <ranges>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
-Lines::RoadmapNode::RoadmapNode(NodeID id, RoadmapNodeInfo info, NodePtr parent)
-    : _id(id), _info(std::move(info)), _parent(std::move(parent)) {
+Lines::RoadmapNode::RoadmapNode(NodeID id, RoadmapNodeInfo info, NodePtr parent,
+                                const Allocator &alloc)
+    : _id(id), _info(std::allocator_arg, alloc, std::move(info)), _parent(std::move(parent)),
+      _children(alloc) {
     if (_info.title.empty()) {
         throw std::invalid_argument("RoadmapNode: title cannot be empty");
     }
 }
 
-auto Lines::RoadmapNode::title() const -> const std::string & { return _info.title; }
+auto Lines::RoadmapNode::title() const -> std::string_view { return _info.title; }
 
-auto Lines::RoadmapNode::description() const -> const std::optional<std::string> & {
-    return _info.description;
+auto Lines::RoadmapNode::description() const -> std::optional<std::string_view> {
+    return detail::view_optional_string(_info.description);
 }
 
-auto Lines::RoadmapNode::tags() const -> std::vector<std::string> { return _info.tags; }
+auto Lines::RoadmapNode::tags() const -> std::vector<std::string> {
+    return detail::to_strings(_info.tags);
+}
+
+auto Lines::RoadmapNode::info() const -> const RoadmapNodeInfo & { return _info; }
 
 auto Lines::RoadmapNode::state() const -> State { return _state; }
 
-void Lines::RoadmapNode::set_state(State state) { _state = state; }
+void Lines::RoadmapNode::set_state(State state) {
+    const State old_state = std::exchange(_state, state);
+    if (old_state != state) {
+        // The first ancestor that is not counted is recounted from its
+        // children anyway
+        std::shared_ptr<RoadmapNode> parent;
+        for (RoadmapNode *node = this; node != nullptr && node->_counted; node = parent.get()) {
+            --node->_counts[static_cast<std::size_t>(old_state)];
+            ++node->_counts[static_cast<std::size_t>(state)];
+            parent = node->_parent.lock();
+        }
+    }
+    if (_hook) {
+        _hook.observer->on_node_state_changed(_hook.id, *this, old_state);
+    }
+}
+
+void Lines::RoadmapNode::uncount() {
+    std::shared_ptr<RoadmapNode> parent;
+    for (RoadmapNode *node = this; node != nullptr && node->_counted; node = parent.get()) {
+        node->_counted = false;
+        parent = node->_parent.lock();
+    }
+}
 
 void Lines::RoadmapNode::add_child(const NodePtr &node) { _children.emplace_back(node); }
 
 void Lines::RoadmapNode::remove_child(const NodePtr &child) {
-    _children.erase(std::ranges::remove_if(
-                        _children, [&](const NodePtr &el) { return el.lock() == child.lock(); })
-                        .begin(),
-                    _children.end());
+    // Compares control blocks, nothing is locked
+    const auto it = std::ranges::find_if(_children, [&](const NodePtr &el) {
+        return !el.owner_before(child) && !child.owner_before(el);
+    });
+    if (it != _children.end()) {
+        _children.erase(it);
+    }
 }
 
 void Lines::RoadmapNode::set_parent(NodePtr parent) { _parent = std::move(parent); }
@@ -37,36 +73,232 @@ auto Lines::RoadmapNode::out_degree() const -> std::size_t { return _children.si
 
 auto Lines::RoadmapNode::parent() const -> NodePtr { return _parent; }
 
-auto Lines::RoadmapNode::children() const -> const std::vector<NodePtr> & { return _children; }
+auto Lines::RoadmapNode::children() const -> const std::pmr::vector<NodePtr> & {
+    return _children;
+}
 
 auto Lines::RoadmapNode::id() const -> NodeID { return _id; }
 
-Lines::RoadmapNodeInfo::RoadmapNodeInfo(std::string title, std::optional<std::string> description,
-                                        std::vector<std::string> tags)
-    : title(std::move(title)), description(std::move(description)), tags(std::move(tags)) {}
+Lines::RoadmapNodeInfo::RoadmapNodeInfo(std::string_view title,
+                                        std::optional<std::string_view> description,
+                                        std::initializer_list<std::string_view> tags)
+    : RoadmapNodeInfo(std::allocator_arg, allocator_type{}, title, description, tags) {}
+
+Lines::RoadmapNodeInfo::RoadmapNodeInfo(std::string_view title,
+                                        std::optional<std::string_view> description,
+                                        const std::vector<std::string> &tags)
+    : title(title), description(detail::make_optional_string(description, allocator_type{})),
+      tags(detail::make_tags(tags, allocator_type{})) {}
+
+Lines::RoadmapNodeInfo::RoadmapNodeInfo(std::allocator_arg_t /*tag*/, const allocator_type &alloc,
+                                        std::string_view title,
+                                        std::optional<std::string_view> description,
+                                        std::initializer_list<std::string_view> tags)
+    : title(title, alloc), description(detail::make_optional_string(description, alloc)),
+      tags(detail::make_tags(tags, alloc)) {}
+
+Lines::RoadmapNodeInfo::RoadmapNodeInfo(std::allocator_arg_t /*tag*/, const allocator_type &alloc,
+                                        const RoadmapNodeInfo &other)
+    : title(other.title, alloc),
+      description(detail::copy_optional_string(other.description, alloc)),
+      tags(other.tags, alloc) {}
+
+Lines::RoadmapNodeInfo::RoadmapNodeInfo(std::allocator_arg_t /*tag*/, const allocator_type &alloc,
+                                        RoadmapNodeInfo &&other)
+    : title(std::move(other.title), alloc),
+      description(detail::move_optional_string(std::move(other.description), alloc)),
+      tags(std::move(other.tags), alloc) {}
 
-Lines::RoadmapInfo::RoadmapInfo(std::string title, std::optional<std::string> description,
-                                std::vector<std::string> tags)
-    : title(std::move(title)), description(std::move(description)), tags(std::move(tags)) {}
+Lines::RoadmapInfo::RoadmapInfo(std::string_view title,
+                                std::optional<std::string_view> description,
+                                std::initializer_list<std::string_view> tags)
+    : RoadmapInfo(std::allocator_arg, allocator_type{}, title, description, tags) {}
+
+Lines::RoadmapInfo::RoadmapInfo(std::string_view title,
+                                std::optional<std::string_view> description,
+                                const std::vector<std::string> &tags)
+    : title(title), description(detail::make_optional_string(description, allocator_type{})),
+      tags(detail::make_tags(tags, allocator_type{})) {}
+
+Lines::RoadmapInfo::RoadmapInfo(std::allocator_arg_t /*tag*/, const allocator_type &alloc,
+                                std::string_view title,
+                                std::optional<std::string_view> description,
+                                std::initializer_list<std::string_view> tags)
+    : title(title, alloc), description(detail::make_optional_string(description, alloc)),
+      tags(detail::make_tags(tags, alloc)) {}
+
+Lines::RoadmapInfo::RoadmapInfo(std::allocator_arg_t /*tag*/, const allocator_type &alloc,
+                                const RoadmapInfo &other)
+    : title(other.title, alloc),
+      description(detail::copy_optional_string(other.description, alloc)),
+      tags(other.tags, alloc) {}
+
+Lines::RoadmapInfo::RoadmapInfo(std::allocator_arg_t /*tag*/, const allocator_type &alloc,
+                                RoadmapInfo &&other)
+    : title(std::move(other.title), alloc),
+      description(detail::move_optional_string(std::move(other.description), alloc)),
+      tags(std::move(other.tags), alloc) {}
 
 auto Lines::Roadmap::free_id() -> RoadmapNode::NodeID {
-    RoadmapNode::NodeID id = nodes.size();
-    for (size_t i = 1; i < nodes.size(); ++i) {
-        if (nodes[i] == nullptr) {
-            return i;
+    while (!_free_ids.empty()) {
+        const RoadmapNode::NodeID id = _free_ids.front();
+        if (nodes[id] == nullptr) {
+            return id;
         }
+        std::ranges::pop_heap(_free_ids, std::greater{});
+        _free_ids.pop_back();
     }
-    return id;
+    return nodes.size();
+}
+
+void Lines::Roadmap::push_free_id(RoadmapNode::NodeID id) {
+    _free_ids.push_back(id);
+    std::ranges::push_heap(_free_ids, std::greater{});
 }
 
-Lines::Roadmap::Roadmap(RoadmapInfo info) : _info(std::move(info)) {
-    nodes.emplace_back(std::make_shared<RoadmapNode>(ROOT_ID, RoadmapNodeInfo{"Root", "Root node"},
-                                                     RoadmapNode::NodePtr{}));
+Lines::Roadmap::Roadmap(RoadmapInfo info)
+    : Roadmap(std::allocator_arg, info.get_allocator(), std::move(info)) {}
+
+Lines::Roadmap::Roadmap(std::allocator_arg_t /*tag*/, const allocator_type &alloc, RoadmapInfo info)
+    : _info(std::allocator_arg, alloc, std::move(info)), nodes(alloc), _free_ids(alloc),
+      _labels(alloc), _order(alloc) {
+    nodes.emplace_back(std::allocate_shared<RoadmapNode>(
+        alloc, ROOT_ID, RoadmapNodeInfo{std::allocator_arg, alloc, "Root", "Root node"},
+        RoadmapNode::NodePtr{}, alloc));
     if (_info.title.empty()) {
         throw std::invalid_argument("Roadmapinfo: title cannot be empty");
     }
 }
 
+Lines::Roadmap::Roadmap(std::allocator_arg_t /*tag*/, const allocator_type &alloc,
+                        const Roadmap &other)
+    : _info(std::allocator_arg, alloc, other._info), nodes(alloc),
+      _free_ids(other._free_ids, alloc), _labels(alloc), _order(alloc) {
+    copy_nodes(other);
+}
+
+Lines::Roadmap::Roadmap(std::allocator_arg_t /*tag*/, const allocator_type &alloc, Roadmap &&other)
+    : _info(std::allocator_arg, alloc, std::move(other._info)), nodes(alloc),
+      _free_ids(std::move(other._free_ids), alloc), _hook(std::move(other._hook)),
+      _labels(alloc), _order(alloc) {
+    if (alloc == other.get_allocator()) {
+        nodes = std::move(other.nodes);
+        return;
+    }
+    copy_nodes(other);
+    // The nodes left behind must not report to the attachment taken over
+    other.detach();
+}
+
+Lines::Roadmap::Roadmap(const Roadmap &other)
+    : Roadmap(std::allocator_arg, allocator_type{}, other) {}
+
+auto Lines::Roadmap::operator=(const Roadmap &other) -> Roadmap & {
+    if (this == &other) {
+        return *this;
+    }
+    Roadmap copy{std::allocator_arg, get_allocator(), other};
+    if (_hook) {
+        assign(std::move(copy));
+    } else {
+        // Nobody to report to, the copy replaces the contents outright
+        _info = std::move(copy._info);
+        nodes = std::move(copy.nodes);
+        _free_ids = std::move(copy._free_ids);
+        _dirty_from = 0;
+    }
+    return *this;
+}
+
+auto Lines::Roadmap::operator=(Roadmap &&other) -> Roadmap & {
+    if (this == &other) {
+        return *this;
+    }
+    if (!_hook) {
+        _info = std::move(other._info);
+        nodes = std::move(other.nodes);
+        _free_ids = std::move(other._free_ids);
+        _hook = std::move(other._hook);
+        _dirty_from = 0;
+    } else if (other._hook) {
+        // The source keeps its nodes and its attachment
+        assign(Roadmap{std::allocator_arg, get_allocator(), std::as_const(other)});
+    } else {
+        assign(std::move(other));
+    }
+    return *this;
+}
+
+void Lines::Roadmap::copy_nodes(const Roadmap &other) {
+    const allocator_type alloc = get_allocator();
+    nodes.resize(other.nodes.size());
+    for (RoadmapNode::NodeID id = 0; id < other.nodes.size(); ++id) {
+        if (const auto &source = other.nodes[id]) {
+            nodes[id] = std::allocate_shared<RoadmapNode>(
+                alloc, id, RoadmapNodeInfo{std::allocator_arg, alloc, source->_info},
+                RoadmapNode::NodePtr{}, alloc);
+            nodes[id]->_state = source->_state;
+            nodes[id]->_hook.observer = _hook.observer;
+            nodes[id]->_hook.id = _hook.id;
+        }
+    }
+    // Links refer to the copies, by the ids of the originals
+    for (RoadmapNode::NodeID id = 0; id < other.nodes.size(); ++id) {
+        const auto &source = other.nodes[id];
+        if (!source) {
+            continue;
+        }
+        RoadmapNode &node = *nodes[id];
+        if (const auto parent = source->_parent.lock()) {
+            node._parent = nodes[parent->_id];
+        }
+        node._children.reserve(source->_children.size());
+        for (const auto &child : source->_children) {
+            node._children.emplace_back(nodes[child.lock()->_id]);
+        }
+    }
+    for (const auto &child : nodes[ROOT_ID]->_children) {
+        rejump(*child.lock());
+    }
+}
+
+void Lines::Roadmap::assign(Roadmap &&other) {
+    // Breadth-first order has every node after its parent
+    const auto breadth_first = [](const RoadmapNode &root) {
+        std::vector<RoadmapNode *> order;
+        for (const auto &child : root._children) {
+            order.push_back(child.lock().get());
+        }
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            for (const auto &child : order[i]->_children) {
+                order.push_back(child.lock().get());
+            }
+        }
+        return order;
+    };
+    for (auto *node : std::ranges::reverse_view(breadth_first(*nodes[ROOT_ID]))) {
+        node->_children.clear();
+        _hook.observer->on_node_removed(_hook.id, *node);
+    }
+    const RoadmapNode::State old_root_state = nodes[ROOT_ID]->_state;
+    _info = std::move(other._info);
+    nodes = std::move(other.nodes);
+    _free_ids = std::move(other._free_ids);
+    _dirty_from = 0;
+    for (const auto &node : nodes) {
+        if (node) {
+            node->_hook.observer = _hook.observer;
+            node->_hook.id = _hook.id;
+        }
+    }
+    for (const auto *node : breadth_first(*nodes[ROOT_ID])) {
+        _hook.observer->on_node_added(_hook.id, *node);
+    }
+    if (nodes[ROOT_ID]->_state != old_root_state) {
+        _hook.observer->on_node_state_changed(_hook.id, *nodes[ROOT_ID], old_root_state);
+    }
+}
+
 auto Lines::Roadmap::operator[](RoadmapNode::NodeID id) -> RoadmapNode::NodePtr {
     return nodes[id];
 }
@@ -83,10 +315,41 @@ auto Lines::Roadmap::last_id() const -> RoadmapNode::NodeID { return nodes.size(
 
 auto Lines::Roadmap::add_node(const RoadmapNode::NodePtr &parent, const RoadmapNodeInfo &info)
     -> RoadmapNode::NodePtr {
-    const RoadmapNode::NodeID id = free_id();
-    std::shared_ptr<RoadmapNode> node = std::make_shared<RoadmapNode>(id, info, parent);
+    return add_node(parent, RoadmapNodeInfo{std::allocator_arg, get_allocator(), info});
+}
+
+auto Lines::Roadmap::add_node(const RoadmapNode::NodePtr &parent, RoadmapNodeInfo &&info)
+    -> RoadmapNode::NodePtr {
+    return add_node(parent, std::move(info), free_id());
+}
+
+auto Lines::Roadmap::add_node(const RoadmapNode::NodePtr &parent, RoadmapNodeInfo &&info,
+                              RoadmapNode::NodeID id) -> RoadmapNode::NodePtr {
+    if (id == ROOT_ID || (id < nodes.size() && nodes[id] != nullptr)) {
+        throw std::invalid_argument("Roadmap::add_node: id is already in use");
+    }
+    if (id > nodes.size()) {
+        const RoadmapNode::NodeID first_hole = nodes.size();
+        nodes.resize(id);
+        for (RoadmapNode::NodeID hole = first_hole; hole < id; ++hole) {
+            push_free_id(hole);
+        }
+    }
+    const allocator_type alloc = get_allocator();
+    std::shared_ptr<RoadmapNode> node =
+        std::allocate_shared<RoadmapNode>(alloc, id, std::move(info), parent, alloc);
     if (auto p = parent.lock()) {
+        if (labeled(p->_id)) {
+            // The node goes last among the children, right after the subtree
+            dirty_from(_labels[p->_id].end);
+        }
         p->add_child(node);
+        p->uncount();
+        set_jump(*node, *p);
+    }
+    if (id < _labels.size()) {
+        // The id may hold the label of a node removed before the last relabel
+        _labels[id] = Label{};
     }
     RoadmapNode::NodePtr node_ptr = node;
     if (id < nodes.size()) {
@@ -94,6 +357,11 @@ auto Lines::Roadmap::add_node(const RoadmapNode::NodePtr &parent, const RoadmapN
     } else {
         nodes.emplace_back(std::move(node));
     }
+    if (_hook) {
+        nodes[id]->_hook.observer = _hook.observer;
+        nodes[id]->_hook.id = _hook.id;
+        _hook.observer->on_node_added(_hook.id, *nodes[id]);
+    }
     return node_ptr;
 }
 
@@ -101,24 +369,323 @@ void Lines::Roadmap::remove_node(RoadmapNode::NodeID id) {
     if (id == ROOT_ID) {
         throw std::invalid_argument("Roadmap::delete_node: attempt to delete root");
     }
-    auto parent = nodes[id]->parent();
-    RoadmapNode::NodePtr node = nodes[id];
-    if (auto n = node.lock()) {
-        if (auto p = parent.lock()) {
-            for (const auto &child : n->children()) {
-                child.lock()->set_parent(parent);
-                parent.lock()->add_child(child);
-            }
-        }
+    if (_hook) {
+        _hook.observer->on_node_removed(_hook.id, *nodes[id]);
+    }
+    if (labeled(id)) {
+        dirty_from(_labels[id].pre);
+    }
+    RoadmapNode &node = *nodes[id];
+    const auto parent = node._parent.lock();
+    parent->uncount();
+    auto &siblings = parent->_children;
+    for (const auto &child : node._children) {
+        child.lock()->_parent = parent;
+    }
+    siblings.insert(siblings.end(), node._children.begin(), node._children.end());
+    parent->remove_child(nodes[id]);
+    // The moved subtrees are a level up, jumps to the removed node are gone
+    for (const auto &child : node._children) {
+        rejump(*child.lock());
     }
-    parent.lock()->remove_child(nodes[id]);
     nodes[id] = nullptr;
+    push_free_id(id);
+}
+
+auto Lines::Roadmap::remove_subtree(RoadmapNode::NodeID id) -> std::size_t {
+    if (id == ROOT_ID) {
+        throw std::invalid_argument("Roadmap::remove_subtree: attempt to delete root");
+    }
+    if (id >= nodes.size() || !nodes[id]) {
+        throw std::out_of_range("Roadmap::remove_subtree: no node with this id");
+    }
+    if (labeled(id)) {
+        dirty_from(_labels[id].pre);
+    }
+    std::vector<RoadmapNode *> subtree{nodes[id].get()};
+    for (std::size_t i = 0; i < subtree.size(); ++i) {
+        for (const auto &child : subtree[i]->_children) {
+            subtree.push_back(child.lock().get());
+        }
+    }
+    if (_hook) {
+        // Reversed breadth-first order has every node after its descendants,
+        // observers see each removal as the one of a leaf
+        for (auto *node : std::ranges::reverse_view(subtree)) {
+            node->_children.clear();
+            _hook.observer->on_node_removed(_hook.id, *node);
+        }
+    }
+    const auto parent = nodes[id]->_parent.lock();
+    parent->remove_child(nodes[id]);
+    parent->uncount();
+    for (auto *node : subtree) {
+        const RoadmapNode::NodeID removed = node->_id;
+        nodes[removed] = nullptr;
+        push_free_id(removed);
+    }
+    return subtree.size();
 }
 
 auto Lines::Roadmap::size() const -> std::size_t { return nodes.size(); }
 
-auto Lines::Roadmap::title() const -> std::string { return _info.title; }
+auto Lines::Roadmap::node_at(RoadmapNode::NodeID id) const -> const RoadmapNode & {
+    if (id >= nodes.size() || !nodes[id]) {
+        throw std::out_of_range("Roadmap: no node with this id");
+    }
+    return *nodes[id];
+}
+
+void Lines::Roadmap::relabel() const {
+    // Node being walked and the index of its next child
+    struct Frame {
+        const RoadmapNode *node;
+        std::size_t next;
+    };
+    std::pmr::vector<Frame> stack{get_allocator()};
+    _labels.resize(nodes.size());
+    _order.resize(_dirty_from);
+    if (_dirty_from == 0) {
+        _labels[ROOT_ID].pre = 0;
+        _order.push_back(ROOT_ID);
+        stack.push_back(Frame{.node = nodes[ROOT_ID].get(), .next = 0});
+    } else {
+        // Continue after the last node whose label is current, its ancestors
+        // still have to close their subtrees
+        for (const RoadmapNode *node = nodes[_order.back()].get(); node != nullptr;) {
+            stack.push_back(Frame{.node = node, .next = 0});
+            node = node->_parent.lock().get();
+        }
+        std::ranges::reverse(stack);
+        for (std::size_t i = 0; i + 1 < stack.size(); ++i) {
+            const auto &children = stack[i].node->_children;
+            const auto *child = stack[i + 1].node;
+            const auto it = std::ranges::find_if(children, [&](const RoadmapNode::NodePtr &ptr) {
+                return ptr.lock().get() == child;
+            });
+            stack[i].next = static_cast<std::size_t>(it - children.begin()) + 1;
+        }
+    }
+    while (!stack.empty()) {
+        Frame &top = stack.back();
+        if (top.next == top.node->_children.size()) {
+            _labels[top.node->_id].end = _order.size();
+            stack.pop_back();
+            continue;
+        }
+        const RoadmapNode *child = top.node->_children[top.next++].lock().get();
+        _labels[child->_id] = Label{.pre = _order.size(), .end = UNLABELED};
+        _order.push_back(child->_id);
+        stack.push_back(Frame{.node = child, .next = 0});
+    }
+    _dirty_from = UNLABELED;
+}
+
+auto Lines::Roadmap::label(RoadmapNode::NodeID id) const -> const Label & {
+    (void)node_at(id);
+    if (_dirty_from != UNLABELED) {
+        relabel();
+    }
+    return _labels[id];
+}
+
+auto Lines::Roadmap::in_subtree(RoadmapNode::NodeID id, RoadmapNode::NodeID top) const -> bool {
+    const Label &outer = label(top);
+    const std::size_t pre = label(id).pre;
+    return outer.pre <= pre && pre < outer.end;
+}
+
+auto Lines::Roadmap::is_ancestor(RoadmapNode::NodeID ancestor, RoadmapNode::NodeID id) const
+    -> bool {
+    return ancestor != id && in_subtree(id, ancestor);
+}
+
+auto Lines::Roadmap::depth(RoadmapNode::NodeID id) const -> std::size_t {
+    return node_at(id)._depth;
+}
+
+auto Lines::Roadmap::subtree_size(RoadmapNode::NodeID id) const -> std::size_t {
+    const Label &node_label = label(id);
+    return node_label.end - node_label.pre;
+}
+
+auto Lines::Roadmap::preorder_index(RoadmapNode::NodeID id) const -> std::size_t {
+    return label(id).pre;
+}
+
+auto Lines::Roadmap::subtree_span(RoadmapNode::NodeID id) const
+    -> std::span<const RoadmapNode::NodeID> {
+    const Label &node_label = label(id);
+    return std::span<const RoadmapNode::NodeID>{_order}.subspan(node_label.pre,
+                                                                node_label.end - node_label.pre);
+}
+
+auto Lines::Roadmap::get_allocator() const -> allocator_type { return nodes.get_allocator(); }
+
+auto Lines::Roadmap::title() const -> std::string { return std::string{_info.title}; }
+
+auto Lines::Roadmap::description() const -> std::optional<std::string> {
+    if (!_info.description) {
+        return std::nullopt;
+    }
+    return std::string{*_info.description};
+}
+
+auto Lines::Roadmap::tags() const -> std::vector<std::string> {
+    return detail::to_strings(_info.tags);
+}
 
-auto Lines::Roadmap::description() const -> std::optional<std::string> { return _info.description; }
+auto Lines::Roadmap::info() const -> const RoadmapInfo & { return _info; }
 
-auto Lines::Roadmap::tags() const -> std::vector<std::string> { return _info.tags; }
+void Lines::Roadmap::attach(RoadmapObserver &observer, RoadmapID id) {
+    _hook.observer = &observer;
+    _hook.id = id;
+    for (const auto &node : nodes) {
+        if (node) {
+            node->_hook.observer = &observer;
+            node->_hook.id = id;
+        }
+    }
+}
+
+void Lines::Roadmap::detach() {
+    _hook.observer = nullptr;
+    for (const auto &node : nodes) {
+        if (node) {
+            node->_hook.observer = nullptr;
+        }
+    }
+}
+
+auto Lines::Roadmap::attached() const -> bool { return static_cast<bool>(_hook); }
+
+auto Lines::Roadmap::id() const -> std::optional<RoadmapID> {
+    return _hook ? std::optional<RoadmapID>{_hook.id} : std::nullopt;
+}
+
+auto Lines::Roadmap::observer() const -> RoadmapObserver * { return _hook.observer; }
+
+void Lines::Roadmap::set_jump(RoadmapNode &node, const RoadmapNode &parent) {
+    const RoadmapNode *far = parent._jump;
+    // Jumps of equal length twice in a row merge into one twice as long
+    const bool merge = parent._depth - far->_depth == far->_depth - far->_jump->_depth;
+    node._jump = merge ? far->_jump : &parent;
+    node._depth = parent._depth + 1;
+}
+
+void Lines::Roadmap::rejump(RoadmapNode &top) {
+    // Pre-order, parents are rejumped before their children
+    std::pmr::vector<RoadmapNode *> stack{{&top}, get_allocator()};
+    while (!stack.empty()) {
+        RoadmapNode *node = stack.back();
+        stack.pop_back();
+        set_jump(*node, *node->_parent.lock());
+        for (const auto &child : node->_children) {
+            stack.push_back(child.lock().get());
+        }
+    }
+}
+
+auto Lines::Roadmap::lift(const RoadmapNode *node, std::size_t depth) -> const RoadmapNode * {
+    while (node->_depth > depth) {
+        node = node->_jump->_depth >= depth ? node->_jump : node->_parent.lock().get();
+    }
+    return node;
+}
+
+auto Lines::Roadmap::common_ancestor(const RoadmapNode *first, const RoadmapNode *second)
+    -> const RoadmapNode * {
+    first = lift(first, second->_depth);
+    second = lift(second, first->_depth);
+    // At equal depths the jumps have equal lengths
+    while (first != second) {
+        if (first->_jump != second->_jump) {
+            first = first->_jump;
+            second = second->_jump;
+        } else {
+            first = first->_parent.lock().get();
+            second = second->_parent.lock().get();
+        }
+    }
+    return first;
+}
+
+void Lines::Roadmap::count(RoadmapNode &top) const {
+    // Post-order over the nodes that are not counted, counted children are
+    // taken as they are
+    struct Frame {
+        RoadmapNode *node;
+        std::size_t next;
+    };
+    std::pmr::vector<Frame> stack{{Frame{.node = &top, .next = 0}}, get_allocator()};
+    while (!stack.empty()) {
+        Frame &frame = stack.back();
+        RoadmapNode &node = *frame.node;
+        if (frame.next < node._children.size()) {
+            RoadmapNode *child = node._children[frame.next++].lock().get();
+            if (!child->_counted) {
+                stack.push_back(Frame{.node = child, .next = 0});
+            }
+            continue;
+        }
+        node._counts = {};
+        ++node._counts[static_cast<std::size_t>(node._state)];
+        for (const auto &child : node._children) {
+            const auto &counts = child.lock()->_counts;
+            for (std::size_t state = 0; state < counts.size(); ++state) {
+                node._counts[state] += counts[state];
+            }
+        }
+        node._counted = true;
+        stack.pop_back();
+    }
+}
+
+auto Lines::Roadmap::progress(RoadmapNode::NodeID id) const -> RoadmapProgress {
+    (void)node_at(id);
+    RoadmapNode &node = *nodes[id];
+    if (!node._counted) {
+        count(node);
+    }
+    const auto of = [&](RoadmapNode::State state) -> std::size_t {
+        return node._counts[static_cast<std::size_t>(state)];
+    };
+    using State = RoadmapNode::State;
+    return RoadmapProgress{.total = of(State::NotCompleted) + of(State::Completed) +
+                                    of(State::Skipped) + of(State::InProgress),
+                           .not_completed = of(State::NotCompleted),
+                           .completed = of(State::Completed),
+                           .skipped = of(State::Skipped),
+                           .in_progress = of(State::InProgress)};
+}
+
+auto Lines::Roadmap::lca(RoadmapNode::NodeID first, RoadmapNode::NodeID second) const
+    -> RoadmapNode::NodeID {
+    return common_ancestor(&node_at(first), &node_at(second))->_id;
+}
+
+auto Lines::Roadmap::distance(RoadmapNode::NodeID first, RoadmapNode::NodeID second) const
+    -> std::size_t {
+    const RoadmapNode &from = node_at(first);
+    const RoadmapNode &to = node_at(second);
+    return from._depth + to._depth - 2 * common_ancestor(&from, &to)->_depth;
+}
+
+auto Lines::Roadmap::path(RoadmapNode::NodeID first, RoadmapNode::NodeID second) const
+    -> std::vector<RoadmapNode::NodeID> {
+    const RoadmapNode &from = node_at(first);
+    const RoadmapNode &to = node_at(second);
+    const RoadmapNode *top = common_ancestor(&from, &to);
+    std::vector<RoadmapNode::NodeID> path;
+    path.reserve(from._depth + to._depth - 2 * top->_depth + 1);
+    for (const RoadmapNode *node = &from; node != top; node = node->_parent.lock().get()) {
+        path.push_back(node->_id);
+    }
+    path.push_back(top->_id);
+    const std::size_t turn = path.size();
+    for (const RoadmapNode *node = &to; node != top; node = node->_parent.lock().get()) {
+        path.push_back(node->_id);
+    }
+    std::reverse(path.begin() + static_cast<std::ptrdiff_t>(turn), path.end());
+    return path;
+}
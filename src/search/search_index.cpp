@@ -0,0 +1,170 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/search/search_index.hpp"
+
+#include "lines/roadmaps/roadmaps_algorithms.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace {
+using namespace Lines::Search;
+
+// Merges title and description matches into one hit per id
+auto merge(const TextIndex &titles, const TextIndex &descriptions, std::string_view query,
+           MatchMode mode, std::size_t limit) -> std::vector<SearchHit> {
+    struct Ranked {
+        SearchHit hit;
+        std::uint32_t length;
+    };
+    std::vector<Ranked> ranked;
+    std::unordered_set<std::uint32_t> seen;
+    for (const auto &match : titles.search(query, mode)) {
+        ranked.push_back({{match.doc, Field::Title, match.quality, match.position}, match.length});
+        seen.insert(match.doc);
+    }
+    for (const auto &match : descriptions.search(query, mode)) {
+        if (!seen.contains(match.doc)) {
+            ranked.push_back(
+                {{match.doc, Field::Description, match.quality, match.position}, match.length});
+        }
+    }
+    const auto better = [](const Ranked &lhs, const Ranked &rhs) {
+        if (lhs.hit.quality != rhs.hit.quality) {
+            return lhs.hit.quality > rhs.hit.quality;
+        }
+        if (lhs.hit.field != rhs.hit.field) {
+            return lhs.hit.field == Field::Title;
+        }
+        if (lhs.length != rhs.length) {
+            return lhs.length < rhs.length;
+        }
+        return lhs.hit.id < rhs.hit.id;
+    };
+    std::ranges::sort(ranked, better);
+    std::vector<SearchHit> hits;
+    hits.reserve(std::min(limit, ranked.size()));
+    for (std::size_t i = 0; i < ranked.size() && i < limit; ++i) {
+        hits.push_back(ranked[i].hit);
+    }
+    return hits;
+}
+
+auto doc_of(const Lines::RoadmapNode &node) -> DocID { return static_cast<DocID>(node.id()); }
+} // namespace
+
+// TaskSearchIndex
+
+void Lines::Search::TaskSearchIndex::track(Task &task, TaskID id) {
+    if (task.attached()) {
+        throw std::invalid_argument("TaskSearchIndex::track: task is already attached");
+    }
+    insert(id, task);
+    task.attach(*this, id);
+}
+
+void Lines::Search::TaskSearchIndex::untrack(Task &task) {
+    if (const auto id = task.id()) {
+        erase(*id);
+    }
+    task.detach();
+}
+
+void Lines::Search::TaskSearchIndex::insert(TaskID id, const Task &task) {
+    _titles.insert(id, task.title());
+    if (task.description()) {
+        _descriptions.insert(id, *task.description());
+    } else {
+        _descriptions.erase(id);
+    }
+}
+
+void Lines::Search::TaskSearchIndex::erase(TaskID id) {
+    _titles.erase(id);
+    _descriptions.erase(id);
+}
+
+auto Lines::Search::TaskSearchIndex::search(std::string_view query, MatchMode mode,
+                                            std::size_t limit) const -> std::vector<SearchHit> {
+    return merge(_titles, _descriptions, query, mode, limit);
+}
+
+void Lines::Search::TaskSearchIndex::on_title_changed(TaskID id, const Task &task,
+                                                      const std::pmr::string & /*old_title*/) {
+    _titles.update(id, task.title());
+}
+
+void Lines::Search::TaskSearchIndex::on_description_changed(
+    TaskID id, const Task &task, const std::optional<std::pmr::string> & /*old_description*/) {
+    if (task.description()) {
+        _descriptions.update(id, *task.description());
+    } else {
+        _descriptions.erase(id);
+    }
+}
+
+// RoadmapSearchIndex
+
+void Lines::Search::RoadmapSearchIndex::insert(const RoadmapNode &node) {
+    _titles.insert(doc_of(node), node.title());
+    if (node.description()) {
+        _descriptions.insert(doc_of(node), *node.description());
+    }
+}
+
+void Lines::Search::RoadmapSearchIndex::erase(const RoadmapNode &node) {
+    _titles.erase(doc_of(node));
+    _descriptions.erase(doc_of(node));
+}
+
+void Lines::Search::RoadmapSearchIndex::track(Roadmap &rmap, RoadmapID id) {
+    if (rmap.attached()) {
+        throw std::invalid_argument("RoadmapSearchIndex::track: roadmap is already attached");
+    }
+    Roadmaps::dfs_foreach(rmap, [this](const RoadmapNode::NodePtr &node) {
+        const auto nptr = node.lock();
+        if (!Roadmap::is_root(nptr->id())) {
+            insert(*nptr);
+        }
+    });
+    rmap.attach(*this, id);
+}
+
+void Lines::Search::RoadmapSearchIndex::untrack(Roadmap &rmap) {
+    if (rmap.observer() != this) {
+        throw std::invalid_argument("RoadmapSearchIndex::untrack: roadmap is not tracked here");
+    }
+    Roadmaps::dfs_foreach(rmap, [this](const RoadmapNode::NodePtr &node) {
+        const auto nptr = node.lock();
+        if (!Roadmap::is_root(nptr->id())) {
+            erase(*nptr);
+        }
+    });
+    rmap.detach();
+}
+
+auto Lines::Search::RoadmapSearchIndex::search(std::string_view query, MatchMode mode,
+                                               std::size_t limit) const -> std::vector<SearchHit> {
+    return merge(_titles, _descriptions, query, mode, limit);
+}
+
+void Lines::Search::RoadmapSearchIndex::on_node_added(RoadmapID /*id*/, const RoadmapNode &node) {
+    insert(node);
+}
+
+void Lines::Search::RoadmapSearchIndex::on_node_removed(RoadmapID /*id*/,
+                                                        const RoadmapNode &node) {
+    erase(node);
+}
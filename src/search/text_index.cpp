@@ -0,0 +1,274 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/search/text_index.hpp"
+
+#include "lines/execution/parallel.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+#if LINES_X86_64
+#include <immintrin.h>
+#endif
+
+namespace {
+using Lines::Search::DocID;
+
+LINES_CONSTEXPR std::size_t TRIGRAM = 3;
+
+auto fold(char chr) -> char {
+    return (chr >= 'A' && chr <= 'Z') ? static_cast<char>(chr - 'A' + 'a') : chr;
+}
+
+auto trigram(std::string_view text, std::size_t pos) -> std::uint32_t {
+    return (static_cast<std::uint32_t>(static_cast<unsigned char>(text[pos])) << 16U) |
+           (static_cast<std::uint32_t>(static_cast<unsigned char>(text[pos + 1])) << 8U) |
+           static_cast<std::uint32_t>(static_cast<unsigned char>(text[pos + 2]));
+}
+
+auto trigrams(std::string_view text) -> std::vector<std::uint32_t> {
+    std::vector<std::uint32_t> keys;
+    if (text.size() < TRIGRAM) {
+        return keys;
+    }
+    keys.reserve(text.size() - TRIGRAM + 1);
+    for (std::size_t i = 0; i + TRIGRAM <= text.size(); ++i) {
+        keys.push_back(trigram(text, i));
+    }
+    std::ranges::sort(keys);
+    keys.erase(std::ranges::unique(keys).begin(), keys.end());
+    return keys;
+}
+
+auto is_word_char(char chr) -> bool {
+    return (chr >= 'a' && chr <= 'z') || (chr >= '0' && chr <= '9') ||
+           static_cast<unsigned char>(chr) >= 0x80U;
+}
+
+auto word_start(std::string_view text, std::size_t pos) -> bool {
+    return pos == 0 || !is_word_char(text[pos - 1]);
+}
+
+auto find_scalar(std::string_view haystack, std::string_view needle, std::size_t from)
+    -> std::size_t {
+    return haystack.find(needle, from);
+}
+
+#if LINES_X86_64
+// Compares the first and the last byte of the needle against a whole block
+// of positions at once and only runs memcmp for positions where both match.
+template <typename Block, typename Load, typename Eq, typename Mask>
+auto find_blocks(std::string_view haystack, std::string_view needle, std::size_t from, Load load,
+                 Eq eq, Mask mask_of, Block first, Block last) -> std::size_t {
+    LINES_CONSTEXPR std::size_t width = sizeof(Block);
+    const std::size_t size = needle.size();
+    std::size_t i = from;
+    for (; i + size - 1 + width <= haystack.size(); i += width) {
+        const Block block_first = load(haystack.data() + i);
+        const Block block_last = load(haystack.data() + i + size - 1);
+        auto mask =
+            static_cast<std::uint32_t>(mask_of(eq(first, block_first), eq(last, block_last)));
+        while (mask != 0) {
+            const auto bit = static_cast<std::size_t>(std::countr_zero(mask));
+            if (std::memcmp(haystack.data() + i + bit + 1, needle.data() + 1, size - 2) == 0) {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+    return find_scalar(haystack, needle, i);
+}
+#endif
+} // namespace
+
+auto Lines::Search::fold_case(std::string_view text) -> std::string {
+    std::string folded(text.size(), '\0');
+    std::ranges::transform(text, folded.begin(), fold);
+    return folded;
+}
+
+auto Lines::Search::find(std::string_view haystack, std::string_view needle, std::size_t from)
+    -> std::size_t {
+    if (needle.size() < 2 || from > haystack.size()) {
+        return find_scalar(haystack, needle, from);
+    }
+#if LINES_HAS_AVX2
+    return find_blocks(
+        haystack, needle, from,
+        [](const char *ptr) {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)); // NOLINT
+        },
+        [](__m256i lhs, __m256i rhs) { return _mm256_cmpeq_epi8(lhs, rhs); },
+        [](__m256i lhs, __m256i rhs) { return _mm256_movemask_epi8(_mm256_and_si256(lhs, rhs)); },
+        _mm256_set1_epi8(needle.front()), _mm256_set1_epi8(needle.back()));
+#elif LINES_X86_64
+    // SSE2 is part of the x86-64 baseline
+    return find_blocks(
+        haystack, needle, from,
+        [](const char *ptr) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)); // NOLINT
+        },
+        [](__m128i lhs, __m128i rhs) { return _mm_cmpeq_epi8(lhs, rhs); },
+        [](__m128i lhs, __m128i rhs) { return _mm_movemask_epi8(_mm_and_si128(lhs, rhs)); },
+        _mm_set1_epi8(needle.front()), _mm_set1_epi8(needle.back()));
+#else
+    return find_scalar(haystack, needle, from);
+#endif
+}
+
+void Lines::Search::TextIndex::insert(DocID doc, std::string_view text) {
+    if (_docs.contains(doc)) {
+        erase(doc);
+    }
+    if (doc >= _texts.size()) {
+        _texts.resize(static_cast<std::size_t>(doc) + 1);
+    }
+    _texts[doc] = fold_case(text);
+    for (const std::uint32_t key : trigrams(_texts[doc])) {
+        _postings[key].add(doc);
+    }
+    _docs.add(doc);
+}
+
+void Lines::Search::TextIndex::insert(DocID first, std::span<const std::string_view> texts,
+                                     Execution::Executor &executor) {
+    if (!texts.empty() && texts.size() - 1 > std::numeric_limits<DocID>::max() - first) {
+        throw std::length_error("TextIndex::insert: document ids out of range");
+    }
+    for (std::size_t i = 0; i < texts.size(); ++i) {
+        erase(static_cast<DocID>(first + i));
+    }
+    const std::size_t end = static_cast<std::size_t>(first) + texts.size();
+    if (end > _texts.size()) {
+        _texts.resize(end);
+    }
+    const std::size_t grain = Execution::detail::grain_for(executor, texts.size(), 0);
+    std::vector<std::unordered_map<std::uint32_t, Bitmap>> chunks((texts.size() + grain - 1) /
+                                                                  grain);
+    executor.bulk(chunks.size(), [&](std::size_t chunk) {
+        const std::size_t begin = chunk * grain;
+        for (std::size_t i = begin; i < std::min(begin + grain, texts.size()); ++i) {
+            const auto doc = static_cast<DocID>(first + i);
+            _texts[doc] = fold_case(texts[i]);
+            for (const std::uint32_t key : trigrams(_texts[doc])) {
+                chunks[chunk][key].add(doc);
+            }
+        }
+    });
+    // Chunks cover ascending id ranges
+    for (auto &chunk : chunks) {
+        for (auto &[key, docs] : chunk) {
+            // try_emplace leaves docs alone when the key is already there
+            const auto [it, inserted] = _postings.try_emplace(key, std::move(docs));
+            if (!inserted) {
+                it->second |= docs;
+            }
+        }
+    }
+    for (std::size_t i = 0; i < texts.size(); ++i) {
+        _docs.add(static_cast<DocID>(first + i));
+    }
+}
+
+void Lines::Search::TextIndex::erase(DocID doc) {
+    if (!_docs.remove(doc)) {
+        return;
+    }
+    for (const std::uint32_t key : trigrams(_texts[doc])) {
+        const auto it = _postings.find(key);
+        it->second.remove(doc);
+        if (it->second.empty()) {
+            _postings.erase(it);
+        }
+    }
+    _texts[doc].clear();
+    _texts[doc].shrink_to_fit();
+}
+
+void Lines::Search::TextIndex::update(DocID doc, std::string_view text) { insert(doc, text); }
+
+auto Lines::Search::TextIndex::candidates(std::string_view folded) const -> Bitmap {
+    if (folded.size() < TRIGRAM) {
+        return _docs;
+    }
+    std::vector<const Bitmap *> lists;
+    for (const std::uint32_t key : trigrams(folded)) {
+        const auto it = _postings.find(key);
+        if (it == _postings.end()) {
+            return {};
+        }
+        lists.push_back(&it->second);
+    }
+    // Start from the rarest trigram so intermediate results stay small
+    std::ranges::sort(lists, {}, [](const Bitmap *list) { return list->cardinality(); });
+    Bitmap result = *lists.front();
+    for (std::size_t i = 1; i < lists.size() && !result.empty(); ++i) {
+        result &= *lists[i];
+    }
+    return result;
+}
+
+auto Lines::Search::TextIndex::search(std::string_view query, MatchMode mode,
+                                      std::size_t limit) const -> std::vector<TextMatch> {
+    std::vector<TextMatch> matches;
+    if (query.empty() || limit == 0) {
+        return matches;
+    }
+    const std::string folded = fold_case(query);
+    candidates(folded).for_each([&](DocID doc) {
+        const std::string_view text = _texts[doc];
+        std::size_t pos = find(text, folded);
+        if (pos == std::string_view::npos) {
+            return;
+        }
+        // Prefer an occurrence at a word start, it ranks higher
+        std::size_t word = pos;
+        while (word != std::string_view::npos && !word_start(text, word)) {
+            word = find(text, folded, word + 1);
+        }
+        if (mode == MatchMode::Prefix && word == std::string_view::npos) {
+            return;
+        }
+        MatchQuality quality = MatchQuality::Substring;
+        if (word != std::string_view::npos) {
+            pos = word;
+            quality = MatchQuality::WordPrefix;
+        }
+        if (pos == 0) {
+            quality = text.size() == folded.size() ? MatchQuality::Exact : MatchQuality::Prefix;
+        }
+        matches.push_back(TextMatch{doc, quality, static_cast<std::uint32_t>(pos),
+                                    static_cast<std::uint32_t>(text.size())});
+    });
+
+    const auto better = [](const TextMatch &lhs, const TextMatch &rhs) {
+        if (lhs.quality != rhs.quality) {
+            return lhs.quality > rhs.quality;
+        }
+        if (lhs.length != rhs.length) {
+            return lhs.length < rhs.length;
+        }
+        return lhs.doc < rhs.doc;
+    };
+    if (limit < matches.size()) {
+        std::ranges::partial_sort(matches, matches.begin() + static_cast<std::ptrdiff_t>(limit),
+                                  better);
+        matches.resize(limit);
+    } else {
+        std::ranges::sort(matches, better);
+    }
+    return matches;
+}
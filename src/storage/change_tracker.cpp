@@ -0,0 +1,207 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/change_tracker.hpp"
+
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+using namespace Lines;
+using namespace Lines::Storage;
+
+LINES_CONSTEXPR unsigned FIELD_BITS = 8;
+LINES_CONSTEXPR unsigned NODE_BITS = 32;
+
+auto node_key(RoadmapID roadmap, RoadmapNode::NodeID node) -> std::uint64_t {
+    LINES_ASSERT(node <= std::numeric_limits<std::uint32_t>::max());
+    return (std::uint64_t{roadmap} << NODE_BITS) | static_cast<std::uint64_t>(node);
+}
+
+auto node_at(Roadmap &rmap, RoadmapNode::NodeID id) -> std::shared_ptr<RoadmapNode> {
+    auto node = id < rmap.size() ? rmap[id].lock() : nullptr;
+    if (!node) {
+        throw std::out_of_range("apply_changes: unknown node");
+    }
+    return node;
+}
+
+auto copy_info(const RoadmapNodeInfo &info) -> RoadmapNodeInfo {
+    RoadmapNodeInfo copy{RoadmapNodeInfo::allocator_type{}};
+    copy.title = info.title;
+    copy.description = info.description;
+    copy.tags = info.tags;
+    return copy;
+}
+} // namespace
+
+void Lines::Storage::ChangeTracker::push(Change change) {
+    _changes.emplace_back(std::move(change));
+    ++_live;
+}
+
+void Lines::Storage::ChangeTracker::drop(std::size_t slot) {
+    _changes[slot].reset();
+    --_live;
+}
+
+void Lines::Storage::ChangeTracker::record_task(TaskID id, Change change) {
+    _dirty_tasks.add(id);
+    const std::uint64_t key = (std::uint64_t{id} << FIELD_BITS) | change.index();
+    if (const auto it = _task_slots.find(key); it != _task_slots.end()) {
+        *_changes[it->second] = std::move(change);
+        return;
+    }
+    _task_slots.emplace(key, _changes.size());
+    push(std::move(change));
+}
+
+auto Lines::Storage::ChangeTracker::take_changes() -> std::vector<Change> {
+    std::vector<Change> changes;
+    changes.reserve(_live);
+    for (auto &change : _changes) {
+        if (change) {
+            changes.push_back(std::move(*change));
+        }
+    }
+    _changes.clear();
+    _live = 0;
+    _task_slots.clear();
+    _node_slots.clear();
+    _dirty_tasks.clear();
+    _dirty_roadmaps.clear();
+    return changes;
+}
+
+void Lines::Storage::ChangeTracker::on_title_changed(TaskID id, const Task &task,
+                                                     const std::pmr::string & /*old_title*/) {
+    record_task(id, Delta::TaskTitle{.task = id, .title = task.info().title});
+}
+
+void Lines::Storage::ChangeTracker::on_description_changed(
+    TaskID id, const Task &task, const std::optional<std::pmr::string> & /*old_description*/) {
+    record_task(id, Delta::TaskDescription{.task = id, .description = task.info().description});
+}
+
+void Lines::Storage::ChangeTracker::on_tags_changed(TaskID id, const Task &task,
+                                                    const Tags & /*old_tags*/) {
+    record_task(id, Delta::TaskTags{.task = id, .tags = task.info().tags});
+}
+
+void Lines::Storage::ChangeTracker::on_deadline_changed(
+    TaskID id, const Task &task, const std::optional<Temporal::TimePoint> & /*old_deadline*/) {
+    record_task(id, Delta::TaskDeadline{.task = id, .deadline = task.deadline()});
+}
+
+void Lines::Storage::ChangeTracker::on_completion_changed(TaskID id, const Task &task) {
+    record_task(id, Delta::TaskCompletion{.task = id, .completed = task.completed()});
+}
+
+void Lines::Storage::ChangeTracker::on_repeat_rule_changed(TaskID id, const Task &task) {
+    record_task(id, Delta::TaskRepeatRule{.task = id, .rule = task.repeat_rule()});
+}
+
+void Lines::Storage::ChangeTracker::on_node_added(RoadmapID id, const RoadmapNode &node) {
+    _dirty_roadmaps.add(id);
+    RoadmapNodeInfo info{RoadmapNodeInfo::allocator_type{}};
+    info.title = node.info().title;
+    info.description = node.info().description;
+    info.tags = node.info().tags;
+    _node_slots[node_key(id, node.id())] = _changes.size();
+    push(Delta::NodeAdded{.roadmap = id,
+                          .node = node.id(),
+                          .parent = node.parent().lock()->id(),
+                          .info = std::move(info),
+                          .state = node.state()});
+}
+
+void Lines::Storage::ChangeTracker::on_node_removed(RoadmapID id, const RoadmapNode &node) {
+    _dirty_roadmaps.add(id);
+    if (const auto it = _node_slots.find(node_key(id, node.id())); it != _node_slots.end()) {
+        const std::size_t slot = it->second;
+        _node_slots.erase(it);
+        if (std::holds_alternative<Delta::NodeState>(*_changes[slot])) {
+            drop(slot);
+        } else if (node.out_degree() == 0) {
+            // Added and removed within the batch, the other side never sees it.
+            // Nodes with children stay, their children are reparented on removal.
+            drop(slot);
+            return;
+        }
+    }
+    push(Delta::NodeRemoved{.roadmap = id, .node = node.id()});
+}
+
+void Lines::Storage::ChangeTracker::on_node_state_changed(RoadmapID id, const RoadmapNode &node,
+                                                          RoadmapNode::State /*old_state*/) {
+    _dirty_roadmaps.add(id);
+    const std::uint64_t key = node_key(id, node.id());
+    if (const auto it = _node_slots.find(key); it != _node_slots.end()) {
+        std::visit(
+            [&](auto &delta) {
+                using T = std::decay_t<decltype(delta)>;
+                LINES_CONSTEXPR_IF(std::is_same_v<T, Delta::NodeAdded> ||
+                                   std::is_same_v<T, Delta::NodeState>) {
+                    delta.state = node.state();
+                }
+            },
+            *_changes[it->second]);
+        return;
+    }
+    _node_slots.emplace(key, _changes.size());
+    push(Delta::NodeState{.roadmap = id, .node = node.id(), .state = node.state()});
+}
+
+void Lines::Storage::apply_changes(Workspace &workspace, std::span<const Change> changes) {
+    for (const auto &change : changes) {
+        std::visit(
+            [&](const auto &delta) {
+                using T = std::decay_t<decltype(delta)>;
+                LINES_CONSTEXPR_IF(std::is_same_v<T, Delta::TaskTitle>) {
+                    workspace.tasks.at(delta.task).set_title(delta.title);
+                }
+                else LINES_CONSTEXPR_IF(std::is_same_v<T, Delta::TaskDescription>) {
+                    workspace.tasks.at(delta.task).set_description(delta.description);
+                }
+                else LINES_CONSTEXPR_IF(std::is_same_v<T, Delta::TaskTags>) {
+                    workspace.tasks.at(delta.task).set_tags(delta.tags);
+                }
+                else LINES_CONSTEXPR_IF(std::is_same_v<T, Delta::TaskDeadline>) {
+                    workspace.tasks.at(delta.task).set_deadline(delta.deadline);
+                }
+                else LINES_CONSTEXPR_IF(std::is_same_v<T, Delta::TaskCompletion>) {
+                    Task &task = workspace.tasks.at(delta.task);
+                    delta.completed ? task.complete() : task.uncomplete();
+                }
+                else LINES_CONSTEXPR_IF(std::is_same_v<T, Delta::TaskRepeatRule>) {
+                    workspace.tasks.at(delta.task).set_repeat_rule(delta.rule);
+                }
+                else LINES_CONSTEXPR_IF(std::is_same_v<T, Delta::NodeAdded>) {
+                    Roadmap &rmap = workspace.roadmaps.at(delta.roadmap);
+                    rmap.add_node(node_at(rmap, delta.parent), copy_info(delta.info), delta.node)
+                        .lock()
+                        ->set_state(delta.state);
+                }
+                else LINES_CONSTEXPR_IF(std::is_same_v<T, Delta::NodeRemoved>) {
+                    Roadmap &rmap = workspace.roadmaps.at(delta.roadmap);
+                    rmap.remove_node(node_at(rmap, delta.node)->id());
+                }
+                else {
+                    Roadmap &rmap = workspace.roadmaps.at(delta.roadmap);
+                    node_at(rmap, delta.node)->set_state(delta.state);
+                }
+            },
+            change);
+    }
+}
@@ -0,0 +1,65 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/checksum.hpp"
+
+#include <array>
+#include <cstring>
+
+#if LINES_HAS_SSE42
+#include <immintrin.h>
+#endif
+
+namespace {
+#if !LINES_HAS_SSE42
+LINES_CONSTEXPR std::uint32_t POLYNOMIAL = 0x82F63B78U; // reflected Castagnoli polynomial
+
+constexpr auto make_table() -> std::array<std::uint32_t, 256> {
+    std::array<std::uint32_t, 256> table{};
+    for (std::uint32_t i = 0; i < table.size(); ++i) {
+        std::uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1U) != 0 ? (crc >> 1U) ^ POLYNOMIAL : crc >> 1U;
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+LINES_CONSTEXPR auto TABLE = make_table();
+#endif
+} // namespace
+
+auto Lines::Storage::crc32c(std::span<const std::byte> bytes, std::uint32_t crc) -> std::uint32_t {
+    crc = ~crc;
+    const std::byte *data = bytes.data();
+    std::size_t size = bytes.size();
+#if LINES_HAS_SSE42
+    std::uint64_t crc64 = crc;
+    for (; size >= sizeof(std::uint64_t); size -= sizeof(std::uint64_t)) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, data, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+        data += sizeof(word); // NOLINT
+    }
+    crc = static_cast<std::uint32_t>(crc64);
+    for (; size > 0; --size) {
+        crc = _mm_crc32_u8(crc, static_cast<std::uint8_t>(*data++)); // NOLINT
+    }
+#else
+    for (; size > 0; --size) {
+        crc = TABLE[(crc ^ static_cast<std::uint8_t>(*data++)) & 0xFFU] ^ (crc >> 8U); // NOLINT
+    }
+#endif
+    return ~crc;
+}
@@ -0,0 +1,213 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/concurrent_task_store.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+namespace {
+// Retired objects a shard keeps before it tries to free them
+LINES_CONSTEXPR std::size_t COLLECT_THRESHOLD = 64;
+// Directory, chunk and task a single replacement may retire
+LINES_CONSTEXPR std::size_t RETIRED_PER_REPLACE = 3;
+
+template <typename T> void destroy(const void *object) { delete static_cast<const T *>(object); }
+
+// Slot a thread tries first, spreads readers over the slots
+auto slot_hint() -> std::size_t {
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t hint = next.fetch_add(1, std::memory_order_relaxed);
+    return hint;
+}
+} // namespace
+
+// EpochDomain
+
+auto Lines::Storage::EpochDomain::pin() -> Guard {
+    const std::size_t hint = slot_hint();
+    for (;;) {
+        for (std::size_t i = 0; i < SLOTS; ++i) {
+            const std::size_t slot = (hint + i) % SLOTS;
+            std::uint64_t free = 0;
+            // seq_cst: either a writer scanning the slots sees this reader, or
+            // the reader sees every root the writer published before the scan
+            if (_slots[slot].epoch.compare_exchange_strong(free, _epoch.load())) {
+                return Guard{*this, slot};
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+auto Lines::Storage::EpochDomain::safe_epoch() const -> std::uint64_t {
+    std::uint64_t safe = _epoch.load();
+    for (const Slot &slot : _slots) {
+        const std::uint64_t epoch = slot.epoch.load();
+        if (epoch != 0) {
+            safe = std::min(safe, epoch);
+        }
+    }
+    return safe;
+}
+
+// ConcurrentTaskStore
+
+Lines::Storage::ConcurrentTaskStore::ConcurrentTaskStore(std::size_t shards)
+    : _shard_count(shards) {
+    if (shards == 0) {
+        throw std::invalid_argument("ConcurrentTaskStore: at least one shard is required");
+    }
+    _shards = std::make_unique<Shard[]>(shards);
+    for (std::size_t i = 0; i < shards; ++i) {
+        _shards[i].root.store(new Directory{});
+    }
+}
+
+Lines::Storage::ConcurrentTaskStore::~ConcurrentTaskStore() {
+    for (std::size_t i = 0; i < _shard_count; ++i) {
+        Shard &shard = _shards[i];
+        const Directory *root = shard.root.load();
+        for (std::size_t position = 0; position < root->size; ++position) {
+            delete lookup(root, position);
+        }
+        for (const Chunk *chunk : root->chunks) {
+            delete chunk;
+        }
+        delete root;
+        for (const Retired &retired : shard.retired) {
+            retired.destroy(retired.object);
+        }
+    }
+}
+
+void Lines::Storage::ConcurrentTaskStore::replace(Shard &shard, std::size_t position,
+                                                  std::unique_ptr<const Task> task) {
+    const Directory *old_root = shard.root.load(std::memory_order_relaxed);
+    const std::size_t index = position / CHUNK;
+    const Chunk *old_chunk = index < old_root->chunks.size() ? old_root->chunks[index] : nullptr;
+
+    // Allocate everything up front, so a failure leaves the shard untouched
+    // and frees what was built for it
+    auto root = std::make_unique<Directory>(*old_root);
+    root->chunks.reserve(std::max(root->chunks.size(), index + 1));
+    // Chunks bridging a gap of ids stay empty until their tasks arrive
+    std::vector<std::unique_ptr<Chunk>> gap;
+    for (std::size_t i = root->chunks.size(); i < index; ++i) {
+        gap.push_back(std::make_unique<Chunk>());
+    }
+    auto chunk =
+        old_chunk != nullptr ? std::make_unique<Chunk>(*old_chunk) : std::make_unique<Chunk>();
+    if (shard.retired.capacity() - shard.retired.size() < RETIRED_PER_REPLACE) {
+        shard.retired.reserve(
+            std::max(shard.retired.size() + RETIRED_PER_REPLACE, 2 * shard.retired.capacity()));
+    }
+
+    // Nothing below throws
+    for (auto &empty : gap) {
+        root->chunks.push_back(empty.release());
+    }
+    root->size = std::max(root->size, position + 1);
+    const Task *old_task = chunk->tasks[position % CHUNK];
+    chunk->tasks[position % CHUNK] = task.release();
+    if (index < root->chunks.size()) {
+        root->chunks[index] = chunk.release();
+    } else {
+        root->chunks.push_back(chunk.release());
+    }
+    shard.root.store(root.release());
+
+    // Everything replaced is reachable only through old_root from now on
+    const std::uint64_t epoch = _domain.epoch();
+    shard.retired.push_back(Retired{old_root, destroy<Directory>, epoch});
+    if (old_chunk != nullptr) {
+        shard.retired.push_back(Retired{old_chunk, destroy<Chunk>, epoch});
+    }
+    if (old_task != nullptr) {
+        shard.retired.push_back(Retired{old_task, destroy<Task>, epoch});
+    }
+    if (shard.retired.size() >= COLLECT_THRESHOLD) {
+        collect(shard);
+    }
+}
+
+void Lines::Storage::ConcurrentTaskStore::collect(Shard &shard) {
+    // Readers pinning from now on cannot reach anything retired so far
+    _domain.advance();
+    const std::uint64_t safe = _domain.safe_epoch();
+    const auto reclaimed = std::ranges::remove_if(shard.retired, [&](const Retired &retired) {
+        if (retired.epoch >= safe) {
+            return false;
+        }
+        retired.destroy(retired.object);
+        return true;
+    });
+    shard.retired.erase(reclaimed.begin(), reclaimed.end());
+}
+
+auto Lines::Storage::ConcurrentTaskStore::insert(Task task) -> TaskID {
+    const TaskID id = _next.fetch_add(1, std::memory_order_relaxed);
+    if (id == std::numeric_limits<TaskID>::max()) {
+        throw std::length_error("ConcurrentTaskStore::insert: out of task ids");
+    }
+    task.detach();
+    Shard &shard = shard_of(id);
+    const std::lock_guard lock{shard.mutex};
+    replace(shard, position(id), std::make_unique<const Task>(std::move(task)));
+    return id;
+}
+
+auto Lines::Storage::ConcurrentTaskStore::erase(TaskID id) -> bool {
+    Shard &shard = shard_of(id);
+    const std::lock_guard lock{shard.mutex};
+    if (lookup(shard.root.load(std::memory_order_relaxed), position(id)) == nullptr) {
+        return false;
+    }
+    replace(shard, position(id), nullptr);
+    return true;
+}
+
+auto Lines::Storage::ConcurrentTaskStore::snapshot() const -> Snapshot {
+    return Snapshot{*this, _domain.pin()};
+}
+
+auto Lines::Storage::ConcurrentTaskStore::pending_reclamation() const -> std::size_t {
+    std::size_t pending = 0;
+    for (std::size_t i = 0; i < _shard_count; ++i) {
+        const std::lock_guard lock{_shards[i].mutex};
+        pending += _shards[i].retired.size();
+    }
+    return pending;
+}
+
+// ConcurrentTaskStore::Snapshot
+
+Lines::Storage::ConcurrentTaskStore::Snapshot::Snapshot(const ConcurrentTaskStore &store,
+                                                        EpochDomain::Guard guard)
+    : _guard(std::move(guard)) {
+    _roots.reserve(store._shard_count);
+    for (std::size_t i = 0; i < store._shard_count; ++i) {
+        _roots.push_back(store._shards[i].root.load());
+    }
+}
+
+auto Lines::Storage::ConcurrentTaskStore::Snapshot::find(TaskID id) const -> const Task * {
+    return lookup(_roots[id % _roots.size()], id / _roots.size());
+}
+
+auto Lines::Storage::ConcurrentTaskStore::Snapshot::size() const -> std::size_t {
+    std::size_t size = 0;
+    for_each([&](TaskID /*id*/, const Task & /*task*/) { ++size; });
+    return size;
+}
@@ -0,0 +1,277 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/file.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(LINES_WINDOWSNT)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+[[noreturn]] void fail(std::string_view what, const std::filesystem::path &path = {}) {
+    std::string message{what};
+    if (!path.empty()) {
+        message += ": " + path.string();
+    }
+    throw std::system_error(errno, std::generic_category(), message);
+}
+
+#if defined(LINES_WINDOWSNT)
+auto open_file(const std::filesystem::path &path, int flags) -> int {
+    int fd = -1;
+    _wsopen_s(&fd, path.c_str(), flags | _O_BINARY, _SH_DENYNO, _S_IREAD | _S_IWRITE);
+    return fd;
+}
+
+auto write_some(int fd, const std::byte *data, std::size_t size) -> std::ptrdiff_t {
+    LINES_CONSTEXPR std::size_t MAX_CHUNK = 1U << 30U;
+    return _write(fd, data, static_cast<unsigned>(std::min(size, MAX_CHUNK)));
+}
+
+auto read_some(int fd, std::byte *data, std::size_t size) -> std::ptrdiff_t {
+    LINES_CONSTEXPR std::size_t MAX_CHUNK = 1U << 30U;
+    return _read(fd, data, static_cast<unsigned>(std::min(size, MAX_CHUNK)));
+}
+
+auto sync_fd(int fd) -> int { return _commit(fd); }
+
+auto close_fd(int fd) -> int { return _close(fd); }
+
+LINES_CONSTEXPR int READ_FLAGS = _O_RDONLY;
+LINES_CONSTEXPR int APPEND_FLAGS = _O_WRONLY | _O_CREAT | _O_APPEND;
+LINES_CONSTEXPR int TRUNCATE_FLAGS = _O_WRONLY | _O_CREAT | _O_TRUNC;
+#else
+LINES_CONSTEXPR mode_t FILE_MODE = 0644;
+
+auto open_file(const std::filesystem::path &path, int flags) -> int {
+    int fd = -1;
+    do {
+        fd = ::open(path.c_str(), flags | O_CLOEXEC, FILE_MODE); // NOLINT
+    } while (fd < 0 && errno == EINTR);
+    return fd;
+}
+
+auto write_some(int fd, const std::byte *data, std::size_t size) -> std::ptrdiff_t {
+    return ::write(fd, data, size);
+}
+
+auto read_some(int fd, std::byte *data, std::size_t size) -> std::ptrdiff_t {
+    return ::read(fd, data, size);
+}
+
+auto sync_fd(int fd) -> int {
+#if defined(LINES_DARWIN)
+    return ::fsync(fd);
+#else
+    return ::fdatasync(fd);
+#endif
+}
+
+auto close_fd(int fd) -> int { return ::close(fd); }
+
+LINES_CONSTEXPR int READ_FLAGS = O_RDONLY;
+LINES_CONSTEXPR int APPEND_FLAGS = O_WRONLY | O_CREAT | O_APPEND;
+LINES_CONSTEXPR int TRUNCATE_FLAGS = O_WRONLY | O_CREAT | O_TRUNC;
+#endif
+} // namespace
+
+Lines::Storage::File::File(const std::filesystem::path &path, Mode mode) {
+    int flags = READ_FLAGS;
+    if (mode == Mode::Append) {
+        flags = APPEND_FLAGS;
+    } else if (mode == Mode::Truncate) {
+        flags = TRUNCATE_FLAGS;
+    }
+    _fd = open_file(path, flags);
+    if (_fd < 0) {
+        fail("File: cannot open", path);
+    }
+}
+
+Lines::Storage::File::File(File &&other) noexcept : _fd(std::exchange(other._fd, -1)) {}
+
+auto Lines::Storage::File::operator=(File &&other) noexcept -> File & {
+    if (this != &other) {
+        if (_fd >= 0) {
+            close_fd(_fd);
+        }
+        _fd = std::exchange(other._fd, -1);
+    }
+    return *this;
+}
+
+Lines::Storage::File::~File() {
+    if (_fd >= 0) {
+        close_fd(_fd);
+    }
+}
+
+auto Lines::Storage::File::read(std::span<std::byte> buffer) -> std::size_t {
+    for (;;) {
+        const auto count = read_some(_fd, buffer.data(), buffer.size());
+        if (count >= 0) {
+            return static_cast<std::size_t>(count);
+        }
+        if (errno != EINTR) {
+            fail("File::read");
+        }
+    }
+}
+
+void Lines::Storage::File::write(std::span<const std::byte> bytes) {
+    while (!bytes.empty()) {
+        const auto written = write_some(_fd, bytes.data(), bytes.size());
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            fail("File::write");
+        }
+        bytes = bytes.subspan(static_cast<std::size_t>(written));
+    }
+}
+
+void Lines::Storage::File::sync() {
+    if (sync_fd(_fd) != 0) {
+        fail("File::sync");
+    }
+}
+
+void Lines::Storage::File::close() {
+    if (_fd >= 0 && close_fd(std::exchange(_fd, -1)) != 0) {
+        fail("File::close");
+    }
+}
+
+Lines::Storage::MappedFile::MappedFile(const std::filesystem::path &path) {
+    _size = std::filesystem::file_size(path);
+    if (_size == 0) {
+        return; // empty files cannot be mapped
+    }
+#if defined(LINES_WINDOWSNT)
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(),
+                                "MappedFile: cannot open: " + path.string());
+    }
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(),
+                                "MappedFile: cannot map: " + path.string());
+    }
+    // The view keeps the mapping object alive
+    _data = static_cast<const std::byte *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if (_data == nullptr) {
+        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(),
+                                "MappedFile: cannot map: " + path.string());
+    }
+#else
+    const int fd = open_file(path, O_RDONLY);
+    if (fd < 0) {
+        fail("MappedFile: cannot open", path);
+    }
+    void *data = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+    const int error = errno;
+    close_fd(fd);
+    if (data == MAP_FAILED) { // NOLINT
+        errno = error;
+        fail("MappedFile: cannot map", path);
+    }
+    _data = static_cast<const std::byte *>(data);
+#endif
+}
+
+Lines::Storage::MappedFile::MappedFile(MappedFile &&other) noexcept
+    : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)) {}
+
+auto Lines::Storage::MappedFile::operator=(MappedFile &&other) noexcept -> MappedFile & {
+    if (this != &other) {
+        MappedFile old{std::move(*this)};
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+    }
+    return *this;
+}
+
+Lines::Storage::MappedFile::~MappedFile() {
+    if (_data == nullptr) {
+        return;
+    }
+#if defined(LINES_WINDOWSNT)
+    UnmapViewOfFile(_data);
+#else
+    ::munmap(const_cast<std::byte *>(_data), _size); // NOLINT
+#endif
+}
+
+auto Lines::Storage::read_file(const std::filesystem::path &path) -> std::vector<std::byte> {
+    File file{path, File::Mode::Read};
+    std::vector<std::byte> bytes(std::filesystem::file_size(path));
+    std::size_t done = 0;
+    while (done < bytes.size()) {
+        const std::size_t count = file.read(std::span{bytes}.subspan(done));
+        if (count == 0) {
+            bytes.resize(done); // the file shrank while reading
+            break;
+        }
+        done += count;
+    }
+    return bytes;
+}
+
+void Lines::Storage::sync_directory(const std::filesystem::path &dir) {
+#if defined(LINES_WINDOWSNT)
+    (void)dir;
+#else
+    const int fd = open_file(dir, O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        fail("Storage::sync_directory: cannot open", dir);
+    }
+    const int result = ::fsync(fd);
+    close_fd(fd);
+    if (result != 0) {
+        fail("Storage::sync_directory", dir);
+    }
+#endif
+}
+
+void Lines::Storage::write_file_atomically(const std::filesystem::path &path,
+                                           std::span<const std::byte> bytes) {
+    std::filesystem::path temp = path;
+    temp += ".tmp";
+    {
+        File file{temp, File::Mode::Truncate};
+        file.write(bytes);
+        file.sync();
+        file.close();
+    }
+    std::filesystem::rename(temp, path);
+    sync_directory(path.has_parent_path() ? path.parent_path() : std::filesystem::path{"."});
+}
@@ -0,0 +1,717 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/journal.hpp"
+
+#include "lines/detail/endian.hpp"
+#include "lines/roadmaps/roadmaps_algorithms.hpp"
+#include "lines/storage/checksum.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <ranges>
+#include <string>
+#include <string_view>
+
+namespace {
+using Lines::detail::append_le;
+using Lines::detail::load_le;
+using Lines::detail::store_le;
+using namespace Lines;
+using namespace Lines::Storage;
+using Generation = Journal::Generation;
+
+LINES_CONSTEXPR std::string_view LOG_MAGIC = "LNWL";
+LINES_CONSTEXPR std::size_t LOG_HEADER_SIZE = 16;
+LINES_CONSTEXPR std::size_t FRAME_HEADER_SIZE = 8;
+LINES_CONSTEXPR std::uint8_t STATE_COUNT = 4;
+LINES_CONSTEXPR std::uint8_t WEEKDAY_COUNT = 7;
+
+enum class Record : std::uint8_t {
+    TaskAdded = 1,
+    TaskTitle = 2,
+    TaskDescription = 3,
+    TaskTags = 4,
+    TaskDeadline = 5,
+    TaskCompletion = 6,
+    TaskRepeatRule = 7,
+    RoadmapAdded = 8,
+    NodeAdded = 9,
+    NodeRemoved = 10,
+    NodeState = 11,
+};
+
+enum class RuleKind : std::uint8_t { None = 0, EveryUnit = 1, EveryWeekday = 2 };
+
+// Record payload builder, fields are little-endian and strings are length
+// prefixed
+class Encoder {
+    std::vector<std::byte> _bytes;
+
+  public:
+    explicit Encoder(Record type) { _bytes.push_back(static_cast<std::byte>(type)); }
+
+    auto u8(std::uint8_t value) -> Encoder & {
+        _bytes.push_back(static_cast<std::byte>(value));
+        return *this;
+    }
+
+    auto u32(std::uint32_t value) -> Encoder & {
+        append_le(_bytes, value);
+        return *this;
+    }
+
+    auto u64(std::uint64_t value) -> Encoder & {
+        append_le(_bytes, value);
+        return *this;
+    }
+
+    auto string(std::string_view str) -> Encoder & {
+        u32(static_cast<std::uint32_t>(str.size()));
+        const auto bytes = std::as_bytes(std::span{str.data(), str.size()});
+        _bytes.insert(_bytes.end(), bytes.begin(), bytes.end());
+        return *this;
+    }
+
+    auto optional_string(const std::optional<std::pmr::string> &str) -> Encoder & {
+        u8(str ? 1 : 0);
+        return str ? string(*str) : *this;
+    }
+
+    auto tags(const Tags &tags) -> Encoder & {
+        u32(static_cast<std::uint32_t>(tags.size()));
+        for (const auto &tag : tags) {
+            string(tag);
+        }
+        return *this;
+    }
+
+    auto time(const std::optional<Temporal::TimePoint> &tp) -> Encoder & {
+        u8(tp ? 1 : 0);
+        return tp ? u64(static_cast<std::uint64_t>(tp->time_since_epoch().count())) : *this;
+    }
+
+    auto rule(const std::optional<TaskRepeatRule> &rule) -> Encoder & {
+        if (!rule) {
+            return u8(static_cast<std::uint8_t>(RuleKind::None));
+        }
+        if (const auto *unit = std::get_if<TaskRepeat::EveryUnit>(&rule->repeat_type)) {
+            u8(static_cast<std::uint8_t>(RuleKind::EveryUnit));
+            u64(static_cast<std::uint64_t>(unit->interval.count()));
+            string(unit->unit_str);
+        } else {
+            std::uint8_t mask = 0;
+            for (const auto day : std::get<TaskRepeat::EveryWeekday>(rule->repeat_type).weekdays) {
+                mask |= static_cast<std::uint8_t>(1U << static_cast<std::uint8_t>(day));
+            }
+            u8(static_cast<std::uint8_t>(RuleKind::EveryWeekday));
+            u8(mask);
+        }
+        return time(rule->end);
+    }
+
+    template <typename Item> auto info(const Item &item) -> Encoder & {
+        string(item.info().title);
+        optional_string(item.info().description);
+        return tags(item.info().tags);
+    }
+
+    auto task(const Task &task) -> Encoder & {
+        info(task);
+        time(task.deadline());
+        u8(task.completed() ? 1 : 0);
+        return rule(task.repeat_rule());
+    }
+
+    auto node(const RoadmapNode &node) -> Encoder & {
+        u64(node.id());
+        u64(Roadmap::is_root(node.id()) ? 0 : node.parent().lock()->id());
+        u8(static_cast<std::uint8_t>(node.state()));
+        return info(node);
+    }
+
+    LINES_NODISCARD auto bytes() const -> const std::vector<std::byte> & { return _bytes; }
+};
+
+// Reads what Encoder wrote, a record that ends early throws
+class Decoder {
+    std::span<const std::byte> _bytes;
+
+    auto take(std::size_t size) -> const std::byte * {
+        if (size > _bytes.size()) {
+            throw SnapshotError("Journal::recover: record ends early");
+        }
+        const std::byte *data = _bytes.data();
+        _bytes = _bytes.subspan(size);
+        return data;
+    }
+
+  public:
+    explicit Decoder(std::span<const std::byte> bytes) : _bytes(bytes) {}
+
+    auto u8() -> std::uint8_t { return static_cast<std::uint8_t>(*take(1)); }
+    auto u32() -> std::uint32_t { return load_le<std::uint32_t>(take(sizeof(std::uint32_t))); }
+    auto u64() -> std::uint64_t { return load_le<std::uint64_t>(take(sizeof(std::uint64_t))); }
+
+    auto string() -> std::string_view {
+        const std::size_t size = u32();
+        return {reinterpret_cast<const char *>(take(size)), size}; // NOLINT
+    }
+
+    auto optional_string() -> std::optional<std::string_view> {
+        if (u8() == 0) {
+            return std::nullopt;
+        }
+        return string();
+    }
+
+    auto tags() -> Tags {
+        Tags tags;
+        const std::size_t count = u32();
+        for (std::size_t i = 0; i < count; ++i) {
+            tags.emplace_back(string());
+        }
+        return tags;
+    }
+
+    auto time() -> std::optional<Temporal::TimePoint> {
+        if (u8() == 0) {
+            return std::nullopt;
+        }
+        return Temporal::TimePoint{Temporal::Seconds{static_cast<std::int64_t>(u64())}};
+    }
+
+    auto rule() -> std::optional<TaskRepeatRule> {
+        TaskRepeatRule::RepeatType type;
+        switch (static_cast<RuleKind>(u8())) {
+        case RuleKind::None:
+            return std::nullopt;
+        case RuleKind::EveryUnit: {
+            const Temporal::Seconds interval{static_cast<std::int64_t>(u64())};
+            type = TaskRepeat::EveryUnit{.interval = interval,
+                                         .unit_str = std::pmr::string(string())};
+            break;
+        }
+        case RuleKind::EveryWeekday: {
+            const std::uint8_t mask = u8();
+            std::pmr::vector<Temporal::Weekday> weekdays;
+            for (std::uint8_t day = 0; day < WEEKDAY_COUNT; ++day) {
+                if ((mask & (1U << day)) != 0) {
+                    weekdays.push_back(static_cast<Temporal::Weekday>(day));
+                }
+            }
+            type = TaskRepeat::EveryWeekday{.weekdays = std::move(weekdays)};
+            break;
+        }
+        default:
+            throw SnapshotError("Journal::recover: unknown repeat rule kind");
+        }
+        return TaskRepeatRule{.repeat_type = std::move(type), .end = time()};
+    }
+
+    template <typename Info> auto info() -> Info {
+        const std::string_view title = string();
+        const auto description = optional_string();
+        Info info{title, description};
+        info.tags = tags();
+        return info;
+    }
+
+    auto task() -> Task {
+        auto info = this->info<TaskInfo>();
+        const auto deadline = time();
+        const bool completed = u8() != 0;
+        Task task{std::move(info), rule()};
+        task.set_deadline(deadline);
+        if (completed) {
+            task.complete();
+        }
+        return task;
+    }
+
+    auto state() -> RoadmapNode::State {
+        const std::uint8_t state = u8();
+        if (state >= STATE_COUNT) {
+            throw SnapshotError("Journal::recover: unknown node state");
+        }
+        return static_cast<RoadmapNode::State>(state);
+    }
+};
+
+auto log_path(const std::filesystem::path &dir, Generation generation) -> std::filesystem::path {
+    return dir / ("journal-" + std::to_string(generation) + ".log");
+}
+
+auto snapshot_path(const std::filesystem::path &dir, Generation generation)
+    -> std::filesystem::path {
+    return dir / ("snapshot-" + std::to_string(generation));
+}
+
+// Parses "<prefix><generation><suffix>", anything else is not ours
+auto parse_generation(std::string_view name, std::string_view prefix, std::string_view suffix)
+    -> std::optional<Generation> {
+    if (!name.starts_with(prefix) || !name.ends_with(suffix) ||
+        name.size() == prefix.size() + suffix.size()) {
+        return std::nullopt;
+    }
+    const std::string_view digits =
+        name.substr(prefix.size(), name.size() - prefix.size() - suffix.size());
+    Generation generation{};
+    const auto [end, error] =
+        std::from_chars(digits.data(), digits.data() + digits.size(), generation);
+    if (error != std::errc{} || end != digits.data() + digits.size()) {
+        return std::nullopt;
+    }
+    return generation;
+}
+
+struct Generations {
+    std::vector<Generation> snapshots;
+    std::vector<Generation> logs;
+
+    LINES_NODISCARD auto newest() const -> Generation {
+        Generation newest = 0;
+        for (const auto &list : {snapshots, logs}) {
+            if (!list.empty()) {
+                newest = std::max(newest, list.back());
+            }
+        }
+        return newest;
+    }
+};
+
+auto scan(const std::filesystem::path &dir) -> Generations {
+    Generations found;
+    if (!std::filesystem::exists(dir)) {
+        return found;
+    }
+    for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+        const std::string name = entry.path().filename().string();
+        if (const auto generation = parse_generation(name, "snapshot-", "")) {
+            found.snapshots.push_back(*generation);
+        } else if (const auto log = parse_generation(name, "journal-", ".log")) {
+            found.logs.push_back(*log);
+        }
+    }
+    std::ranges::sort(found.snapshots);
+    std::ranges::sort(found.logs);
+    return found;
+}
+
+auto task_at(Workspace &workspace, std::uint32_t id) -> Task & {
+    if (id >= workspace.tasks.size()) {
+        throw SnapshotError("Journal::recover: record refers to an unknown task");
+    }
+    return workspace.tasks[id];
+}
+
+auto roadmap_at(Workspace &workspace, std::uint32_t id) -> Roadmap & {
+    if (id >= workspace.roadmaps.size()) {
+        throw SnapshotError("Journal::recover: record refers to an unknown roadmap");
+    }
+    return workspace.roadmaps[id];
+}
+
+auto node_at(Roadmap &rmap, std::uint64_t id) -> std::shared_ptr<RoadmapNode> {
+    auto node = id < rmap.size() ? rmap[id].lock() : nullptr;
+    if (!node) {
+        throw SnapshotError("Journal::recover: record refers to an unknown node");
+    }
+    return node;
+}
+
+// Records may replace an existing item or append the next one
+template <typename T> void place(std::vector<T> &items, std::uint32_t id, T &&item) {
+    if (id < items.size()) {
+        items[id] = std::move(item);
+    } else if (id == items.size()) {
+        items.push_back(std::move(item));
+    } else {
+        throw SnapshotError("Journal::recover: record skips an id");
+    }
+}
+
+void add_node(Roadmap &rmap, Decoder &decoder) {
+    const std::uint64_t id = decoder.u64();
+    const auto parent = node_at(rmap, decoder.u64());
+    const auto state = decoder.state();
+    auto node = rmap.add_node(parent, decoder.info<RoadmapNodeInfo>(), id);
+    node.lock()->set_state(state);
+}
+
+void apply(Workspace &workspace, Decoder &decoder) {
+    switch (static_cast<Record>(decoder.u8())) {
+    case Record::TaskAdded: {
+        const std::uint32_t id = decoder.u32();
+        place(workspace.tasks, id, decoder.task());
+        break;
+    }
+    case Record::TaskTitle: {
+        Task &task = task_at(workspace, decoder.u32());
+        task.set_title(decoder.string());
+        break;
+    }
+    case Record::TaskDescription: {
+        Task &task = task_at(workspace, decoder.u32());
+        task.set_description(decoder.optional_string());
+        break;
+    }
+    case Record::TaskTags: {
+        Task &task = task_at(workspace, decoder.u32());
+        task.set_tags(decoder.tags());
+        break;
+    }
+    case Record::TaskDeadline: {
+        Task &task = task_at(workspace, decoder.u32());
+        task.set_deadline(decoder.time());
+        break;
+    }
+    case Record::TaskCompletion: {
+        Task &task = task_at(workspace, decoder.u32());
+        decoder.u8() != 0 ? task.complete() : task.uncomplete();
+        break;
+    }
+    case Record::TaskRepeatRule: {
+        Task &task = task_at(workspace, decoder.u32());
+        task.set_repeat_rule(decoder.rule());
+        break;
+    }
+    case Record::RoadmapAdded: {
+        const std::uint32_t id = decoder.u32();
+        place(workspace.roadmaps, id, Roadmap{decoder.info<RoadmapInfo>()});
+        break;
+    }
+    case Record::NodeAdded:
+        add_node(roadmap_at(workspace, decoder.u32()), decoder);
+        break;
+    case Record::NodeRemoved: {
+        Roadmap &rmap = roadmap_at(workspace, decoder.u32());
+        rmap.remove_node(node_at(rmap, decoder.u64())->id());
+        break;
+    }
+    case Record::NodeState: {
+        Roadmap &rmap = roadmap_at(workspace, decoder.u32());
+        const auto node = node_at(rmap, decoder.u64());
+        node->set_state(decoder.state());
+        break;
+    }
+    default:
+        throw SnapshotError("Journal::recover: unknown record type");
+    }
+}
+
+// Applies the intact prefix of a log
+void replay(Workspace &workspace, std::span<const std::byte> log) {
+    if (log.size() < LOG_HEADER_SIZE ||
+        std::memcmp(log.data(), LOG_MAGIC.data(), LOG_MAGIC.size()) != 0) {
+        return; // the header itself was torn
+    }
+    if (load_le<std::uint16_t>(log.data() + LOG_MAGIC.size()) != JOURNAL_VERSION) {
+        throw SnapshotError("Journal::recover: unsupported journal version");
+    }
+    log = log.subspan(LOG_HEADER_SIZE);
+    while (log.size() >= FRAME_HEADER_SIZE) {
+        const std::size_t size = load_le<std::uint32_t>(log.data());
+        if (size > log.size() - FRAME_HEADER_SIZE) {
+            break;
+        }
+        const auto payload = log.subspan(FRAME_HEADER_SIZE, size);
+        if (crc32c(payload) != load_le<std::uint32_t>(log.data() + sizeof(std::uint32_t))) {
+            break;
+        }
+        Decoder decoder{payload};
+        try {
+            apply(workspace, decoder);
+        } catch (const std::logic_error &error) {
+            throw SnapshotError(std::string("Journal::recover: ") + error.what());
+        }
+        log = log.subspan(FRAME_HEADER_SIZE + size);
+    }
+}
+
+// State after every log older than `limit`
+auto load(const std::filesystem::path &dir, Generation limit) -> Workspace {
+    const Generations found = scan(dir);
+    Workspace workspace;
+    Generation base = 0;
+    for (const auto generation : found.snapshots | std::views::reverse) {
+        if (generation <= limit) {
+            base = generation;
+            workspace = read_workspace_snapshot(read_file(snapshot_path(dir, generation)));
+            break;
+        }
+    }
+    for (const auto generation : found.logs) {
+        if (generation >= base && generation < limit) {
+            replay(workspace, read_file(log_path(dir, generation)));
+        }
+    }
+    return workspace;
+}
+
+// Folds everything before log `target` into snapshot `target`
+void compact_directory(const std::filesystem::path &dir, Generation target) {
+    write_file_atomically(snapshot_path(dir, target),
+                          write_workspace_snapshot(load(dir, target)));
+    const Generations found = scan(dir);
+    for (const auto generation : found.snapshots) {
+        if (generation < target) {
+            std::filesystem::remove(snapshot_path(dir, generation));
+        }
+    }
+    for (const auto generation : found.logs) {
+        if (generation < target) {
+            std::filesystem::remove(log_path(dir, generation));
+        }
+    }
+    sync_directory(dir);
+}
+} // namespace
+
+Lines::Storage::Journal::Journal(std::filesystem::path dir, JournalOptions options)
+    : _dir(std::move(dir)), _options(options) {
+    std::filesystem::create_directories(_dir);
+    open_log(scan(_dir).newest() + 1);
+    if (_options.sync == JournalOptions::SyncPolicy::Interval) {
+        _syncer = std::jthread([this](std::stop_token stop) { run_syncer(std::move(stop)); });
+    }
+}
+
+Lines::Storage::Journal::~Journal() {
+    if (_syncer.joinable()) {
+        _syncer.request_stop();
+        _syncer.join();
+    }
+    try {
+        commit();
+        if (_options.sync != JournalOptions::SyncPolicy::Never) {
+            _log.sync();
+        }
+    } catch (...) { // NOLINT(bugprone-empty-catch)
+        // Records that could not be written are lost like on a crash
+    }
+    if (_compaction.joinable()) {
+        _compaction.join();
+    }
+}
+
+void Lines::Storage::Journal::open_log(Generation generation) {
+    const std::filesystem::path path = log_path(_dir, generation);
+    File log{path, File::Mode::Truncate};
+    std::array<std::byte, LOG_HEADER_SIZE> header{};
+    std::memcpy(header.data(), LOG_MAGIC.data(), LOG_MAGIC.size());
+    store_le(header.data() + LOG_MAGIC.size(), JOURNAL_VERSION);
+    store_le(header.data() + LOG_MAGIC.size() + sizeof(std::uint32_t), generation);
+    log.write(header);
+    log.sync();
+    sync_directory(_dir);
+    _log = std::move(log);
+    _generation = generation;
+    _last_sync = std::chrono::steady_clock::now();
+}
+
+void Lines::Storage::Journal::append(const std::vector<std::byte> &payload) {
+    const std::lock_guard lock{_mutex};
+    append_le(_pending, static_cast<std::uint32_t>(payload.size()));
+    append_le(_pending, crc32c(payload));
+    _pending.insert(_pending.end(), payload.begin(), payload.end());
+    ++_appended;
+}
+
+void Lines::Storage::Journal::commit() {
+    std::unique_lock lock{_mutex};
+    const std::uint64_t target = _appended;
+    while (_durable < target) {
+        if (_failure) {
+            std::rethrow_exception(_failure);
+        }
+        if (_writing) {
+            _committed.wait(lock);
+            continue;
+        }
+        // Become the leader and write every record appended so far
+        _writing = true;
+        const std::vector<std::byte> batch = std::exchange(_pending, {});
+        const std::uint64_t batch_end = _appended;
+        lock.unlock();
+        bool synced = false;
+        const auto now = std::chrono::steady_clock::now();
+        try {
+            _log.write(batch);
+            if (_options.sync == JournalOptions::SyncPolicy::EveryCommit ||
+                (_options.sync == JournalOptions::SyncPolicy::Interval &&
+                 now - _last_sync >= _options.sync_interval)) {
+                _log.sync();
+                synced = true;
+            }
+        } catch (...) {
+            lock.lock();
+            _failure = std::current_exception();
+            _writing = false;
+            _committed.notify_all();
+            throw;
+        }
+        lock.lock();
+        _writing = false;
+        _durable = batch_end;
+        if (synced) {
+            _last_sync = now;
+            _unsynced = false;
+        } else if (_options.sync == JournalOptions::SyncPolicy::Interval) {
+            _unsynced = true;
+            _sync_wanted.notify_all();
+        }
+        _committed.notify_all();
+    }
+    if (_failure) {
+        std::rethrow_exception(_failure);
+    }
+}
+
+void Lines::Storage::Journal::run_syncer(std::stop_token stop) {
+    std::unique_lock lock{_mutex};
+    while (!stop.stop_requested()) {
+        if (!_unsynced || _writing || _failure) {
+            // Commit leaders notify when they leave written records unsynced
+            _sync_wanted.wait(lock, stop, [this] { return _unsynced && !_writing && !_failure; });
+            continue;
+        }
+        const auto due = _last_sync + _options.sync_interval;
+        if (std::chrono::steady_clock::now() < due) {
+            _sync_wanted.wait_until(lock, stop, due, [] { return false; });
+            continue;
+        }
+        // Sync as the commit leader, compact() may not swap the log meanwhile
+        _writing = true;
+        _unsynced = false;
+        lock.unlock();
+        std::exception_ptr failure;
+        try {
+            _log.sync();
+        } catch (...) {
+            failure = std::current_exception();
+        }
+        lock.lock();
+        _writing = false;
+        if (failure) {
+            _failure = failure;
+        } else {
+            _last_sync = std::chrono::steady_clock::now();
+        }
+        _committed.notify_all();
+    }
+}
+
+void Lines::Storage::Journal::compact() {
+    wait_for_compaction();
+    Generation target{};
+    {
+        std::unique_lock lock{_mutex};
+        _committed.wait(lock, [this] { return !_writing; });
+        if (_failure) {
+            std::rethrow_exception(_failure);
+        }
+        _log.write(std::exchange(_pending, {}));
+        _durable = _appended;
+        _log.sync();
+        _log.close();
+        open_log(_generation + 1);
+        _unsynced = false;
+        target = _generation;
+    }
+    _compaction = std::thread([this, target] {
+        try {
+            compact_directory(_dir, target);
+        } catch (...) {
+            _compaction_error = std::current_exception();
+        }
+    });
+}
+
+void Lines::Storage::Journal::wait_for_compaction() {
+    if (_compaction.joinable()) {
+        _compaction.join();
+    }
+    if (_compaction_error) {
+        std::rethrow_exception(std::exchange(_compaction_error, nullptr));
+    }
+}
+
+auto Lines::Storage::Journal::recover(const std::filesystem::path &dir) -> Workspace {
+    return load(dir, std::numeric_limits<Generation>::max());
+}
+
+void Lines::Storage::Journal::task_added(TaskID id, const Task &task) {
+    append(Encoder{Record::TaskAdded}.u32(id).task(task).bytes());
+}
+
+void Lines::Storage::Journal::roadmap_added(RoadmapID id, const Roadmap &rmap) {
+    append(Encoder{Record::RoadmapAdded}.u32(id).info(rmap).bytes());
+    Roadmaps::dfs_foreach(rmap, [&](const RoadmapNode::NodePtr &ptr) {
+        const auto node = ptr.lock();
+        if (!Roadmap::is_root(node->id())) {
+            on_node_added(id, *node);
+        }
+    });
+}
+
+void Lines::Storage::Journal::on_title_changed(TaskID id, const Task &task,
+                                               const std::pmr::string & /*old_title*/) {
+    append(Encoder{Record::TaskTitle}.u32(id).string(task.title()).bytes());
+}
+
+void Lines::Storage::Journal::on_description_changed(
+    TaskID id, const Task &task, const std::optional<std::pmr::string> & /*old_description*/) {
+    append(Encoder{Record::TaskDescription}
+               .u32(id)
+               .optional_string(task.info().description)
+               .bytes());
+}
+
+void Lines::Storage::Journal::on_tags_changed(TaskID id, const Task &task,
+                                              const Tags & /*old_tags*/) {
+    append(Encoder{Record::TaskTags}.u32(id).tags(task.info().tags).bytes());
+}
+
+void Lines::Storage::Journal::on_deadline_changed(
+    TaskID id, const Task &task, const std::optional<Temporal::TimePoint> & /*old_deadline*/) {
+    append(Encoder{Record::TaskDeadline}.u32(id).time(task.deadline()).bytes());
+}
+
+void Lines::Storage::Journal::on_completion_changed(TaskID id, const Task &task) {
+    append(Encoder{Record::TaskCompletion}.u32(id).u8(task.completed() ? 1 : 0).bytes());
+}
+
+void Lines::Storage::Journal::on_repeat_rule_changed(TaskID id, const Task &task) {
+    append(Encoder{Record::TaskRepeatRule}.u32(id).rule(task.repeat_rule()).bytes());
+}
+
+void Lines::Storage::Journal::on_node_added(RoadmapID id, const RoadmapNode &node) {
+    append(Encoder{Record::NodeAdded}.u32(id).node(node).bytes());
+}
+
+void Lines::Storage::Journal::on_node_removed(RoadmapID id, const RoadmapNode &node) {
+    append(Encoder{Record::NodeRemoved}.u32(id).u64(node.id()).bytes());
+}
+
+void Lines::Storage::Journal::on_node_state_changed(RoadmapID id, const RoadmapNode &node,
+                                                    RoadmapNode::State /*old_state*/) {
+    append(Encoder{Record::NodeState}
+               .u32(id)
+               .u64(node.id())
+               .u8(static_cast<std::uint8_t>(node.state()))
+               .bytes());
+}
@@ -0,0 +1,547 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/json.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <utility>
+
+namespace {
+LINES_CONSTEXPR int END_OF_INPUT = -1;
+LINES_CONSTEXPR unsigned char FIRST_PRINTABLE = 0x20;
+
+auto needs_escape(char chr) -> bool {
+    return chr == '"' || chr == '\\' || static_cast<unsigned char>(chr) < FIRST_PRINTABLE;
+}
+
+auto is_digit(int chr) -> bool { return chr >= '0' && chr <= '9'; }
+
+auto hex_value(int chr) -> int {
+    if (is_digit(chr)) {
+        return chr - '0';
+    }
+    if (chr >= 'a' && chr <= 'f') {
+        return chr - 'a' + 10; // NOLINT
+    }
+    if (chr >= 'A' && chr <= 'F') {
+        return chr - 'A' + 10; // NOLINT
+    }
+    return -1;
+}
+
+// -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+auto valid_number(std::string_view num) -> bool {
+    std::size_t i = 0;
+    const auto digits = [&] {
+        const std::size_t start = i;
+        while (i < num.size() && is_digit(num[i])) {
+            ++i;
+        }
+        return i > start;
+    };
+    if (i < num.size() && num[i] == '-') {
+        ++i;
+    }
+    if (i < num.size() && num[i] == '0') {
+        ++i;
+    } else if (!digits()) {
+        return false;
+    }
+    if (i < num.size() && num[i] == '.') {
+        ++i;
+        if (!digits()) {
+            return false;
+        }
+    }
+    if (i < num.size() && (num[i] == 'e' || num[i] == 'E')) {
+        ++i;
+        if (i < num.size() && (num[i] == '+' || num[i] == '-')) {
+            ++i;
+        }
+        if (!digits()) {
+            return false;
+        }
+    }
+    return i == num.size();
+}
+
+void append_utf8(std::pmr::string &out, std::uint32_t code) {
+    // NOLINTBEGIN(readability-magic-numbers)
+    if (code < 0x80) {
+        out.push_back(static_cast<char>(code));
+    } else if (code < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else if (code < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+    // NOLINTEND(readability-magic-numbers)
+}
+} // namespace
+
+// JsonWriter
+
+Lines::Storage::JsonWriter::JsonWriter(std::ostream &out) : _out(out) {
+    _buffer.reserve(BUFFER_SIZE);
+}
+
+Lines::Storage::JsonWriter::~JsonWriter() { flush(); }
+
+void Lines::Storage::JsonWriter::flush() {
+    _out.write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+    _buffer.clear();
+}
+
+void Lines::Storage::JsonWriter::put(char chr) {
+    _buffer.push_back(chr);
+    if (_buffer.size() >= BUFFER_SIZE) {
+        flush();
+    }
+}
+
+void Lines::Storage::JsonWriter::put(std::string_view str) {
+    _buffer.append(str);
+    if (_buffer.size() >= BUFFER_SIZE) {
+        flush();
+    }
+}
+
+void Lines::Storage::JsonWriter::separate() {
+    if (_after_key) {
+        _after_key = false;
+        return;
+    }
+    if (!_empty.empty()) {
+        if (!_empty.back()) {
+            put(',');
+        }
+        _empty.back() = false;
+    }
+}
+
+void Lines::Storage::JsonWriter::quoted(std::string_view str) {
+    put('"');
+    while (!str.empty()) {
+        const auto special = std::ranges::find_if(str, needs_escape);
+        const auto plain = static_cast<std::size_t>(special - str.begin());
+        put(str.substr(0, plain));
+        if (plain == str.size()) {
+            break;
+        }
+        switch (const char chr = str[plain]) {
+        case '"':
+            put("\\\"");
+            break;
+        case '\\':
+            put("\\\\");
+            break;
+        case '\n':
+            put("\\n");
+            break;
+        case '\r':
+            put("\\r");
+            break;
+        case '\t':
+            put("\\t");
+            break;
+        case '\b':
+            put("\\b");
+            break;
+        case '\f':
+            put("\\f");
+            break;
+        default: {
+            LINES_CONSTEXPR std::string_view hex = "0123456789abcdef";
+            const auto code = static_cast<unsigned char>(chr);
+            const std::array<char, 6> escaped = {'\\', 'u', '0', '0', hex[code >> 4U],
+                                                 hex[code & 0xFU]};
+            put(std::string_view{escaped.data(), escaped.size()});
+        }
+        }
+        str.remove_prefix(plain + 1);
+    }
+    put('"');
+}
+
+auto Lines::Storage::JsonWriter::begin_object() -> JsonWriter & {
+    separate();
+    put('{');
+    _empty.push_back(true);
+    return *this;
+}
+
+auto Lines::Storage::JsonWriter::end_object() -> JsonWriter & {
+    LINES_ASSERT(!_empty.empty() && !_after_key);
+    _empty.pop_back();
+    put('}');
+    return *this;
+}
+
+auto Lines::Storage::JsonWriter::begin_array() -> JsonWriter & {
+    separate();
+    put('[');
+    _empty.push_back(true);
+    return *this;
+}
+
+auto Lines::Storage::JsonWriter::end_array() -> JsonWriter & {
+    LINES_ASSERT(!_empty.empty() && !_after_key);
+    _empty.pop_back();
+    put(']');
+    return *this;
+}
+
+auto Lines::Storage::JsonWriter::key(std::string_view name) -> JsonWriter & {
+    LINES_ASSERT(!_after_key);
+    separate();
+    quoted(name);
+    put(':');
+    _after_key = true;
+    return *this;
+}
+
+auto Lines::Storage::JsonWriter::string(std::string_view value) -> JsonWriter & {
+    separate();
+    quoted(value);
+    return *this;
+}
+
+auto Lines::Storage::JsonWriter::integer(std::int64_t value) -> JsonWriter & {
+    separate();
+    std::array<char, 24> digits{}; // NOLINT
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    put(std::string_view{digits.data(), result.ptr});
+    return *this;
+}
+
+auto Lines::Storage::JsonWriter::boolean(bool value) -> JsonWriter & {
+    separate();
+    put(value ? "true" : "false");
+    return *this;
+}
+
+auto Lines::Storage::JsonWriter::null() -> JsonWriter & {
+    separate();
+    put("null");
+    return *this;
+}
+
+// JsonReader
+
+Lines::Storage::JsonReader::JsonReader(std::istream &in, const allocator_type &alloc)
+    : _in(in), _buffer(BUFFER_SIZE), _string(alloc) {}
+
+void Lines::Storage::JsonReader::fail(std::string_view message) const {
+    throw JsonError("JsonReader: " + std::string(message) + " at offset " +
+                    std::to_string(offset()));
+}
+
+auto Lines::Storage::JsonReader::fill() -> bool {
+    if (_pos < _end) {
+        return true;
+    }
+    _offset += _end;
+    _pos = 0;
+    _in.read(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+    _end = static_cast<std::size_t>(_in.gcount());
+    return _end > 0;
+}
+
+auto Lines::Storage::JsonReader::peek_char() -> int {
+    return fill() ? static_cast<unsigned char>(_buffer[_pos]) : END_OF_INPUT;
+}
+
+auto Lines::Storage::JsonReader::get_char() -> int {
+    const int chr = peek_char();
+    if (chr != END_OF_INPUT) {
+        ++_pos;
+    }
+    return chr;
+}
+
+auto Lines::Storage::JsonReader::skip_whitespace() -> int {
+    for (;;) {
+        const int chr = peek_char();
+        if (chr != ' ' && chr != '\n' && chr != '\r' && chr != '\t') {
+            return chr;
+        }
+        ++_pos;
+    }
+}
+
+void Lines::Storage::JsonReader::expect_literal(std::string_view rest) {
+    for (const char expected : rest) {
+        if (get_char() != expected) {
+            fail("invalid literal");
+        }
+    }
+}
+
+void Lines::Storage::JsonReader::read_string() {
+    _string.clear();
+    for (;;) {
+        if (!fill()) {
+            fail("unterminated string");
+        }
+        const char *begin = _buffer.data() + _pos;
+        const char *end = _buffer.data() + _end;
+        const char *special = std::find_if(begin, end, needs_escape);
+        _string.append(begin, special);
+        _pos += static_cast<std::size_t>(special - begin);
+        if (special == end) {
+            continue;
+        }
+        ++_pos;
+        if (*special == '"') {
+            return;
+        }
+        if (*special != '\\') {
+            fail("unescaped control character in string");
+        }
+        read_escape();
+    }
+}
+
+void Lines::Storage::JsonReader::read_escape() {
+    const auto hex4 = [this] {
+        std::uint32_t code = 0;
+        for (int i = 0; i < 4; ++i) {
+            const int digit = hex_value(get_char());
+            if (digit < 0) {
+                fail("invalid \\u escape");
+            }
+            code = (code << 4U) | static_cast<std::uint32_t>(digit);
+        }
+        return code;
+    };
+    switch (get_char()) {
+    case '"':
+        _string.push_back('"');
+        break;
+    case '\\':
+        _string.push_back('\\');
+        break;
+    case '/':
+        _string.push_back('/');
+        break;
+    case 'b':
+        _string.push_back('\b');
+        break;
+    case 'f':
+        _string.push_back('\f');
+        break;
+    case 'n':
+        _string.push_back('\n');
+        break;
+    case 'r':
+        _string.push_back('\r');
+        break;
+    case 't':
+        _string.push_back('\t');
+        break;
+    case 'u': {
+        // NOLINTBEGIN(readability-magic-numbers)
+        std::uint32_t code = hex4();
+        if (code >= 0xD800 && code <= 0xDBFF) {
+            if (get_char() != '\\' || get_char() != 'u') {
+                fail("unpaired surrogate");
+            }
+            const std::uint32_t low = hex4();
+            if (low < 0xDC00 || low > 0xDFFF) {
+                fail("unpaired surrogate");
+            }
+            code = 0x10000 + ((code - 0xD800) << 10U) + (low - 0xDC00);
+        } else if (code >= 0xDC00 && code <= 0xDFFF) {
+            fail("unpaired surrogate");
+        }
+        // NOLINTEND(readability-magic-numbers)
+        append_utf8(_string, code);
+        break;
+    }
+    default:
+        fail("invalid escape");
+    }
+}
+
+void Lines::Storage::JsonReader::read_number() {
+    _number.clear();
+    for (int chr = peek_char(); is_digit(chr) || chr == '-' || chr == '+' || chr == '.' ||
+                                chr == 'e' || chr == 'E';
+         chr = peek_char()) {
+        _number.push_back(static_cast<char>(chr));
+        ++_pos;
+    }
+    if (!valid_number(_number)) {
+        fail("invalid number");
+    }
+}
+
+void Lines::Storage::JsonReader::value_done() {
+    _expect = _stack.empty() ? Expect::Done : Expect::Separator;
+}
+
+auto Lines::Storage::JsonReader::read_token() -> JsonToken {
+    const int chr = skip_whitespace();
+    switch (_expect) {
+    case Expect::Done:
+        if (chr != END_OF_INPUT) {
+            fail("unexpected data after the document");
+        }
+        return JsonToken::End;
+    case Expect::Separator: {
+        const bool object = _stack.back() == '{';
+        if (chr == ',') {
+            ++_pos;
+            _expect = object ? Expect::Key : Expect::Value;
+            return read_token();
+        }
+        if (chr != (object ? '}' : ']')) {
+            fail("expected ',' or the end of the container");
+        }
+        ++_pos;
+        _stack.pop_back();
+        value_done();
+        return object ? JsonToken::EndObject : JsonToken::EndArray;
+    }
+    case Expect::FirstKey:
+    case Expect::Key:
+        if (chr == '}' && _expect == Expect::FirstKey) {
+            ++_pos;
+            _stack.pop_back();
+            value_done();
+            return JsonToken::EndObject;
+        }
+        if (chr != '"') {
+            fail("expected a key");
+        }
+        ++_pos;
+        read_string();
+        if (skip_whitespace() != ':') {
+            fail("expected ':'");
+        }
+        ++_pos;
+        _expect = Expect::Value;
+        return JsonToken::Key;
+    case Expect::FirstValue:
+    case Expect::Value:
+        break;
+    }
+
+    if (chr == ']' && _expect == Expect::FirstValue) {
+        ++_pos;
+        _stack.pop_back();
+        value_done();
+        return JsonToken::EndArray;
+    }
+    switch (chr) {
+    case '{':
+        ++_pos;
+        _stack.push_back('{');
+        _expect = Expect::FirstKey;
+        return JsonToken::BeginObject;
+    case '[':
+        ++_pos;
+        _stack.push_back('[');
+        _expect = Expect::FirstValue;
+        return JsonToken::BeginArray;
+    case '"':
+        ++_pos;
+        read_string();
+        value_done();
+        return JsonToken::String;
+    case 't':
+    case 'f':
+        ++_pos;
+        _boolean = chr == 't';
+        expect_literal(_boolean ? "rue" : "alse");
+        value_done();
+        return JsonToken::Boolean;
+    case 'n':
+        ++_pos;
+        expect_literal("ull");
+        value_done();
+        return JsonToken::Null;
+    case END_OF_INPUT:
+        fail("unexpected end of input");
+    default:
+        if (chr != '-' && !is_digit(chr)) {
+            fail("unexpected character");
+        }
+        read_number();
+        value_done();
+        return JsonToken::Number;
+    }
+}
+
+auto Lines::Storage::JsonReader::next() -> JsonToken {
+    if (_peeked) {
+        return *std::exchange(_peeked, std::nullopt);
+    }
+    return read_token();
+}
+
+auto Lines::Storage::JsonReader::peek() -> JsonToken {
+    if (!_peeked) {
+        _peeked = read_token();
+    }
+    return *_peeked;
+}
+
+auto Lines::Storage::JsonReader::take_string() -> std::pmr::string {
+    return std::exchange(_string, std::pmr::string(_string.get_allocator()));
+}
+
+auto Lines::Storage::JsonReader::integer() const -> std::int64_t {
+    std::int64_t value = 0;
+    const auto *end = _number.data() + _number.size();
+    const auto result = std::from_chars(_number.data(), end, value);
+    if (result.ec != std::errc{} || result.ptr != end) {
+        throw JsonError("JsonReader::integer: " + _number + " is not a 64-bit integer");
+    }
+    return value;
+}
+
+void Lines::Storage::JsonReader::skip() {
+    std::size_t depth = 0;
+    do {
+        switch (next()) {
+        case JsonToken::BeginObject:
+        case JsonToken::BeginArray:
+            ++depth;
+            break;
+        case JsonToken::EndObject:
+        case JsonToken::EndArray:
+            --depth;
+            break;
+        case JsonToken::End:
+            fail("unexpected end of input");
+        default:
+            break;
+        }
+    } while (depth > 0);
+}
+
+void Lines::Storage::JsonReader::expect(JsonToken token) {
+    if (next() != token) {
+        fail("unexpected token");
+    }
+}
@@ -0,0 +1,360 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/json_io.hpp"
+
+#include "lines/temporal/ymd.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace {
+using Lines::RoadmapNode;
+using Lines::Storage::JsonError;
+using Lines::Storage::JsonReader;
+using Lines::Storage::JsonToken;
+using Lines::Storage::JsonWriter;
+
+LINES_CONSTEXPR std::array<std::string_view, 4> STATE_NAMES = {"not_completed", "completed",
+                                                               "skipped", "in_progress"};
+LINES_CONSTEXPR std::int64_t WEEKDAY_COUNT = 7;
+
+auto state_name(RoadmapNode::State state) -> std::string_view {
+    return STATE_NAMES.at(static_cast<std::size_t>(state));
+}
+
+auto parse_state(std::string_view name) -> RoadmapNode::State {
+    for (std::size_t i = 0; i < STATE_NAMES.size(); ++i) {
+        if (STATE_NAMES[i] == name) {
+            return static_cast<RoadmapNode::State>(i);
+        }
+    }
+    throw JsonError("Storage::read_node: unknown state \"" + std::string(name) + "\"");
+}
+
+auto seconds(const Lines::Temporal::TimePoint &tp) -> std::int64_t {
+    return tp.time_since_epoch().count();
+}
+
+void write_info(JsonWriter &writer, std::string_view title,
+                const std::optional<std::pmr::string> &description, const Lines::Tags &tags) {
+    writer.key("title").string(title);
+    if (description) {
+        writer.key("description").string(*description);
+    }
+    if (!tags.empty()) {
+        writer.key("tags").begin_array();
+        for (const auto &tag : tags) {
+            writer.string(tag);
+        }
+        writer.end_array();
+    }
+}
+
+auto read_string(JsonReader &reader) -> std::pmr::string {
+    reader.expect(JsonToken::String);
+    return reader.take_string();
+}
+
+auto read_integer(JsonReader &reader) -> std::int64_t {
+    reader.expect(JsonToken::Number);
+    return reader.integer();
+}
+
+auto read_time_point(JsonReader &reader) -> Lines::Temporal::TimePoint {
+    return Lines::Temporal::TimePoint{Lines::Temporal::Seconds{read_integer(reader)}};
+}
+
+// Reads the elements of an array of `token` values, calling `read` on each
+template <typename Read> void read_array(JsonReader &reader, JsonToken token, Read read) {
+    reader.expect(JsonToken::BeginArray);
+    for (JsonToken next = reader.next(); next != JsonToken::EndArray; next = reader.next()) {
+        if (next != token) {
+            throw JsonError("Storage: unexpected array element at offset " +
+                            std::to_string(reader.offset()));
+        }
+        read();
+    }
+}
+
+void read_tags(JsonReader &reader, Lines::Tags &tags) {
+    read_array(reader, JsonToken::String, [&] { tags.push_back(reader.take_string()); });
+}
+
+// Handles the members shared by tasks, roadmaps and nodes, returns false
+// for any other key
+template <typename Info> auto read_info_member(JsonReader &reader, Info &info) -> bool {
+    const std::string_view key = reader.string();
+    if (key == "title") {
+        info.title = read_string(reader);
+    } else if (key == "description") {
+        if (reader.peek() == JsonToken::Null) {
+            reader.next();
+            info.description.reset();
+        } else {
+            info.description = read_string(reader);
+        }
+    } else if (key == "tags") {
+        info.tags.clear();
+        read_tags(reader, info.tags);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void require_title(const std::pmr::string &title, std::string_view what) {
+    if (title.empty()) {
+        throw JsonError("Storage::read_" + std::string(what) + ": missing title");
+    }
+}
+} // namespace
+
+void Lines::Storage::write_json(JsonWriter &writer, const TaskRepeatRule &rule) {
+    writer.begin_object();
+    if (const auto *unit = std::get_if<TaskRepeat::EveryUnit>(&rule.repeat_type)) {
+        writer.key("interval").integer(unit->interval.count());
+        writer.key("unit").string(unit->unit_str);
+    } else {
+        writer.key("weekdays").begin_array();
+        for (const auto day : std::get<TaskRepeat::EveryWeekday>(rule.repeat_type).weekdays) {
+            writer.integer(static_cast<std::int64_t>(day));
+        }
+        writer.end_array();
+    }
+    if (rule.end) {
+        writer.key("end").integer(seconds(*rule.end));
+    }
+    writer.end_object();
+}
+
+void Lines::Storage::write_json(JsonWriter &writer, const Task &task) {
+    writer.begin_object();
+    write_info(writer, task.info().title, task.info().description, task.info().tags);
+    if (task.deadline()) {
+        writer.key("deadline").integer(seconds(*task.deadline()));
+    }
+    writer.key("completed").boolean(task.completed());
+    if (task.repeat_rule()) {
+        writer.key("repeat");
+        write_json(writer, *task.repeat_rule());
+    }
+    writer.end_object();
+}
+
+void Lines::Storage::write_json(JsonWriter &writer, const RoadmapNode &node) {
+    // Explicit stack, deep roadmaps must not exhaust the call stack
+    struct Frame {
+        const RoadmapNode *node;
+        std::size_t next;
+    };
+    std::vector<Frame> stack;
+    const auto open = [&](const RoadmapNode &current) {
+        writer.begin_object();
+        write_info(writer, current.info().title, current.info().description, current.info().tags);
+        writer.key("state").string(state_name(current.state()));
+        if (current.children().empty()) {
+            writer.end_object();
+            return;
+        }
+        writer.key("children").begin_array();
+        stack.push_back({.node = &current, .next = 0});
+    };
+    open(node);
+    while (!stack.empty()) {
+        Frame &top = stack.back();
+        if (top.next < top.node->children().size()) {
+            open(*top.node->children()[top.next++].lock());
+            continue;
+        }
+        writer.end_array();
+        writer.end_object();
+        stack.pop_back();
+    }
+}
+
+void Lines::Storage::write_json(JsonWriter &writer, const Roadmap &rmap) {
+    writer.begin_object();
+    write_info(writer, rmap.info().title, rmap.info().description, rmap.info().tags);
+    writer.key("nodes").begin_array();
+    for (const auto &child : rmap.root().lock()->children()) {
+        write_json(writer, *child.lock());
+    }
+    writer.end_array();
+    writer.end_object();
+}
+
+auto Lines::Storage::read_repeat_rule(JsonReader &reader) -> TaskRepeatRule {
+    reader.expect(JsonToken::BeginObject);
+    std::optional<Temporal::Seconds> interval;
+    std::pmr::string unit(reader.get_allocator());
+    std::optional<std::pmr::vector<Temporal::Weekday>> weekdays;
+    std::optional<Temporal::TimePoint> end;
+    while (reader.next() == JsonToken::Key) {
+        const std::string_view key = reader.string();
+        if (key == "interval") {
+            interval = Temporal::Seconds{read_integer(reader)};
+        } else if (key == "unit") {
+            unit = read_string(reader);
+        } else if (key == "weekdays") {
+            weekdays.emplace(reader.get_allocator());
+            read_array(reader, JsonToken::Number, [&] {
+                const std::int64_t day = reader.integer();
+                if (day < 0 || day >= WEEKDAY_COUNT) {
+                    throw JsonError("Storage::read_repeat_rule: weekday out of range");
+                }
+                weekdays->push_back(static_cast<Temporal::Weekday>(day));
+            });
+        } else if (key == "end") {
+            end = read_time_point(reader);
+        } else {
+            reader.skip();
+        }
+    }
+    if (weekdays) {
+        return TaskRepeatRule{
+            .repeat_type = TaskRepeat::EveryWeekday{.weekdays = std::move(*weekdays)},
+            .end = end};
+    }
+    if (!interval) {
+        throw JsonError("Storage::read_repeat_rule: rule has neither interval nor weekdays");
+    }
+    return TaskRepeatRule{
+        .repeat_type = TaskRepeat::EveryUnit{.interval = *interval, .unit_str = std::move(unit)},
+        .end = end};
+}
+
+auto Lines::Storage::read_task(JsonReader &reader) -> Task {
+    reader.expect(JsonToken::BeginObject);
+    TaskInfo info(reader.get_allocator());
+    std::optional<TaskRepeatRule> rule;
+    std::optional<Temporal::TimePoint> deadline;
+    bool completed = false;
+    while (reader.next() == JsonToken::Key) {
+        if (read_info_member(reader, info)) {
+            continue;
+        }
+        const std::string_view key = reader.string();
+        if (key == "deadline") {
+            deadline = read_time_point(reader);
+        } else if (key == "completed") {
+            reader.expect(JsonToken::Boolean);
+            completed = reader.boolean();
+        } else if (key == "repeat") {
+            rule = read_repeat_rule(reader);
+        } else {
+            reader.skip();
+        }
+    }
+    require_title(info.title, "task");
+    Task task{std::move(info), std::move(rule)};
+    task.set_deadline(deadline);
+    if (completed) {
+        task.complete();
+    }
+    return task;
+}
+
+auto Lines::Storage::read_node(JsonReader &reader, Roadmap &rmap,
+                               const RoadmapNode::NodePtr &parent) -> RoadmapNode::NodePtr {
+    // One frame per open node object, children are read without recursion
+    struct Frame {
+        Frame(RoadmapNode::NodePtr parent, const Allocator &alloc)
+            : parent(std::move(parent)), info(alloc) {}
+
+        RoadmapNode::NodePtr parent;
+        RoadmapNodeInfo info;
+        RoadmapNode::NodePtr node;
+        std::optional<RoadmapNode::State> state;
+        bool in_children = false;
+    };
+    const auto create = [&](Frame &frame) {
+        if (frame.node.expired()) {
+            require_title(frame.info.title, "node");
+            frame.node = rmap.add_node(frame.parent, std::move(frame.info));
+        }
+    };
+    std::vector<Frame> stack;
+    reader.expect(JsonToken::BeginObject);
+    stack.emplace_back(parent, rmap.get_allocator());
+    for (;;) {
+        Frame &frame = stack.back();
+        if (frame.in_children) {
+            if (reader.peek() != JsonToken::EndArray) {
+                reader.expect(JsonToken::BeginObject);
+                RoadmapNode::NodePtr node = frame.node;
+                stack.emplace_back(std::move(node), rmap.get_allocator());
+                continue;
+            }
+            reader.next();
+            frame.in_children = false;
+        }
+        while (reader.next() == JsonToken::Key) {
+            const std::string_view key = reader.string();
+            if (key == "state") {
+                frame.state = parse_state(read_string(reader));
+            } else if (key == "children") {
+                create(frame);
+                reader.expect(JsonToken::BeginArray);
+                frame.in_children = true;
+                break;
+            } else if (!frame.node.expired() &&
+                       (key == "title" || key == "description" || key == "tags")) {
+                throw JsonError("Storage::read_node: node members must precede its children");
+            } else if (!read_info_member(reader, frame.info)) {
+                reader.skip();
+            }
+        }
+        if (frame.in_children) {
+            continue;
+        }
+        create(frame);
+        if (frame.state) {
+            frame.node.lock()->set_state(*frame.state);
+        }
+        if (stack.size() == 1) {
+            return frame.node;
+        }
+        stack.pop_back();
+    }
+}
+
+auto Lines::Storage::read_roadmap(JsonReader &reader) -> Roadmap {
+    reader.expect(JsonToken::BeginObject);
+    RoadmapInfo info(reader.get_allocator());
+    std::optional<Roadmap> rmap;
+    const auto create = [&] {
+        if (!rmap) {
+            require_title(info.title, "roadmap");
+            rmap.emplace(std::move(info));
+        }
+    };
+    while (reader.next() == JsonToken::Key) {
+        const std::string_view key = reader.string();
+        if (key == "nodes") {
+            create();
+            reader.expect(JsonToken::BeginArray);
+            while (reader.peek() != JsonToken::EndArray) {
+                read_node(reader, *rmap, rmap->root());
+            }
+            reader.next();
+        } else if (rmap && (key == "title" || key == "description" || key == "tags")) {
+            throw JsonError("Storage::read_roadmap: roadmap members must precede its nodes");
+        } else if (!read_info_member(reader, info)) {
+            reader.skip();
+        }
+    }
+    create();
+    return std::move(*rmap);
+}
@@ -0,0 +1,292 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/roadmap_snapshot.hpp"
+
+#include "lines/detail/endian.hpp"
+#include "lines/roadmaps/roadmaps_algorithms.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+using Lines::detail::load_le;
+using Lines::detail::store_le;
+
+namespace Offset {
+LINES_CONSTEXPR std::size_t TITLE = 0;
+LINES_CONSTEXPR std::size_t DESCRIPTION = 8;
+LINES_CONSTEXPR std::size_t FIRST_TAG = 16;
+LINES_CONSTEXPR std::size_t TAG_COUNT = 20;
+LINES_CONSTEXPR std::size_t FIRST_NODE = 24;
+LINES_CONSTEXPR std::size_t NODE_COUNT = 28;
+LINES_CONSTEXPR std::size_t ROADMAP_FLAGS = 32;
+LINES_CONSTEXPR std::size_t NODE_ID = 24;
+LINES_CONSTEXPR std::size_t PARENT_ID = 32;
+LINES_CONSTEXPR std::size_t STATE = 40;
+LINES_CONSTEXPR std::size_t NODE_FLAGS = 41;
+LINES_CONSTEXPR std::size_t DESCENDANTS = 44;
+} // namespace Offset
+
+LINES_CONSTEXPR std::uint8_t HAS_DESCRIPTION = 1U << 0U;
+LINES_CONSTEXPR std::uint8_t STATE_COUNT = 4;
+
+auto read_tag(std::span<const std::byte> strings, std::span<const std::byte> tags,
+              const std::byte *record, std::size_t index, const char *what) -> std::string_view {
+    if (index >= load_le<std::uint32_t>(record + Offset::TAG_COUNT)) {
+        throw std::out_of_range(std::string(what) + ": index out of range");
+    }
+    const std::size_t slot = load_le<std::uint32_t>(record + Offset::FIRST_TAG) + index;
+    if (slot >= tags.size() / Lines::Storage::StringRef::SIZE) {
+        throw Lines::Storage::SnapshotError(std::string(what) + ": tag reference out of bounds");
+    }
+    return Lines::Storage::read_string(strings,
+                                       tags.data() + slot * Lines::Storage::StringRef::SIZE);
+}
+
+template <typename Info, typename View>
+auto make_info(const View &view, const Lines::Allocator &alloc) {
+    Info info{std::allocator_arg, alloc, view.title(), view.description()};
+    info.tags.reserve(view.tag_count());
+    for (std::size_t i = 0; i < view.tag_count(); ++i) {
+        info.tags.emplace_back(view.tag(i));
+    }
+    return info;
+}
+} // namespace
+
+// NodeView
+
+Lines::Storage::NodeView::NodeView(std::span<const std::byte> nodes, std::size_t index,
+                                   std::span<const std::byte> strings,
+                                   std::span<const std::byte> tags)
+    : _nodes(nodes), _index(index), _strings(strings), _tags(tags) {}
+
+auto Lines::Storage::NodeView::record() const -> const std::byte * {
+    return _nodes.data() + _index * RECORD_SIZE;
+}
+
+auto Lines::Storage::NodeView::id() const -> RoadmapNode::NodeID {
+    return load_le<std::uint64_t>(record() + Offset::NODE_ID);
+}
+
+auto Lines::Storage::NodeView::parent_id() const -> RoadmapNode::NodeID {
+    return load_le<std::uint64_t>(record() + Offset::PARENT_ID);
+}
+
+auto Lines::Storage::NodeView::state() const -> RoadmapNode::State {
+    const auto state = static_cast<std::uint8_t>(record()[Offset::STATE]);
+    if (state >= STATE_COUNT) {
+        throw SnapshotError("NodeView::state: unknown node state");
+    }
+    return static_cast<RoadmapNode::State>(state);
+}
+
+auto Lines::Storage::NodeView::title() const -> std::string_view {
+    return read_string(_strings, record() + Offset::TITLE);
+}
+
+auto Lines::Storage::NodeView::description() const -> std::optional<std::string_view> {
+    if ((static_cast<std::uint8_t>(record()[Offset::NODE_FLAGS]) & HAS_DESCRIPTION) == 0) {
+        return std::nullopt;
+    }
+    return read_string(_strings, record() + Offset::DESCRIPTION);
+}
+
+auto Lines::Storage::NodeView::tag_count() const -> std::size_t {
+    return load_le<std::uint32_t>(record() + Offset::TAG_COUNT);
+}
+
+auto Lines::Storage::NodeView::tag(std::size_t index) const -> std::string_view {
+    return read_tag(_strings, _tags, record(), index, "NodeView::tag");
+}
+
+auto Lines::Storage::NodeView::descendant_count() const -> std::size_t {
+    return load_le<std::uint32_t>(record() + Offset::DESCENDANTS);
+}
+
+auto Lines::Storage::NodeView::children() const -> NodeRange {
+    const std::size_t last = std::min(_index + 1 + descendant_count(), _nodes.size() / RECORD_SIZE);
+    return NodeRange{_nodes, _index + 1, last, _strings, _tags};
+}
+
+auto Lines::Storage::NodeView::to_info(const Allocator &alloc) const -> RoadmapNodeInfo {
+    return make_info<RoadmapNodeInfo>(*this, alloc);
+}
+
+auto Lines::Storage::NodeRange::Iterator::operator++() -> Iterator & {
+    // Clamped, so a corrupt count cannot walk past the siblings
+    _node._index = std::min(_node._index + 1 + _node.descendant_count(), _last);
+    return *this;
+}
+
+// RoadmapView
+
+Lines::Storage::RoadmapView::RoadmapView(const std::byte *record, std::span<const std::byte> nodes,
+                                         std::span<const std::byte> strings,
+                                         std::span<const std::byte> tags)
+    : _record(record), _nodes(nodes), _strings(strings), _tags(tags) {}
+
+auto Lines::Storage::RoadmapView::title() const -> std::string_view {
+    return read_string(_strings, _record + Offset::TITLE);
+}
+
+auto Lines::Storage::RoadmapView::description() const -> std::optional<std::string_view> {
+    if ((load_le<std::uint32_t>(_record + Offset::ROADMAP_FLAGS) & HAS_DESCRIPTION) == 0) {
+        return std::nullopt;
+    }
+    return read_string(_strings, _record + Offset::DESCRIPTION);
+}
+
+auto Lines::Storage::RoadmapView::tag_count() const -> std::size_t {
+    return load_le<std::uint32_t>(_record + Offset::TAG_COUNT);
+}
+
+auto Lines::Storage::RoadmapView::tag(std::size_t index) const -> std::string_view {
+    return read_tag(_strings, _tags, _record, index, "RoadmapView::tag");
+}
+
+auto Lines::Storage::RoadmapView::node(std::size_t index) const -> NodeView {
+    if (index >= node_count()) {
+        throw std::out_of_range("RoadmapView::node: index out of range");
+    }
+    return NodeView{_nodes, index, _strings, _tags};
+}
+
+auto Lines::Storage::RoadmapView::children() const -> NodeRange {
+    return NodeRange{_nodes, 0, node_count(), _strings, _tags};
+}
+
+auto Lines::Storage::RoadmapView::to_roadmap(const Allocator &alloc) const -> Roadmap {
+    Roadmap rmap{std::allocator_arg, alloc, make_info<RoadmapInfo>(*this, alloc)};
+    for (std::size_t i = 0; i < node_count(); ++i) {
+        const NodeView node{_nodes, i, _strings, _tags};
+        const RoadmapNode::NodeID parent = node.parent_id();
+        if (parent >= rmap.size() || rmap[parent].expired() ||
+            node.id() > std::numeric_limits<std::uint32_t>::max()) {
+            throw SnapshotError("RoadmapView::to_roadmap: invalid node record");
+        }
+        try {
+            rmap.add_node(rmap[parent], node.to_info(alloc), node.id())
+                .lock()
+                ->set_state(node.state());
+        } catch (const std::invalid_argument &error) {
+            throw SnapshotError(std::string("RoadmapView::to_roadmap: ") + error.what());
+        }
+    }
+    return rmap;
+}
+
+// RoadmapSnapshot
+
+Lines::Storage::RoadmapSnapshot::RoadmapSnapshot(std::span<const std::byte> bytes, Verify verify)
+    : _image(bytes, verify), _strings(_image.section(SectionKind::RoadmapStrings)),
+      _records(_image.section(SectionKind::Roadmaps)),
+      _nodes(_image.section(SectionKind::RoadmapNodes)),
+      _tags(_image.section(SectionKind::RoadmapTags)) {
+    if (_records.size() % RoadmapView::RECORD_SIZE != 0 ||
+        _nodes.size() % NodeView::RECORD_SIZE != 0) {
+        throw SnapshotError("RoadmapSnapshot: roadmap sections are not whole records");
+    }
+}
+
+auto Lines::Storage::RoadmapSnapshot::operator[](std::size_t index) const -> RoadmapView {
+    const std::byte *record = _records.data() + index * RoadmapView::RECORD_SIZE;
+    const std::size_t first = load_le<std::uint32_t>(record + Offset::FIRST_NODE);
+    const std::size_t count = load_le<std::uint32_t>(record + Offset::NODE_COUNT);
+    if (first + count > _nodes.size() / NodeView::RECORD_SIZE) {
+        throw SnapshotError("RoadmapSnapshot: node range out of bounds");
+    }
+    return RoadmapView{record,
+                       _nodes.subspan(first * NodeView::RECORD_SIZE, count * NodeView::RECORD_SIZE),
+                       _strings, _tags};
+}
+
+// RoadmapSnapshotWriter
+
+template <typename Item>
+auto Lines::Storage::RoadmapSnapshotWriter::write_info(std::byte *record, const Item &item)
+    -> std::uint8_t {
+    if (_tags.size() / StringRef::SIZE + item.info().tags.size() >
+        std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("RoadmapSnapshotWriter::add: too many tags");
+    }
+    write_string_ref(record + Offset::TITLE, _strings.add(item.info().title));
+    store_le(record + Offset::FIRST_TAG,
+             static_cast<std::uint32_t>(_tags.size() / StringRef::SIZE));
+    store_le(record + Offset::TAG_COUNT, static_cast<std::uint32_t>(item.info().tags.size()));
+    for (const auto &tag : item.info().tags) {
+        _tags.resize(_tags.size() + StringRef::SIZE);
+        write_string_ref(_tags.data() + _tags.size() - StringRef::SIZE, _strings.add(tag));
+    }
+    if (!item.info().description) {
+        return 0;
+    }
+    write_string_ref(record + Offset::DESCRIPTION, _strings.add(*item.info().description));
+    return HAS_DESCRIPTION;
+}
+
+void Lines::Storage::RoadmapSnapshotWriter::add(const Roadmap &rmap) {
+    const std::size_t first = _nodes.size() / NodeView::RECORD_SIZE;
+    if (first + rmap.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("RoadmapSnapshotWriter::add: too many nodes");
+    }
+    _records.resize(_records.size() + RoadmapView::RECORD_SIZE);
+    const std::size_t at = _records.size() - RoadmapView::RECORD_SIZE;
+    const std::uint8_t flags = write_info(_records.data() + at, rmap);
+
+    // Record position of every written node id, to add descendants to parents
+    std::vector<std::uint32_t> position(rmap.size());
+    Roadmaps::dfs_foreach(rmap, [&](const RoadmapNode::NodePtr &ptr) {
+        const auto node = ptr.lock();
+        if (Roadmap::is_root(node->id())) {
+            return;
+        }
+        position[node->id()] = static_cast<std::uint32_t>(_nodes.size() / NodeView::RECORD_SIZE);
+        _nodes.resize(_nodes.size() + NodeView::RECORD_SIZE);
+        std::byte *record = _nodes.data() + _nodes.size() - NodeView::RECORD_SIZE;
+        const std::uint8_t node_flags = write_info(record, *node);
+        store_le(record + Offset::NODE_ID, static_cast<std::uint64_t>(node->id()));
+        store_le(record + Offset::PARENT_ID,
+                 static_cast<std::uint64_t>(node->parent().lock()->id()));
+        record[Offset::STATE] = static_cast<std::byte>(node->state());
+        record[Offset::NODE_FLAGS] = static_cast<std::byte>(node_flags);
+    });
+    const std::size_t last = _nodes.size() / NodeView::RECORD_SIZE;
+
+    // In reverse pre-order every node is complete before its parent
+    for (std::size_t i = last; i-- > first;) {
+        std::byte *record = _nodes.data() + i * NodeView::RECORD_SIZE;
+        const auto parent = load_le<std::uint64_t>(record + Offset::PARENT_ID);
+        if (Roadmap::is_root(parent)) {
+            continue;
+        }
+        std::byte *parent_record = _nodes.data() + position[parent] * NodeView::RECORD_SIZE;
+        store_le(parent_record + Offset::DESCENDANTS,
+                 load_le<std::uint32_t>(parent_record + Offset::DESCENDANTS) +
+                     load_le<std::uint32_t>(record + Offset::DESCENDANTS) + 1);
+    }
+
+    std::byte *record = _records.data() + at;
+    store_le(record + Offset::FIRST_NODE, static_cast<std::uint32_t>(first));
+    store_le(record + Offset::NODE_COUNT, static_cast<std::uint32_t>(last - first));
+    store_le(record + Offset::ROADMAP_FLAGS, static_cast<std::uint32_t>(flags));
+}
+
+void Lines::Storage::RoadmapSnapshotWriter::write_sections(SnapshotWriter &writer) {
+    writer.add_section(SectionKind::RoadmapStrings, _strings.take());
+    writer.add_section(SectionKind::Roadmaps, std::exchange(_records, {}));
+    writer.add_section(SectionKind::RoadmapNodes, std::exchange(_nodes, {}));
+    writer.add_section(SectionKind::RoadmapTags, std::exchange(_tags, {}));
+}
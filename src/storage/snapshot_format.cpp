@@ -0,0 +1,149 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/snapshot_format.hpp"
+
+#include "lines/detail/endian.hpp"
+#include "lines/storage/checksum.hpp"
+
+#include <array>
+#include <cstring>
+#include <limits>
+
+namespace {
+using Lines::detail::load_le;
+using Lines::detail::store_le;
+
+LINES_CONSTEXPR std::array<char, 4> MAGIC = {'L', 'N', 'S', 'P'};
+LINES_CONSTEXPR std::size_t HEADER_SIZE = 16;
+LINES_CONSTEXPR std::size_t ENTRY_SIZE = 24;
+LINES_CONSTEXPR std::size_t ALIGNMENT = 8;
+
+auto align_up(std::size_t size) -> std::size_t { return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+} // namespace
+
+auto Lines::Storage::StringTableWriter::add(std::string_view str) -> StringRef {
+    if (const auto it = _refs.find(str); it != _refs.end()) {
+        return it->second;
+    }
+    if (_bytes.size() + str.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("StringTableWriter::add: string table exceeds 4 GiB");
+    }
+    const StringRef ref{static_cast<std::uint32_t>(_bytes.size()),
+                        static_cast<std::uint32_t>(str.size())};
+    const auto *begin = reinterpret_cast<const std::byte *>(str.data()); // NOLINT
+    _bytes.insert(_bytes.end(), begin, begin + str.size());              // NOLINT
+    _refs.emplace(str, ref);
+    return ref;
+}
+
+auto Lines::Storage::StringTableWriter::take() -> std::vector<std::byte> {
+    _refs.clear();
+    return std::exchange(_bytes, {});
+}
+
+void Lines::Storage::SnapshotWriter::add_section(SectionKind kind, std::vector<std::byte> payload) {
+    if (_sections.size() == std::numeric_limits<std::uint16_t>::max()) {
+        throw std::length_error("SnapshotWriter::add_section: too many sections");
+    }
+    _sections.emplace_back(kind, std::move(payload));
+}
+
+auto Lines::Storage::SnapshotWriter::finish() -> std::vector<std::byte> {
+    const std::size_t table_end = HEADER_SIZE + ENTRY_SIZE * _sections.size();
+    std::size_t total = align_up(table_end);
+    for (const auto &[kind, payload] : _sections) {
+        total = align_up(total + payload.size());
+    }
+
+    std::vector<std::byte> image(total);
+    std::memcpy(image.data(), MAGIC.data(), MAGIC.size());
+    store_le(image.data() + 4, SNAPSHOT_VERSION);
+    store_le(image.data() + 6, static_cast<std::uint16_t>(_sections.size()));
+
+    std::size_t offset = align_up(table_end);
+    for (std::size_t i = 0; i < _sections.size(); ++i) {
+        const auto &[kind, payload] = _sections[i];
+        std::byte *entry = image.data() + HEADER_SIZE + i * ENTRY_SIZE;
+        store_le(entry, static_cast<std::uint32_t>(kind));
+        store_le(entry + 4, crc32c(payload));
+        store_le(entry + 8, static_cast<std::uint64_t>(offset));
+        store_le(entry + 16, static_cast<std::uint64_t>(payload.size()));
+        if (!payload.empty()) {
+            std::memcpy(image.data() + offset, payload.data(), payload.size());
+        }
+        offset = align_up(offset + payload.size());
+    }
+    const std::span<const std::byte> table{image.data() + HEADER_SIZE, table_end - HEADER_SIZE};
+    store_le(image.data() + 8, crc32c(table));
+    _sections.clear();
+    return image;
+}
+
+Lines::Storage::SnapshotImage::SnapshotImage(std::span<const std::byte> bytes, Verify verify) {
+    if (bytes.size() < HEADER_SIZE || std::memcmp(bytes.data(), MAGIC.data(), MAGIC.size()) != 0) {
+        throw SnapshotError("SnapshotImage: not a snapshot image");
+    }
+    _version = load_le<std::uint16_t>(bytes.data() + 4);
+    if (_version == 0 || _version > SNAPSHOT_VERSION) {
+        throw SnapshotError("SnapshotImage: unsupported version " + std::to_string(_version));
+    }
+    const auto count = load_le<std::uint16_t>(bytes.data() + 6);
+    const std::size_t table_end = HEADER_SIZE + ENTRY_SIZE * count;
+    if (bytes.size() < table_end) {
+        throw SnapshotError("SnapshotImage: truncated section table");
+    }
+    if (crc32c(bytes.subspan(HEADER_SIZE, table_end - HEADER_SIZE)) !=
+        load_le<std::uint32_t>(bytes.data() + 8)) {
+        throw SnapshotError("SnapshotImage: section table checksum mismatch");
+    }
+
+    _sections.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::byte *entry = bytes.data() + HEADER_SIZE + i * ENTRY_SIZE;
+        const auto offset = load_le<std::uint64_t>(entry + 8);
+        const auto size = load_le<std::uint64_t>(entry + 16);
+        if (offset > bytes.size() || size > bytes.size() - offset) {
+            throw SnapshotError("SnapshotImage: section out of bounds");
+        }
+        const auto payload = bytes.subspan(offset, size);
+        if (verify == Verify::Checksums && crc32c(payload) != load_le<std::uint32_t>(entry + 4)) {
+            throw SnapshotError("SnapshotImage: checksum mismatch in section " + std::to_string(i));
+        }
+        _sections.push_back({static_cast<SectionKind>(load_le<std::uint32_t>(entry)), payload});
+    }
+}
+
+auto Lines::Storage::SnapshotImage::section(SectionKind kind) const -> std::span<const std::byte> {
+    for (const auto &section : _sections) {
+        if (section.kind == kind) {
+            return section.payload;
+        }
+    }
+    return {};
+}
+
+auto Lines::Storage::read_string(std::span<const std::byte> strings, const std::byte *ref)
+    -> std::string_view {
+    const auto offset = load_le<std::uint32_t>(ref);
+    const auto length = load_le<std::uint32_t>(ref + 4);
+    if (offset > strings.size() || length > strings.size() - offset) {
+        throw SnapshotError("Storage::read_string: string reference out of bounds");
+    }
+    return {reinterpret_cast<const char *>(strings.data()) + offset, length}; // NOLINT
+}
+
+void Lines::Storage::write_string_ref(std::byte *dst, StringRef ref) {
+    store_le(dst, ref.offset);
+    store_le(dst + 4, ref.length);
+}
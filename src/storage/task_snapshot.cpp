@@ -0,0 +1,255 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/task_snapshot.hpp"
+
+#include "lines/detail/endian.hpp"
+#include "lines/temporal/ymd.hpp"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+using Lines::detail::load_le;
+using Lines::detail::store_le;
+
+namespace Offset {
+LINES_CONSTEXPR std::size_t TITLE = 0;
+LINES_CONSTEXPR std::size_t DESCRIPTION = 8;
+LINES_CONSTEXPR std::size_t FIRST_TAG = 16;
+LINES_CONSTEXPR std::size_t TAG_COUNT = 20;
+LINES_CONSTEXPR std::size_t DEADLINE = 24;
+LINES_CONSTEXPR std::size_t RULE_INTERVAL = 32;
+LINES_CONSTEXPR std::size_t RULE_END = 40;
+LINES_CONSTEXPR std::size_t RULE_UNIT = 48;
+LINES_CONSTEXPR std::size_t FLAGS = 56;
+LINES_CONSTEXPR std::size_t RULE_KIND = 58;
+LINES_CONSTEXPR std::size_t WEEKDAYS = 59;
+} // namespace Offset
+
+namespace Flag {
+LINES_CONSTEXPR std::uint16_t COMPLETED = 1U << 0U;
+LINES_CONSTEXPR std::uint16_t HAS_DESCRIPTION = 1U << 1U;
+LINES_CONSTEXPR std::uint16_t HAS_DEADLINE = 1U << 2U;
+LINES_CONSTEXPR std::uint16_t HAS_RULE_END = 1U << 3U;
+} // namespace Flag
+
+enum class RuleKind : std::uint8_t { None = 0, EveryUnit = 1, EveryWeekday = 2 };
+
+LINES_CONSTEXPR std::uint8_t WEEKDAY_COUNT = 7;
+
+auto seconds(const Lines::Temporal::TimePoint &tp) -> std::int64_t {
+    return tp.time_since_epoch().count();
+}
+
+auto time_point(std::int64_t secs) -> Lines::Temporal::TimePoint {
+    return Lines::Temporal::TimePoint{Lines::Temporal::Seconds{secs}};
+}
+} // namespace
+
+// TaskView
+
+Lines::Storage::TaskView::TaskView(const std::byte *record, std::span<const std::byte> strings,
+                                   std::span<const std::byte> tags)
+    : _record(record), _strings(strings), _tags(tags) {}
+
+auto Lines::Storage::TaskView::title() const -> std::string_view {
+    return read_string(_strings, _record + Offset::TITLE);
+}
+
+auto Lines::Storage::TaskView::description() const -> std::optional<std::string_view> {
+    if ((load_le<std::uint16_t>(_record + Offset::FLAGS) & Flag::HAS_DESCRIPTION) == 0) {
+        return std::nullopt;
+    }
+    return read_string(_strings, _record + Offset::DESCRIPTION);
+}
+
+auto Lines::Storage::TaskView::tag_count() const -> std::size_t {
+    return load_le<std::uint32_t>(_record + Offset::TAG_COUNT);
+}
+
+auto Lines::Storage::TaskView::tag(std::size_t index) const -> std::string_view {
+    if (index >= tag_count()) {
+        throw std::out_of_range("TaskView::tag: index out of range");
+    }
+    const std::size_t slot = load_le<std::uint32_t>(_record + Offset::FIRST_TAG) + index;
+    if (slot >= _tags.size() / StringRef::SIZE) {
+        throw SnapshotError("TaskView::tag: tag reference out of bounds");
+    }
+    return read_string(_strings, _tags.data() + slot * StringRef::SIZE);
+}
+
+auto Lines::Storage::TaskView::deadline() const -> std::optional<Temporal::TimePoint> {
+    if ((load_le<std::uint16_t>(_record + Offset::FLAGS) & Flag::HAS_DEADLINE) == 0) {
+        return std::nullopt;
+    }
+    return time_point(load_le<std::int64_t>(_record + Offset::DEADLINE));
+}
+
+auto Lines::Storage::TaskView::completed() const -> bool {
+    return (load_le<std::uint16_t>(_record + Offset::FLAGS) & Flag::COMPLETED) != 0;
+}
+
+auto Lines::Storage::TaskView::has_repeat_rule() const -> bool {
+    return static_cast<RuleKind>(_record[Offset::RULE_KIND]) != RuleKind::None;
+}
+
+auto Lines::Storage::TaskView::repeat_rule(const Allocator &alloc) const
+    -> std::optional<TaskRepeatRule> {
+    std::optional<Temporal::TimePoint> end;
+    if ((load_le<std::uint16_t>(_record + Offset::FLAGS) & Flag::HAS_RULE_END) != 0) {
+        end = time_point(load_le<std::int64_t>(_record + Offset::RULE_END));
+    }
+    switch (static_cast<RuleKind>(_record[Offset::RULE_KIND])) {
+    case RuleKind::None:
+        return std::nullopt;
+    case RuleKind::EveryUnit:
+        return TaskRepeatRule{
+            .repeat_type =
+                TaskRepeat::EveryUnit{
+                    .interval = Temporal::Seconds{load_le<std::int64_t>(_record +
+                                                                        Offset::RULE_INTERVAL)},
+                    .unit_str = std::pmr::string(read_string(_strings, _record + Offset::RULE_UNIT),
+                                                 alloc)},
+            .end = end};
+    case RuleKind::EveryWeekday: {
+        const auto mask = static_cast<std::uint8_t>(_record[Offset::WEEKDAYS]);
+        std::pmr::vector<Temporal::Weekday> weekdays(alloc);
+        for (std::uint8_t day = 0; day < WEEKDAY_COUNT; ++day) {
+            if ((mask & (1U << day)) != 0) {
+                weekdays.push_back(static_cast<Temporal::Weekday>(day));
+            }
+        }
+        return TaskRepeatRule{
+            .repeat_type = TaskRepeat::EveryWeekday{.weekdays = std::move(weekdays)}, .end = end};
+    }
+    }
+    throw SnapshotError("TaskView::repeat_rule: unknown repeat rule kind");
+}
+
+auto Lines::Storage::TaskView::to_task(const Allocator &alloc) const -> Task {
+    try {
+        TaskInfo info{std::allocator_arg, alloc, title(), description()};
+        info.tags.reserve(tag_count());
+        for (std::size_t i = 0; i < tag_count(); ++i) {
+            info.tags.emplace_back(tag(i));
+        }
+        Task task{std::allocator_arg, alloc, std::move(info), repeat_rule(alloc)};
+        task.set_deadline(deadline());
+        if (completed()) {
+            task.complete();
+        }
+        return task;
+    } catch (const std::invalid_argument &error) {
+        throw SnapshotError(std::string("TaskView::to_task: ") + error.what());
+    }
+}
+
+// TaskSnapshot
+
+Lines::Storage::TaskSnapshot::TaskSnapshot(std::span<const std::byte> bytes, Verify verify)
+    : _image(bytes, verify), _strings(_image.section(SectionKind::Strings)),
+      _records(_image.section(SectionKind::Tasks)), _tags(_image.section(SectionKind::TaskTags)) {
+    if (_records.size() % TaskView::RECORD_SIZE != 0) {
+        throw SnapshotError("TaskSnapshot: task section is not a whole number of records");
+    }
+}
+
+auto Lines::Storage::TaskSnapshot::operator[](std::size_t index) const -> TaskView {
+    LINES_ASSERT(index < size());
+    return TaskView{_records.data() + index * TaskView::RECORD_SIZE, _strings, _tags};
+}
+
+auto Lines::Storage::TaskSnapshot::at(std::size_t index) const -> TaskView {
+    if (index >= size()) {
+        throw std::out_of_range("TaskSnapshot::at: index out of range");
+    }
+    return (*this)[index];
+}
+
+// TaskSnapshotWriter
+
+void Lines::Storage::TaskSnapshotWriter::add(const Task &task) {
+    if (_tags.size() / StringRef::SIZE + task.info().tags.size() >
+        std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("TaskSnapshotWriter::add: too many tags");
+    }
+    const std::size_t at = _records.size();
+    _records.resize(at + TaskView::RECORD_SIZE);
+    std::byte *record = _records.data() + at;
+    std::uint16_t flags = 0;
+
+    write_string_ref(record + Offset::TITLE, _strings.add(task.title()));
+    if (task.description()) {
+        flags |= Flag::HAS_DESCRIPTION;
+        write_string_ref(record + Offset::DESCRIPTION, _strings.add(*task.description()));
+    }
+
+    store_le(record + Offset::FIRST_TAG,
+             static_cast<std::uint32_t>(_tags.size() / StringRef::SIZE));
+    store_le(record + Offset::TAG_COUNT, static_cast<std::uint32_t>(task.info().tags.size()));
+    for (const auto &tag : task.info().tags) {
+        _tags.resize(_tags.size() + StringRef::SIZE);
+        write_string_ref(_tags.data() + _tags.size() - StringRef::SIZE, _strings.add(tag));
+    }
+
+    if (task.deadline()) {
+        flags |= Flag::HAS_DEADLINE;
+        store_le(record + Offset::DEADLINE, seconds(*task.deadline()));
+    }
+    if (task.completed()) {
+        flags |= Flag::COMPLETED;
+    }
+
+    if (const auto &rule = task.repeat_rule()) {
+        if (rule->end) {
+            flags |= Flag::HAS_RULE_END;
+            store_le(record + Offset::RULE_END, seconds(*rule->end));
+        }
+        if (const auto *unit = std::get_if<TaskRepeat::EveryUnit>(&rule->repeat_type)) {
+            record[Offset::RULE_KIND] = static_cast<std::byte>(RuleKind::EveryUnit);
+            store_le(record + Offset::RULE_INTERVAL, unit->interval.count());
+            write_string_ref(record + Offset::RULE_UNIT, _strings.add(unit->unit_str));
+        } else {
+            const auto &weekdays = std::get<TaskRepeat::EveryWeekday>(rule->repeat_type).weekdays;
+            std::uint8_t mask = 0;
+            for (const auto day : weekdays) {
+                mask |= static_cast<std::uint8_t>(1U << static_cast<std::uint8_t>(day));
+            }
+            record[Offset::RULE_KIND] = static_cast<std::byte>(RuleKind::EveryWeekday);
+            record[Offset::WEEKDAYS] = static_cast<std::byte>(mask);
+        }
+    }
+    store_le(record + Offset::FLAGS, flags);
+}
+
+void Lines::Storage::TaskSnapshotWriter::write_sections(SnapshotWriter &writer) {
+    writer.add_section(SectionKind::Strings, _strings.take());
+    writer.add_section(SectionKind::Tasks, std::exchange(_records, {}));
+    writer.add_section(SectionKind::TaskTags, std::exchange(_tags, {}));
+}
+
+auto Lines::Storage::TaskSnapshotWriter::finish() -> std::vector<std::byte> {
+    SnapshotWriter writer;
+    write_sections(writer);
+    return writer.finish();
+}
+
+auto Lines::Storage::write_task_snapshot(std::span<const Task> tasks) -> std::vector<std::byte> {
+    TaskSnapshotWriter writer;
+    for (const auto &task : tasks) {
+        writer.add(task);
+    }
+    return writer.finish();
+}
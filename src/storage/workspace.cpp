@@ -0,0 +1,141 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/workspace.hpp"
+
+#include <stdexcept>
+
+namespace {
+using namespace Lines::Storage;
+
+template <typename Tasks, typename Roadmaps>
+auto write_snapshot(std::size_t task_count, const Tasks &task_at, std::size_t roadmap_count,
+                    const Roadmaps &roadmap_at) -> std::vector<std::byte> {
+    SnapshotWriter writer;
+    TaskSnapshotWriter tasks;
+    for (std::size_t id = 0; id < task_count; ++id) {
+        tasks.add(task_at(id));
+    }
+    tasks.write_sections(writer);
+    RoadmapSnapshotWriter roadmaps;
+    for (std::size_t id = 0; id < roadmap_count; ++id) {
+        roadmaps.add(roadmap_at(id));
+    }
+    roadmaps.write_sections(writer);
+    return writer.finish();
+}
+} // namespace
+
+auto Lines::Storage::write_workspace_snapshot(const Workspace &workspace)
+    -> std::vector<std::byte> {
+    return write_snapshot(
+        workspace.tasks.size(), [&](std::size_t id) -> const Task & { return workspace.tasks[id]; },
+        workspace.roadmaps.size(),
+        [&](std::size_t id) -> const Roadmap & { return workspace.roadmaps[id]; });
+}
+
+auto Lines::Storage::read_workspace_snapshot(std::span<const std::byte> bytes, Verify verify)
+    -> Workspace {
+    Workspace workspace;
+    const TaskSnapshot tasks{bytes, verify};
+    workspace.tasks.reserve(tasks.size());
+    for (const auto view : tasks.tasks()) {
+        workspace.tasks.push_back(view.to_task());
+    }
+    // The task snapshot has verified the whole image already
+    const RoadmapSnapshot roadmaps{bytes, Verify::Structure};
+    workspace.roadmaps.reserve(roadmaps.size());
+    for (const auto view : roadmaps.roadmaps()) {
+        workspace.roadmaps.push_back(view.to_roadmap());
+    }
+    return workspace;
+}
+
+void Lines::Storage::save_workspace_snapshot(const std::filesystem::path &path,
+                                             const Workspace &workspace) {
+    write_file_atomically(path, write_workspace_snapshot(workspace));
+}
+
+// MappedWorkspace
+
+Lines::Storage::MappedWorkspace::MappedWorkspace(const std::filesystem::path &path, Verify verify,
+                                                 const Allocator &alloc)
+    : _file(path), _tasks(_file.bytes(), verify), _roadmaps(_file.bytes(), Verify::Structure),
+      _alloc(alloc) {}
+
+auto Lines::Storage::MappedWorkspace::task(TaskID id) -> Task & {
+    if (id >= _tasks.size()) {
+        throw std::out_of_range("MappedWorkspace::task: id out of range");
+    }
+    if (const auto it = _promoted_tasks.find(id); it != _promoted_tasks.end()) {
+        return it->second;
+    }
+    return _promoted_tasks.try_emplace(id, _tasks[id].to_task(_alloc)).first->second;
+}
+
+auto Lines::Storage::MappedWorkspace::roadmap(RoadmapID id) -> Roadmap & {
+    if (id >= _roadmaps.size()) {
+        throw std::out_of_range("MappedWorkspace::roadmap: id out of range");
+    }
+    if (const auto it = _promoted_roadmaps.find(id); it != _promoted_roadmaps.end()) {
+        return it->second;
+    }
+    return _promoted_roadmaps.try_emplace(id, _roadmaps[id].to_roadmap(_alloc)).first->second;
+}
+
+auto Lines::Storage::MappedWorkspace::find_task(TaskID id) const -> const Task * {
+    const auto it = _promoted_tasks.find(id);
+    return it == _promoted_tasks.end() ? nullptr : &it->second;
+}
+
+auto Lines::Storage::MappedWorkspace::find_roadmap(RoadmapID id) const -> const Roadmap * {
+    const auto it = _promoted_roadmaps.find(id);
+    return it == _promoted_roadmaps.end() ? nullptr : &it->second;
+}
+
+auto Lines::Storage::MappedWorkspace::to_workspace() const -> Workspace {
+    Workspace workspace;
+    workspace.tasks.reserve(_tasks.size());
+    for (std::size_t id = 0; id < _tasks.size(); ++id) {
+        const Task *promoted = find_task(static_cast<TaskID>(id));
+        workspace.tasks.push_back(promoted != nullptr ? *promoted : _tasks[id].to_task());
+    }
+    workspace.roadmaps.reserve(_roadmaps.size());
+    for (std::size_t id = 0; id < _roadmaps.size(); ++id) {
+        const Roadmap *promoted = find_roadmap(static_cast<RoadmapID>(id));
+        workspace.roadmaps.push_back(promoted != nullptr ? *promoted : _roadmaps[id].to_roadmap());
+    }
+    return workspace;
+}
+
+void Lines::Storage::MappedWorkspace::save(const std::filesystem::path &path) const {
+    // Items still in the snapshot are materialized one at a time
+    std::optional<Task> task;
+    std::optional<Roadmap> rmap;
+    const auto bytes = write_snapshot(
+        _tasks.size(),
+        [&](std::size_t id) -> const Task & {
+            if (const Task *promoted = find_task(static_cast<TaskID>(id))) {
+                return *promoted;
+            }
+            return task.emplace(_tasks[id].to_task());
+        },
+        _roadmaps.size(),
+        [&](std::size_t id) -> const Roadmap & {
+            if (const Roadmap *promoted = find_roadmap(static_cast<RoadmapID>(id))) {
+                return *promoted;
+            }
+            return rmap.emplace(_roadmaps[id].to_roadmap());
+        });
+    write_file_atomically(path, bytes);
+}
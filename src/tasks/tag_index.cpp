@@ -0,0 +1,188 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/tasks/tag_index.hpp"
+
+#include "lines/execution/parallel.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// TagInterner
+
+auto Lines::TagInterner::intern(std::string_view tag) -> TagId {
+    if (const auto it = _ids.find(tag); it != _ids.end()) {
+        return it->second;
+    }
+    const auto id = static_cast<TagId>(_names.size());
+    const auto [it, inserted] = _ids.emplace(std::string{tag}, id);
+    _names.emplace_back(it->first);
+    return id;
+}
+
+auto Lines::TagInterner::find(std::string_view tag) const -> std::optional<TagId> {
+    if (const auto it = _ids.find(tag); it != _ids.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+auto Lines::TagInterner::name(TagId id) const -> std::string_view {
+    if (id >= _names.size()) {
+        throw std::out_of_range("TagInterner::name: unknown tag id");
+    }
+    return _names[id];
+}
+
+// TagIndex
+
+void Lines::TagIndex::add_tags(TaskID id, std::span<const std::pmr::string> tags) {
+    for (const auto &tag : tags) {
+        const TagId tag_id = _interner.intern(tag);
+        if (tag_id >= _postings.size()) {
+            _postings.resize(tag_id + 1);
+        }
+        _postings[tag_id].add(id);
+    }
+}
+
+void Lines::TagIndex::remove_tags(TaskID id, std::span<const std::pmr::string> tags) {
+    for (const auto &tag : tags) {
+        if (const auto tag_id = _interner.find(tag)) {
+            _postings[*tag_id].remove(id);
+        }
+    }
+}
+
+void Lines::TagIndex::track(Task &task, TaskID id) {
+    if (task.attached()) {
+        throw std::invalid_argument("TagIndex::track: task is already attached");
+    }
+    insert(id, task.info().tags);
+    task.attach(*this, id);
+}
+
+void Lines::TagIndex::untrack(Task &task) {
+    if (const auto id = task.id()) {
+        erase(*id, task.info().tags);
+    }
+    task.detach();
+}
+
+void Lines::TagIndex::insert(TaskID id, std::span<const std::pmr::string> tags) {
+    _tasks.add(id);
+    add_tags(id, tags);
+}
+
+void Lines::TagIndex::insert(TaskID first, std::span<const Task> tasks,
+                            Execution::Executor &executor) {
+    if (!tasks.empty() && tasks.size() - 1 > std::numeric_limits<TaskID>::max() - first) {
+        throw std::length_error("TagIndex::insert: task ids out of range");
+    }
+    // Postings of one chunk in the order its tags first occur, so that tags
+    // are interned in the same order as by single inserts
+    struct Chunk {
+        std::unordered_map<std::string_view, std::size_t> slots;
+        std::vector<std::pair<std::string_view, Bitmap>> postings;
+    };
+    const std::size_t grain = Execution::detail::grain_for(executor, tasks.size(), 0);
+    std::vector<Chunk> chunks((tasks.size() + grain - 1) / grain);
+    executor.bulk(chunks.size(), [&](std::size_t index) {
+        Chunk &chunk = chunks[index];
+        const std::size_t begin = index * grain;
+        for (std::size_t i = begin; i < std::min(begin + grain, tasks.size()); ++i) {
+            for (const auto &tag : tasks[i].info().tags) {
+                const auto [it, inserted] = chunk.slots.try_emplace(tag, chunk.postings.size());
+                if (inserted) {
+                    chunk.postings.emplace_back(tag, Bitmap{});
+                }
+                chunk.postings[it->second].second.add(static_cast<TaskID>(first + i));
+            }
+        }
+    });
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        _tasks.add(static_cast<TaskID>(first + i));
+    }
+    for (auto &chunk : chunks) {
+        for (auto &[tag, ids] : chunk.postings) {
+            const TagId tag_id = _interner.intern(tag);
+            if (tag_id >= _postings.size()) {
+                _postings.resize(tag_id + 1);
+            }
+            _postings[tag_id] |= ids;
+        }
+    }
+}
+
+void Lines::TagIndex::erase(TaskID id, std::span<const std::pmr::string> tags) {
+    _tasks.remove(id);
+    remove_tags(id, tags);
+}
+
+auto Lines::TagIndex::tasks_with(std::string_view tag) const -> Containers::RoaringBitmap {
+    if (const auto tag_id = _interner.find(tag)) {
+        return tasks_with(*tag_id);
+    }
+    return {};
+}
+
+auto Lines::TagIndex::tasks_with(TagId tag) const -> const Containers::RoaringBitmap & {
+    static const Bitmap empty;
+    return tag < _postings.size() ? _postings[tag] : empty;
+}
+
+auto Lines::TagIndex::query(const TagQuery &query) const -> Containers::RoaringBitmap {
+    switch (query.op()) {
+    case TagQuery::Op::Tag:
+        return tasks_with(std::string_view{query.tag()});
+    case TagQuery::Op::Not:
+        return _tasks - this->query(query.operands().front());
+    case TagQuery::Op::Or: {
+        Bitmap result;
+        for (const auto &operand : query.operands()) {
+            result |= this->query(operand);
+        }
+        return result;
+    }
+    case TagQuery::Op::And: {
+        // Negated operands are applied as differences instead of being
+        // materialized against the whole task set
+        std::optional<Bitmap> result;
+        for (const auto &operand : query.operands()) {
+            if (operand.op() != TagQuery::Op::Not) {
+                result = result ? *result & this->query(operand) : this->query(operand);
+            }
+        }
+        if (!result) {
+            result = _tasks;
+        }
+        for (const auto &operand : query.operands()) {
+            if (operand.op() == TagQuery::Op::Not) {
+                *result -= this->query(operand.operands().front());
+            }
+        }
+        return *result;
+    }
+    }
+    LINES_UNREACHABLE();
+}
+
+void Lines::TagIndex::on_tags_changed(TaskID id, const Task &task, const Tags &old_tags) {
+    remove_tags(id, old_tags);
+    add_tags(id, task.info().tags);
+}
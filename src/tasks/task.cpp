@@ -17,35 +17,165 @@
 #include "lines/temporal/timepoint.hpp"
 
 #include <optional>
+#include <type_traits>
 #include <utility>
 
+// Containers must move tasks rather than copy them, otherwise attachments
+// would be silently dropped on reallocation.
+static_assert(std::is_nothrow_move_constructible_v<Lines::Task>);
+
+namespace {
+auto copy_rule(const std::optional<Lines::TaskRepeatRule> &rule, const Lines::Allocator &alloc)
+    -> std::optional<Lines::TaskRepeatRule> {
+    if (!rule) {
+        return std::nullopt;
+    }
+    return rule->copy(alloc);
+}
+} // namespace
+
 Lines::Task::Task(TaskInfo info, std::optional<TaskRepeatRule> rule)
-    : _info(std::move(info)), _repeat_rule(std::move(rule)) {}
+    : Task(std::allocator_arg, info.get_allocator(), std::move(info), std::move(rule)) {}
+
+Lines::Task::Task(std::allocator_arg_t /*tag*/, const allocator_type &alloc, TaskInfo info,
+                  std::optional<TaskRepeatRule> rule)
+    : _info(std::allocator_arg, alloc, std::move(info)), _repeat_rule(copy_rule(rule, alloc)) {}
+
+Lines::Task::Task(std::allocator_arg_t /*tag*/, const allocator_type &alloc, const Task &task)
+    : _info(std::allocator_arg, alloc, task._info),
+      _repeat_rule(copy_rule(task._repeat_rule, alloc)), _deadline(task._deadline),
+      _completed(task._completed) {}
+
+Lines::Task::Task(std::allocator_arg_t /*tag*/, const allocator_type &alloc, Task &&task)
+    : _info(std::allocator_arg, alloc, std::move(task._info)),
+      _repeat_rule(copy_rule(task._repeat_rule, alloc)), _deadline(task._deadline),
+      _completed(task._completed), _hook(std::move(task._hook)) {}
+
+auto Lines::Task::operator=(const Task &task) -> Task & {
+    if (this != &task) {
+        assign(Task{std::allocator_arg, get_allocator(), task});
+    }
+    return *this;
+}
+
+auto Lines::Task::operator=(Task &&task) -> Task & {
+    if (this == &task) {
+        return *this;
+    }
+    if (!_hook) {
+        // Nothing observes the target, the task moves in with its attachment
+        _info = std::move(task._info);
+        _repeat_rule = std::move(task._repeat_rule);
+        _deadline = task._deadline;
+        _completed = task._completed;
+        _hook = std::move(task._hook);
+    } else if (task._hook) {
+        assign(Task{std::allocator_arg, get_allocator(), std::as_const(task)});
+    } else {
+        assign(std::move(task));
+    }
+    return *this;
+}
+
+void Lines::Task::assign(Task &&task) {
+    if (_info.title != task._info.title) {
+        const std::pmr::string old_title = std::exchange(_info.title, std::move(task._info.title));
+        if (_hook) {
+            _hook.observer->on_title_changed(_hook.id, *this, old_title);
+        }
+    }
+    if (_info.description != task._info.description) {
+        const std::optional<std::pmr::string> old_description =
+            std::exchange(_info.description, std::move(task._info.description));
+        if (_hook) {
+            _hook.observer->on_description_changed(_hook.id, *this, old_description);
+        }
+    }
+    if (_info.tags != task._info.tags) {
+        const Tags old_tags = std::exchange(_info.tags, std::move(task._info.tags));
+        if (_hook) {
+            _hook.observer->on_tags_changed(_hook.id, *this, old_tags);
+        }
+    }
+    if (_repeat_rule.has_value() || task._repeat_rule.has_value()) {
+        _repeat_rule = std::move(task._repeat_rule);
+        if (_hook) {
+            _hook.observer->on_repeat_rule_changed(_hook.id, *this);
+        }
+    }
+    if (_deadline != task._deadline) {
+        const std::optional<Temporal::TimePoint> old_deadline =
+            std::exchange(_deadline, task._deadline);
+        if (_hook) {
+            _hook.observer->on_deadline_changed(_hook.id, *this, old_deadline);
+        }
+    }
+    set_completed(task._completed);
+}
+
+auto Lines::Task::get_allocator() const -> allocator_type { return _info.get_allocator(); }
 
-void Lines::Task::set_title(const std::string &title) {
+void Lines::Task::set_title(std::string_view title) {
     if (title.empty()) {
         throw std::invalid_argument("Lines::Task: title must not be empty");
     }
-    _info.title = title;
+    if (!_hook) {
+        _info.title = title;
+        return;
+    }
+    const std::pmr::string old_title = std::exchange(_info.title, title);
+    _hook.observer->on_title_changed(_hook.id, *this, old_title);
 }
 
-void Lines::Task::set_description(const std::string &description) {
-    _info.description = description;
+void Lines::Task::set_description(std::optional<std::string_view> description) {
+    if (!_hook) {
+        detail::assign_optional_string(_info.description, description, get_allocator());
+        return;
+    }
+    const std::optional<std::pmr::string> old_description = std::move(_info.description);
+    detail::assign_optional_string(_info.description, description, get_allocator());
+    _hook.observer->on_description_changed(_hook.id, *this, old_description);
 }
 
-void Lines::Task::set_tags(std::vector<std::string> tags) { _info.tags = std::move(tags); }
+void Lines::Task::set_tags(Tags tags) {
+    if (!_hook) {
+        _info.tags = std::move(tags);
+        return;
+    }
+    const Tags old_tags = std::exchange(_info.tags, std::move(tags));
+    _hook.observer->on_tags_changed(_hook.id, *this, old_tags);
+}
+
+void Lines::Task::set_tags(const std::vector<std::string> &tags) {
+    set_tags(detail::make_tags(tags, get_allocator()));
+}
+
+void Lines::Task::set_tags(std::initializer_list<std::string_view> tags) {
+    set_tags(detail::make_tags(tags, get_allocator()));
+}
 
 void Lines::Task::set_repeat_rule(const std::optional<TaskRepeatRule> &rule) {
-    _repeat_rule = rule;
+    _repeat_rule = copy_rule(rule, get_allocator());
+    if (_hook) {
+        _hook.observer->on_repeat_rule_changed(_hook.id, *this);
+    }
 }
 
-auto Lines::Task::title() const -> const std::string & { return _info.title; }
+auto Lines::Task::title() const -> std::string_view { return _info.title; }
+
+auto Lines::Task::description() const -> std::optional<std::string_view> {
+    return detail::view_optional_string(_info.description);
+}
 
-auto Lines::Task::description() const -> const std::optional<std::string> & {
-    return _info.description;
+auto Lines::Task::tags() const -> std::vector<std::string> {
+    return detail::to_strings(_info.tags);
 }
 
-auto Lines::Task::tags() const -> const std::vector<std::string> & { return _info.tags; }
+auto Lines::Task::info() const -> const TaskInfo & { return _info; }
+
+auto Lines::Task::repeat_rule() const -> const std::optional<TaskRepeatRule> & {
+    return _repeat_rule;
+}
 
 auto Lines::Task::next_deadline(const Temporal::TimePoint &completed_at) const
     -> std::optional<Temporal::TimePoint> {
@@ -68,10 +198,10 @@ auto Lines::Task::deadline() const -> const std::optional<Temporal::TimePoint> &
     return _deadline;
 };
 
-void Lines::Task::complete() { _completed = true; }
+void Lines::Task::complete() { set_completed(true); }
 
 void Lines::Task::advance_deadline(const Temporal::TimePoint &completed_at) {
-    _deadline = next_deadline(completed_at);
+    set_deadline(next_deadline(completed_at));
 }
 
 auto Lines::Task::is_active(const Temporal::TimePoint &tp) const -> bool {
@@ -81,15 +211,43 @@ auto Lines::Task::is_active(const Temporal::TimePoint &tp) const -> bool {
     return !_completed && (!_deadline || tp <= *_deadline);
 }
 
-void Lines::Task::uncomplete() { _completed = false; };
+void Lines::Task::uncomplete() { set_completed(false); };
+
+void Lines::Task::set_completed(bool completed) {
+    if (_completed == completed) {
+        return;
+    }
+    _completed = completed;
+    if (_hook) {
+        _hook.observer->on_completion_changed(_hook.id, *this);
+    }
+}
 
 LINES_NODISCARD auto Lines::Task::completed() const -> bool { return _completed; };
 
 void Lines::Task::set_deadline(const std::optional<Temporal::TimePoint> &deadline) {
-    _deadline = deadline;
+    if (!_hook) {
+        _deadline = deadline;
+        return;
+    }
+    const std::optional<Temporal::TimePoint> old_deadline = std::exchange(_deadline, deadline);
+    _hook.observer->on_deadline_changed(_hook.id, *this, old_deadline);
 }
 LINES_NODISCARD auto Lines::Task::next_deadline() const -> std::optional<Temporal::TimePoint> {
     return _deadline ? next_deadline(*_deadline) : std::nullopt;
 }
 
-void Lines::Task::advance_deadline() { _deadline = next_deadline(); }
+void Lines::Task::advance_deadline() { set_deadline(next_deadline()); }
+
+void Lines::Task::attach(TaskObserver &observer, TaskID id) {
+    _hook.observer = &observer;
+    _hook.id = id;
+}
+
+void Lines::Task::detach() { _hook.observer = nullptr; }
+
+auto Lines::Task::attached() const -> bool { return static_cast<bool>(_hook); }
+
+auto Lines::Task::id() const -> std::optional<TaskID> {
+    return _hook ? std::optional<TaskID>{_hook.id} : std::nullopt;
+}
@@ -0,0 +1,171 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/tasks/task_alarms.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+// Orders the alarm heap earliest first
+const auto later = [](const auto &lhs, const auto &rhs) { return lhs.deadline > rhs.deadline; };
+} // namespace
+
+Lines::TaskAlarms::~TaskAlarms() { disarm(); }
+
+void Lines::TaskAlarms::arm(TaskID id, const Task &task) {
+    Entry &entry = _entries[id];
+    retire(entry);
+    if (!task.completed() && task.deadline()) {
+        entry.armed = true;
+        ++_armed;
+        _heap.push_back(
+            Alarm{.deadline = *task.deadline(), .id = id, .generation = entry.generation});
+        std::ranges::push_heap(_heap, later);
+    }
+    rearm();
+}
+
+// Makes the current alarm of the task stale
+void Lines::TaskAlarms::retire(Entry &entry) {
+    ++entry.generation;
+    if (entry.armed) {
+        entry.armed = false;
+        --_armed;
+    }
+}
+
+// Drops stale alarms and keeps the timer on the earliest one
+void Lines::TaskAlarms::rearm() {
+    // Every change of an armed deadline leaves a stale alarm behind
+    if (_heap.size() > 2 * _armed + 64) {
+        std::erase_if(_heap, [this](const Alarm &alarm) {
+            return alarm.generation != _entries[alarm.id].generation;
+        });
+        std::ranges::make_heap(_heap, later);
+    }
+    while (!_heap.empty() && _heap.front().generation != _entries[_heap.front().id].generation) {
+        std::ranges::pop_heap(_heap, later);
+        _heap.pop_back();
+    }
+    if (_heap.empty()) {
+        _timers.cancel(*this);
+    } else {
+        _timers.schedule(*this, _heap.front().deadline);
+    }
+}
+
+void Lines::TaskAlarms::fire() {
+    const Temporal::TimePoint now = _timers.clock().now();
+    while (!_heap.empty() && _heap.front().deadline <= now) {
+        std::ranges::pop_heap(_heap, later);
+        const Alarm alarm = _heap.back();
+        _heap.pop_back();
+        if (Entry &entry = _entries[alarm.id]; alarm.generation == entry.generation) {
+            // Current until taken, but out of the heap
+            entry.armed = false;
+            --_armed;
+            _due.push_back(alarm);
+        }
+    }
+    rearm();
+    // A resumed waiter may wait again right away, or change the alarms
+    while (!_waiters.empty()) {
+        const auto id = take();
+        if (!id) {
+            break;
+        }
+        NextDueAwaitable *waiter = _waiters.front();
+        _waiters.pop_front();
+        waiter->_id = id;
+        waiter->_handle.resume();
+    }
+}
+
+void Lines::TaskAlarms::track(Task &task, TaskID id) {
+    if (task.attached()) {
+        throw std::invalid_argument("TaskAlarms::track: task is already attached");
+    }
+    insert(id, task);
+    task.attach(*this, id);
+}
+
+void Lines::TaskAlarms::untrack(Task &task) {
+    if (const auto id = task.id()) {
+        erase(*id);
+    }
+    task.detach();
+}
+
+void Lines::TaskAlarms::insert(TaskID id, const Task &task) {
+    if (id < _entries.size() && _entries[id].tracked) {
+        throw std::invalid_argument("TaskAlarms::insert: task is already watched");
+    }
+    if (id >= _entries.size()) {
+        _entries.resize(std::size_t{id} + 1);
+    }
+    _entries[id].tracked = true;
+    arm(id, task);
+}
+
+void Lines::TaskAlarms::erase(TaskID id) {
+    if (id >= _entries.size() || !_entries[id].tracked) {
+        return;
+    }
+    _entries[id].tracked = false;
+    retire(_entries[id]);
+    rearm();
+}
+
+auto Lines::TaskAlarms::take() -> std::optional<TaskID> {
+    while (!_due.empty()) {
+        const Alarm alarm = _due.front();
+        _due.pop_front();
+        if (alarm.generation == _entries[alarm.id].generation) {
+            // Reported once, until the deadline is set again
+            ++_entries[alarm.id].generation;
+            return alarm.id;
+        }
+    }
+    return std::nullopt;
+}
+
+void Lines::TaskAlarms::on_deadline_changed(
+    TaskID id, const Task &task, const std::optional<Temporal::TimePoint> & /*old_deadline*/) {
+    if (id < _entries.size() && _entries[id].tracked) {
+        arm(id, task);
+    }
+}
+
+void Lines::TaskAlarms::on_completion_changed(TaskID id, const Task &task) {
+    if (id < _entries.size() && _entries[id].tracked) {
+        arm(id, task);
+    }
+}
+
+// NextDueAwaitable
+
+Lines::NextDueAwaitable::~NextDueAwaitable() {
+    // Only a coroutine destroyed while waiting is still listed
+    std::erase(_alarms._waiters, this);
+}
+
+auto Lines::NextDueAwaitable::await_ready() -> bool {
+    _id = _alarms.take();
+    return _id.has_value();
+}
+
+void Lines::NextDueAwaitable::await_suspend(std::coroutine_handle<> handle) {
+    _handle = handle;
+    _alarms._waiters.push_back(this);
+}
@@ -0,0 +1,286 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/tasks/task_batch.hpp"
+#include "lines/temporal/datetime.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+#if LINES_HAS_SSE42
+#include <immintrin.h>
+#endif
+
+namespace {
+using Lines::Containers::Bitset;
+using Word = Bitset::Word;
+
+// Returns a word with bit i set if deadlines[i] < tp, for i < count <= 64.
+auto passed_word(const std::int64_t *deadlines, std::size_t count, std::int64_t tp) -> Word {
+    Word word = 0;
+    std::size_t i = 0;
+#if LINES_HAS_AVX2
+    const __m256i tpv = _mm256_set1_epi64x(tp);
+    for (; i + 4 <= count; i += 4) {
+        const __m256i dv =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(deadlines + i)); // NOLINT
+        const __m256i gt = _mm256_cmpgt_epi64(tpv, dv);
+        word |= static_cast<Word>(_mm256_movemask_pd(_mm256_castsi256_pd(gt))) << i;
+    }
+#elif LINES_HAS_SSE42
+    const __m128i tpv = _mm_set1_epi64x(tp);
+    for (; i + 2 <= count; i += 2) {
+        const __m128i dv =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(deadlines + i)); // NOLINT
+        const __m128i gt = _mm_cmpgt_epi64(tpv, dv);
+        word |= static_cast<Word>(_mm_movemask_pd(_mm_castsi128_pd(gt))) << i;
+    }
+#endif
+    for (; i < count; ++i) {
+        word |= static_cast<Word>(deadlines[i] < tp) << i; // NOLINT
+    }
+    return word;
+}
+
+auto block_size(std::size_t total, std::size_t word_index) -> std::size_t {
+    return std::min(Bitset::WORD_BITS, total - word_index * Bitset::WORD_BITS);
+}
+
+template <typename Combine>
+auto evaluate_columns(std::span<const std::int64_t> deadlines, const Bitset &completed,
+                      const Lines::Temporal::TimePoint &tp, Combine combine) -> Bitset {
+    if (completed.size() != deadlines.size()) {
+        throw std::invalid_argument("Lines::Tasks: deadline and completion columns differ in size");
+    }
+    Bitset result(deadlines.size());
+    const auto out = result.words();
+    const auto done = completed.words();
+    const std::int64_t now = tp.time_since_epoch().count();
+    for (std::size_t w = 0; w < out.size(); ++w) {
+        const std::size_t count = block_size(deadlines.size(), w);
+        const Word passed = passed_word(deadlines.data() + w * Bitset::WORD_BITS, count, now);
+        const Word valid = count == Bitset::WORD_BITS ? ~Word{0} : (Word{1} << count) - 1;
+        out[w] = combine(passed, done[w]) & valid;
+    }
+    return result;
+}
+
+// Fills words [first, last) of `out`
+template <typename Combine>
+void evaluate_words(std::span<const Lines::Task> tasks, std::int64_t now, Combine combine,
+                    std::span<Word> out, std::size_t first, std::size_t last) {
+    std::array<std::int64_t, Bitset::WORD_BITS> block{};
+    for (std::size_t w = first; w < last; ++w) {
+        const std::size_t count = block_size(tasks.size(), w);
+        Word done = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const Lines::Task &task = tasks[w * Bitset::WORD_BITS + i];
+            block[i] = Lines::Tasks::encode_deadline(task.deadline()); // NOLINT
+            done |= static_cast<Word>(task.completed()) << i;
+        }
+        const Word valid = count == Bitset::WORD_BITS ? ~Word{0} : (Word{1} << count) - 1;
+        out[w] = combine(passed_word(block.data(), count, now), done) & valid;
+    }
+}
+
+template <typename Combine>
+auto evaluate_tasks(std::span<const Lines::Task> tasks, const Lines::Temporal::TimePoint &tp,
+                    Combine combine) -> Bitset {
+    Bitset result(tasks.size());
+    const auto out = result.words();
+    evaluate_words(tasks, tp.time_since_epoch().count(), combine, out, 0, out.size());
+    return result;
+}
+
+// Words one executor call fills, threads never share a word
+LINES_CONSTEXPR std::size_t WORDS_PER_CALL = 64;
+
+template <typename Combine>
+auto evaluate_tasks(std::span<const Lines::Task> tasks, const Lines::Temporal::TimePoint &tp,
+                    Combine combine, Lines::Execution::Executor &executor) -> Bitset {
+    Bitset result(tasks.size());
+    const auto out = result.words();
+    const std::int64_t now = tp.time_since_epoch().count();
+    executor.bulk((out.size() + WORDS_PER_CALL - 1) / WORDS_PER_CALL, [&](std::size_t call) {
+        const std::size_t first = call * WORDS_PER_CALL;
+        evaluate_words(tasks, now, combine, out, first,
+                       std::min(out.size(), first + WORDS_PER_CALL));
+    });
+    return result;
+}
+
+auto active(Word passed, Word done) -> Word { return ~passed & ~done; }
+
+auto overdue(Word passed, Word done) -> Word { return passed & ~done; }
+
+// Tasks advance_deadlines() hands to the executor at a time
+LINES_CONSTEXPR std::size_t ADVANCE_CHUNK = 1024;
+
+// Offsets of the tasks of one chunk, split by the kind of their repeat rule
+struct RuleGroups {
+    std::array<std::uint16_t, ADVANCE_CHUNK> plain; // no rule or no deadline
+    std::array<std::uint16_t, ADVANCE_CHUNK> every_unit;
+    std::array<std::uint16_t, ADVANCE_CHUNK> every_weekday;
+    std::size_t plain_count = 0;
+    std::size_t every_unit_count = 0;
+    std::size_t every_weekday_count = 0;
+
+    explicit RuleGroups(std::span<const Lines::Task> tasks) {
+        for (std::size_t i = 0; i < tasks.size(); ++i) {
+            const Lines::Task &task = tasks[i];
+            const auto offset = static_cast<std::uint16_t>(i);
+            if (!task.deadline() || !task.repeat_rule()) {
+                plain[plain_count++] = offset;
+            } else if (std::holds_alternative<Lines::TaskRepeat::EveryUnit>(
+                           task.repeat_rule()->repeat_type)) {
+                every_unit[every_unit_count++] = offset;
+            } else {
+                every_weekday[every_weekday_count++] = offset;
+            }
+        }
+    }
+};
+} // namespace
+
+auto Lines::Tasks::encode_deadline(const std::optional<Temporal::TimePoint> &deadline)
+    -> std::int64_t {
+    return deadline ? deadline->time_since_epoch().count() : NO_DEADLINE;
+}
+
+auto Lines::Tasks::decode_deadline(std::int64_t deadline) -> std::optional<Temporal::TimePoint> {
+    if (deadline == NO_DEADLINE) {
+        return std::nullopt;
+    }
+    return Temporal::TimePoint{Temporal::Seconds{deadline}};
+}
+
+auto Lines::Tasks::deadline_column(std::span<const Task> tasks) -> std::vector<std::int64_t> {
+    std::vector<std::int64_t> column(tasks.size());
+    std::ranges::transform(tasks, column.begin(),
+                           [](const Task &task) { return encode_deadline(task.deadline()); });
+    return column;
+}
+
+auto Lines::Tasks::completion_bitset(std::span<const Task> tasks) -> Containers::Bitset {
+    Bitset bits(tasks.size());
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        bits.set(i, tasks[i].completed());
+    }
+    return bits;
+}
+
+auto Lines::Tasks::deadline_passed(std::span<const std::int64_t> deadlines,
+                                   const Temporal::TimePoint &tp) -> Containers::Bitset {
+    return evaluate_columns(deadlines, Bitset(deadlines.size()), tp,
+                            [](Word passed, Word /*done*/) { return passed; });
+}
+
+auto Lines::Tasks::is_active(std::span<const std::int64_t> deadlines,
+                             const Containers::Bitset &completed, const Temporal::TimePoint &tp)
+    -> Containers::Bitset {
+    return evaluate_columns(deadlines, completed, tp, active);
+}
+
+auto Lines::Tasks::is_overdue(std::span<const std::int64_t> deadlines,
+                              const Containers::Bitset &completed, const Temporal::TimePoint &tp)
+    -> Containers::Bitset {
+    return evaluate_columns(deadlines, completed, tp, overdue);
+}
+
+auto Lines::Tasks::is_active(std::span<const Task> tasks, const Temporal::TimePoint &tp)
+    -> Containers::Bitset {
+    return evaluate_tasks(tasks, tp, active);
+}
+
+auto Lines::Tasks::is_overdue(std::span<const Task> tasks, const Temporal::TimePoint &tp)
+    -> Containers::Bitset {
+    return evaluate_tasks(tasks, tp, overdue);
+}
+
+auto Lines::Tasks::is_active(std::span<const Task> tasks, const Temporal::TimePoint &tp,
+                             Execution::Executor &executor) -> Containers::Bitset {
+    return evaluate_tasks(tasks, tp, active, executor);
+}
+
+auto Lines::Tasks::is_overdue(std::span<const Task> tasks, const Temporal::TimePoint &tp,
+                              Execution::Executor &executor) -> Containers::Bitset {
+    return evaluate_tasks(tasks, tp, overdue, executor);
+}
+
+void Lines::Tasks::advance_deadlines(std::span<Task> tasks, const Temporal::TimePoint &completed_at,
+                                     Execution::Executor &executor) {
+    // Every task steps through the same days after completed_at
+    std::array<Temporal::Weekday, 7> weekdays{};
+    for (std::size_t day = 0; day < weekdays.size(); ++day) {
+        weekdays[day] =
+            Temporal::DateTime(completed_at + Temporal::Days{static_cast<int64_t>(day) + 1})
+                .date()
+                .weekday();
+    }
+    const auto within_end = [](const TaskRepeatRule &rule, const Temporal::TimePoint &deadline) {
+        return !rule.end || deadline <= *rule.end ? std::optional{deadline} : std::nullopt;
+    };
+
+    // Attached tasks are not touched by the workers, their new deadlines are
+    // applied afterwards in index order
+    using Pending = std::vector<std::pair<std::size_t, std::optional<Temporal::TimePoint>>>;
+    std::vector<Pending> pending((tasks.size() + ADVANCE_CHUNK - 1) / ADVANCE_CHUNK);
+
+    executor.bulk(pending.size(), [&](std::size_t chunk) {
+        const std::size_t begin = chunk * ADVANCE_CHUNK;
+        const auto part = tasks.subspan(begin, std::min(ADVANCE_CHUNK, tasks.size() - begin));
+        const RuleGroups groups{part};
+        const auto store = [&](std::size_t i, const std::optional<Temporal::TimePoint> &deadline) {
+            if (part[i].attached()) {
+                pending[chunk].emplace_back(begin + i, deadline);
+            } else {
+                part[i].set_deadline(deadline);
+            }
+        };
+
+        for (std::size_t k = 0; k < groups.plain_count; ++k) {
+            const std::size_t i = groups.plain[k];
+            store(i, part[i].next_deadline(completed_at));
+        }
+        for (std::size_t k = 0; k < groups.every_unit_count; ++k) {
+            const std::size_t i = groups.every_unit[k];
+            const TaskRepeatRule &rule = *part[i].repeat_rule();
+            const auto &unit = std::get<TaskRepeat::EveryUnit>(rule.repeat_type);
+            store(i, within_end(rule, completed_at + unit.interval));
+        }
+        for (std::size_t k = 0; k < groups.every_weekday_count; ++k) {
+            const std::size_t i = groups.every_weekday[k];
+            const TaskRepeatRule &rule = *part[i].repeat_rule();
+            const auto &days = std::get<TaskRepeat::EveryWeekday>(rule.repeat_type).weekdays;
+            std::optional<Temporal::TimePoint> deadline;
+            for (std::size_t day = 0; day < weekdays.size(); ++day) {
+                if (std::ranges::find(days, weekdays[day]) != days.end()) {
+                    deadline = within_end(
+                        rule, completed_at + Temporal::Days{static_cast<int64_t>(day) + 1});
+                    break;
+                }
+            }
+            store(i, deadline);
+        }
+        // Notifications follow index order, not group order
+        std::ranges::sort(pending[chunk], {}, [](const auto &entry) { return entry.first; });
+    });
+
+    for (const Pending &chunk : pending) {
+        for (const auto &[i, deadline] : chunk) {
+            tasks[i].set_deadline(deadline);
+        }
+    }
+}
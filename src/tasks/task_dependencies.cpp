@@ -0,0 +1,234 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/tasks/task_dependencies.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+auto Lines::TaskDependencyGraph::node(TaskID id) -> Node & {
+    if (id >= _nodes.size() || !_nodes[id].present) {
+        throw std::out_of_range("TaskDependencyGraph: unknown task");
+    }
+    return _nodes[id];
+}
+
+auto Lines::TaskDependencyGraph::node(TaskID id) const -> const Node & {
+    if (id >= _nodes.size() || !_nodes[id].present) {
+        throw std::out_of_range("TaskDependencyGraph: unknown task");
+    }
+    return _nodes[id];
+}
+
+void Lines::TaskDependencyGraph::update_ready(TaskID id) {
+    const Node &current = _nodes[id];
+    if (current.present && !current.completed && current.open_blockers == 0) {
+        _ready.add(id);
+    } else {
+        _ready.remove(id);
+    }
+}
+
+void Lines::TaskDependencyGraph::reorder(TaskID blocked, TaskID blocker) {
+    const std::uint64_t lower = _nodes[blocked].order;
+    const std::uint64_t upper = _nodes[blocker].order;
+    ++_mark;
+
+    // Tasks blocked by `blocked` that are ordered before `blocker`. Reaching
+    // blocker itself means it already waits for `blocked`.
+    std::vector<TaskID> forward{blocked};
+    _nodes[blocked].mark = _mark;
+    for (std::size_t i = 0; i < forward.size(); ++i) {
+        for (const TaskID next : _nodes[forward[i]].dependents) {
+            Node &reached = _nodes[next];
+            if (next == blocker) {
+                throw std::invalid_argument(
+                    "TaskDependencyGraph::add_dependency: dependency would close a cycle");
+            }
+            if (reached.mark != _mark && reached.order < upper) {
+                reached.mark = _mark;
+                forward.push_back(next);
+            }
+        }
+    }
+    // Blockers of `blocker` that are ordered after `blocked`
+    std::vector<TaskID> backward{blocker};
+    _nodes[blocker].mark = _mark;
+    for (std::size_t i = 0; i < backward.size(); ++i) {
+        for (const TaskID next : _nodes[backward[i]].blockers) {
+            Node &reached = _nodes[next];
+            if (reached.mark != _mark && reached.order > lower) {
+                reached.mark = _mark;
+                backward.push_back(next);
+            }
+        }
+    }
+
+    // The backward set takes the lowest of the orders both sets hold, each
+    // set keeping its internal order
+    const auto by_order = [this](TaskID id) { return _nodes[id].order; };
+    std::ranges::sort(forward, {}, by_order);
+    std::ranges::sort(backward, {}, by_order);
+    std::vector<std::uint64_t> orders;
+    orders.reserve(forward.size() + backward.size());
+    for (const TaskID id : backward) {
+        orders.push_back(_nodes[id].order);
+    }
+    for (const TaskID id : forward) {
+        orders.push_back(_nodes[id].order);
+    }
+    std::ranges::sort(orders);
+    std::size_t next = 0;
+    for (const TaskID id : backward) {
+        _nodes[id].order = orders[next++];
+    }
+    for (const TaskID id : forward) {
+        _nodes[id].order = orders[next++];
+    }
+}
+
+void Lines::TaskDependencyGraph::track(Task &task, TaskID id) {
+    if (task.attached()) {
+        throw std::invalid_argument("TaskDependencyGraph::track: task is already attached");
+    }
+    insert(id, task.completed());
+    task.attach(*this, id);
+}
+
+void Lines::TaskDependencyGraph::untrack(Task &task) {
+    if (const auto id = task.id(); id && contains(*id)) {
+        erase(*id);
+    }
+    task.detach();
+}
+
+void Lines::TaskDependencyGraph::insert(TaskID id, bool completed) {
+    if (contains(id)) {
+        throw std::invalid_argument("TaskDependencyGraph::insert: task is already present");
+    }
+    if (id >= _nodes.size()) {
+        _nodes.resize(std::size_t{id} + 1);
+    }
+    Node &added = _nodes[id];
+    added.present = true;
+    added.completed = completed;
+    added.order = _next_order++;
+    ++_size;
+    update_ready(id);
+}
+
+void Lines::TaskDependencyGraph::erase(TaskID id) {
+    Node &erased = node(id);
+    // Copies, removing a dependency edits both lists
+    for (const TaskID blocker : std::vector<TaskID>{erased.blockers}) {
+        remove_dependency(id, blocker);
+    }
+    for (const TaskID blocked : std::vector<TaskID>{erased.dependents}) {
+        remove_dependency(blocked, id);
+    }
+    _nodes[id] = Node{};
+    --_size;
+    _ready.remove(id);
+}
+
+void Lines::TaskDependencyGraph::set_completed(TaskID id, bool completed) {
+    Node &changed = node(id);
+    if (changed.completed == completed) {
+        return;
+    }
+    changed.completed = completed;
+    update_ready(id);
+    for (const TaskID blocked : changed.dependents) {
+        Node &dependent = _nodes[blocked];
+        if (completed) {
+            --dependent.open_blockers;
+        } else {
+            ++dependent.open_blockers;
+        }
+        update_ready(blocked);
+    }
+}
+
+auto Lines::TaskDependencyGraph::add_dependency(TaskID blocked, TaskID blocker) -> bool {
+    Node &to = node(blocked);
+    Node &from = node(blocker);
+    if (blocked == blocker) {
+        throw std::invalid_argument(
+            "TaskDependencyGraph::add_dependency: dependency would close a cycle");
+    }
+    if (std::ranges::find(from.dependents, blocked) != from.dependents.end()) {
+        return false;
+    }
+    if (from.order > to.order) {
+        reorder(blocked, blocker);
+    }
+    from.dependents.push_back(blocked);
+    to.blockers.push_back(blocker);
+    ++_edges;
+    if (!from.completed) {
+        ++to.open_blockers;
+        update_ready(blocked);
+    }
+    return true;
+}
+
+auto Lines::TaskDependencyGraph::remove_dependency(TaskID blocked, TaskID blocker) -> bool {
+    Node &to = node(blocked);
+    Node &from = node(blocker);
+    const auto it = std::ranges::find(from.dependents, blocked);
+    if (it == from.dependents.end()) {
+        return false;
+    }
+    from.dependents.erase(it);
+    std::erase(to.blockers, blocker);
+    --_edges;
+    if (!from.completed) {
+        --to.open_blockers;
+        update_ready(blocked);
+    }
+    return true;
+}
+
+auto Lines::TaskDependencyGraph::contains(TaskID id) const -> bool {
+    return id < _nodes.size() && _nodes[id].present;
+}
+
+auto Lines::TaskDependencyGraph::blockers(TaskID id) const -> std::span<const TaskID> {
+    return node(id).blockers;
+}
+
+auto Lines::TaskDependencyGraph::dependents(TaskID id) const -> std::span<const TaskID> {
+    return node(id).dependents;
+}
+
+auto Lines::TaskDependencyGraph::precedes(TaskID lhs, TaskID rhs) const -> bool {
+    return node(lhs).order < node(rhs).order;
+}
+
+auto Lines::TaskDependencyGraph::topological_order() const -> std::vector<TaskID> {
+    std::vector<TaskID> result;
+    result.reserve(_size);
+    for (TaskID id = 0; id < _nodes.size(); ++id) {
+        if (_nodes[id].present) {
+            result.push_back(id);
+        }
+    }
+    std::ranges::sort(result, {}, [this](TaskID id) { return _nodes[id].order; });
+    return result;
+}
+
+void Lines::TaskDependencyGraph::on_completion_changed(TaskID id, const Task &task) {
+    if (contains(id)) {
+        set_completed(id, task.completed());
+    }
+}
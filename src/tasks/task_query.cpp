@@ -0,0 +1,652 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/tasks/task_query.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+using Lines::TaskID;
+using Lines::TaskPredicate;
+using Lines::Temporal::TimePoint;
+
+// A bitmap operand is only materialized while it is at most this many times
+// larger than the candidates left, otherwise the candidates are checked one
+// by one
+LINES_CONSTEXPR std::size_t SCAN_RATIO = 4;
+
+auto within(const TaskPredicate &predicate, const TimePoint &deadline) -> bool {
+    return (!predicate.from() || *predicate.from() <= deadline) &&
+           (!predicate.to() || deadline < *predicate.to());
+}
+
+auto is_leaf(const TaskPredicate &predicate) -> bool {
+    using Op = TaskPredicate::Op;
+    return predicate.op() != Op::And && predicate.op() != Op::Or && predicate.op() != Op::Not;
+}
+
+auto describe(const TaskPredicate &predicate) -> std::string {
+    const auto bound = [](const std::optional<TimePoint> &tp, std::string_view open) {
+        return tp ? std::to_string(tp->time_since_epoch().count()) : std::string{open};
+    };
+    switch (predicate.op()) {
+    case TaskPredicate::Op::All:
+        return "all";
+    case TaskPredicate::Op::Tag:
+        return "tag \"" + predicate.text() + "\"";
+    case TaskPredicate::Op::Completed:
+        return "completed";
+    case TaskPredicate::Op::Repeating:
+        return "repeating";
+    case TaskPredicate::Op::HasDeadline:
+        return "has deadline";
+    case TaskPredicate::Op::DeadlineIn:
+        return "deadline in [" + bound(predicate.from(), "-inf") + ", " +
+               bound(predicate.to(), "inf") + ")";
+    case TaskPredicate::Op::TitlePrefix:
+        return "title prefix \"" + predicate.text() + "\"";
+    case TaskPredicate::Op::And:
+        return "and";
+    case TaskPredicate::Op::Or:
+        return "or";
+    case TaskPredicate::Op::Not: {
+        const auto &operand = predicate.operands().front();
+        return is_leaf(operand) ? "not " + describe(operand) : "not";
+    }
+    }
+    LINES_UNREACHABLE();
+}
+} // namespace
+
+// Plan lines collected by TaskQueryIndex::explain(), a step's line is
+// reserved before its operands are planned so that it precedes them
+class Lines::TaskQueryIndex::Explain {
+    std::vector<std::string> _lines;
+
+  public:
+    static auto reserve(Explain *explain) -> std::size_t {
+        if (explain == nullptr) {
+            return 0;
+        }
+        explain->_lines.emplace_back();
+        return explain->_lines.size() - 1;
+    }
+
+    static void set(Explain *explain, std::size_t line, std::size_t depth, std::string_view label,
+                    std::string_view method, std::size_t count) {
+        if (explain != nullptr) {
+            explain->_lines[line] = std::string(depth * 2, ' ') + std::string{label} + ": " +
+                                    std::string{method} + " -> " + std::to_string(count);
+        }
+    }
+
+    static void add(Explain *explain, std::string line) {
+        if (explain != nullptr) {
+            explain->_lines.push_back(std::move(line));
+        }
+    }
+
+    LINES_NODISCARD auto str() const -> std::string {
+        std::string result;
+        for (const auto &line : _lines) {
+            result += line;
+            result += '\n';
+        }
+        return result;
+    }
+};
+
+// TaskPredicate
+
+auto Lines::TaskPredicate::tag(std::string tag) -> TaskPredicate {
+    TaskPredicate predicate{Op::Tag, {}};
+    predicate._text = std::move(tag);
+    return predicate;
+}
+
+auto Lines::TaskPredicate::deadline_in(std::optional<Temporal::TimePoint> from,
+                                       std::optional<Temporal::TimePoint> to) -> TaskPredicate {
+    TaskPredicate predicate{Op::DeadlineIn, {}};
+    predicate._from = std::move(from);
+    predicate._to = std::move(to);
+    return predicate;
+}
+
+auto Lines::TaskPredicate::title_prefix(std::string prefix) -> TaskPredicate {
+    TaskPredicate predicate{Op::TitlePrefix, {}};
+    predicate._text = std::move(prefix);
+    return predicate;
+}
+
+auto Lines::TaskPredicate::matches(const Task &task) const -> bool {
+    switch (_op) {
+    case Op::All:
+        return true;
+    case Op::Tag:
+        return std::ranges::any_of(
+            task.info().tags, [&](const auto &tag) { return std::string_view{tag} == _text; });
+    case Op::Completed:
+        return task.completed();
+    case Op::Repeating:
+        return task.repeat_rule().has_value();
+    case Op::HasDeadline:
+        return task.deadline().has_value();
+    case Op::DeadlineIn:
+        return task.deadline() && within(*this, *task.deadline());
+    case Op::TitlePrefix:
+        return std::string_view{task.title()}.starts_with(_text);
+    case Op::And:
+        return std::ranges::all_of(_operands, [&](const auto &operand) {
+            return operand.matches(task);
+        });
+    case Op::Or:
+        return std::ranges::any_of(_operands, [&](const auto &operand) {
+            return operand.matches(task);
+        });
+    case Op::Not:
+        return !_operands.front().matches(task);
+    }
+    LINES_UNREACHABLE();
+}
+
+// TaskQueryIndex
+
+auto Lines::TaskQueryIndex::entry(TaskID id) -> Entry * {
+    return id < _entries.size() && _entries[id].tracked ? &_entries[id] : nullptr;
+}
+
+auto Lines::TaskQueryIndex::entry(TaskID id) const -> const Entry * {
+    return id < _entries.size() && _entries[id].tracked ? &_entries[id] : nullptr;
+}
+
+void Lines::TaskQueryIndex::set_deadline(TaskID id, Entry &entry,
+                                         const std::optional<Temporal::TimePoint> &deadline) {
+    if (entry.deadline) {
+        _deadlines.erase({*entry.deadline, id});
+        _dated.remove(id);
+    }
+    entry.deadline = deadline;
+    if (entry.deadline) {
+        _deadlines.emplace(*entry.deadline, id);
+        _dated.add(id);
+    }
+}
+
+void Lines::TaskQueryIndex::track(Task &task, TaskID id) {
+    if (task.attached()) {
+        throw std::invalid_argument("TaskQueryIndex::track: task is already attached");
+    }
+    insert(id, task);
+    task.attach(*this, id);
+}
+
+void Lines::TaskQueryIndex::untrack(Task &task) {
+    if (const auto id = task.id()) {
+        erase(*id, task);
+    }
+    task.detach();
+}
+
+void Lines::TaskQueryIndex::insert(TaskID id, const Task &task) {
+    if (entry(id) != nullptr) {
+        throw std::invalid_argument("TaskQueryIndex::insert: task is already indexed");
+    }
+    _tags.insert(id, task.info().tags);
+    if (id >= _entries.size()) {
+        _entries.resize(std::size_t{id} + 1);
+    }
+    add_entry(id, task);
+}
+
+void Lines::TaskQueryIndex::insert(TaskID first, std::span<const Task> tasks,
+                                  Execution::Executor &executor) {
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        if (entry(static_cast<TaskID>(first + i)) != nullptr) {
+            throw std::invalid_argument("TaskQueryIndex::insert: task is already indexed");
+        }
+    }
+    _tags.insert(first, tasks, executor);
+    const std::size_t end = static_cast<std::size_t>(first) + tasks.size();
+    if (end > _entries.size()) {
+        _entries.resize(end);
+    }
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        add_entry(static_cast<TaskID>(first + i), tasks[i]);
+    }
+}
+
+void Lines::TaskQueryIndex::add_entry(TaskID id, const Task &task) {
+    Entry &added = _entries[id];
+    added.tracked = true;
+    added.title = _titles.emplace(std::string{task.title()}, id).first;
+    if (task.completed()) {
+        _completed.add(id);
+    }
+    if (task.repeat_rule()) {
+        _repeating.add(id);
+    }
+    set_deadline(id, added, task.deadline());
+}
+
+void Lines::TaskQueryIndex::erase(TaskID id, const Task &task) {
+    Entry *erased = entry(id);
+    if (erased == nullptr) {
+        return;
+    }
+    _tags.erase(id, task.info().tags);
+    _titles.erase(erased->title);
+    _completed.remove(id);
+    _repeating.remove(id);
+    set_deadline(id, *erased, std::nullopt);
+    *erased = Entry{};
+}
+
+auto Lines::TaskQueryIndex::estimate(const TaskPredicate &predicate, std::size_t cap) const
+    -> std::size_t {
+    using Op = TaskPredicate::Op;
+    // Ordered indexes are counted by walking them, never further than `cap`
+    const auto walk = [cap](auto first, auto last, auto &&in_range) {
+        std::size_t count = 0;
+        for (; first != last && count < cap && in_range(*first); ++first) {
+            ++count;
+        }
+        return count;
+    };
+    std::size_t result = 0;
+    switch (predicate.op()) {
+    case Op::All:
+        result = size();
+        break;
+    case Op::Tag:
+        if (const auto tag = _tags.interner().find(predicate.text())) {
+            result = _tags.tasks_with(*tag).cardinality();
+        }
+        break;
+    case Op::Completed:
+        result = _completed.cardinality();
+        break;
+    case Op::Repeating:
+        result = _repeating.cardinality();
+        break;
+    case Op::HasDeadline:
+        result = _dated.cardinality();
+        break;
+    case Op::DeadlineIn:
+        result = walk(predicate.from() ? _deadlines.lower_bound({*predicate.from(), 0})
+                                       : _deadlines.begin(),
+                      _deadlines.end(), [&](const auto &due) {
+                          return !predicate.to() || due.first < *predicate.to();
+                      });
+        break;
+    case Op::TitlePrefix:
+        result = walk(_titles.lower_bound({predicate.text(), 0}), _titles.end(),
+                      [&](const auto &title) { return title.first.starts_with(predicate.text()); });
+        break;
+    case Op::And:
+        result = size();
+        for (const auto &operand : predicate.operands()) {
+            if (operand.op() != Op::Not) {
+                result = std::min(result, estimate(operand, std::min(cap, result)));
+            }
+        }
+        break;
+    case Op::Or:
+        for (const auto &operand : predicate.operands()) {
+            result += estimate(operand, cap);
+            if (result >= cap) {
+                break;
+            }
+        }
+        break;
+    case Op::Not:
+        result = size() - std::min(size(), estimate(predicate.operands().front(), size()));
+        break;
+    }
+    return std::min(result, cap);
+}
+
+auto Lines::TaskQueryIndex::test(const TaskPredicate &predicate, TaskID id) const -> bool {
+    using Op = TaskPredicate::Op;
+    switch (predicate.op()) {
+    case Op::All:
+        return entry(id) != nullptr;
+    case Op::Tag: {
+        const auto tag = _tags.interner().find(predicate.text());
+        return tag && _tags.tasks_with(*tag).contains(id);
+    }
+    case Op::Completed:
+        return _completed.contains(id);
+    case Op::Repeating:
+        return _repeating.contains(id);
+    case Op::HasDeadline:
+        return _dated.contains(id);
+    case Op::DeadlineIn: {
+        const Entry *found = entry(id);
+        return found != nullptr && found->deadline && within(predicate, *found->deadline);
+    }
+    case Op::TitlePrefix: {
+        const Entry *found = entry(id);
+        return found != nullptr && found->title->first.starts_with(predicate.text());
+    }
+    case Op::And:
+        return std::ranges::all_of(predicate.operands(),
+                                   [&](const auto &operand) { return test(operand, id); });
+    case Op::Or:
+        return std::ranges::any_of(predicate.operands(),
+                                   [&](const auto &operand) { return test(operand, id); });
+    case Op::Not:
+        return !test(predicate.operands().front(), id);
+    }
+    LINES_UNREACHABLE();
+}
+
+auto Lines::TaskQueryIndex::lookup(const TaskPredicate &predicate, Explain *explain,
+                                   std::size_t depth, std::string &method) const -> Bitmap {
+    using Op = TaskPredicate::Op;
+    method = "index";
+    switch (predicate.op()) {
+    case Op::All:
+        method = "all tasks";
+        return _tags.tasks();
+    case Op::Tag:
+        if (const auto tag = _tags.interner().find(predicate.text())) {
+            return _tags.tasks_with(*tag);
+        }
+        return {};
+    case Op::Completed:
+        return _completed;
+    case Op::Repeating:
+        return _repeating;
+    case Op::HasDeadline:
+        return _dated;
+    case Op::DeadlineIn: {
+        Bitmap result;
+        auto it = predicate.from() ? _deadlines.lower_bound({*predicate.from(), 0})
+                                   : _deadlines.begin();
+        for (; it != _deadlines.end() && (!predicate.to() || it->first < *predicate.to()); ++it) {
+            result.add(it->second);
+        }
+        return result;
+    }
+    case Op::TitlePrefix: {
+        Bitmap result;
+        for (auto it = _titles.lower_bound({predicate.text(), 0});
+             it != _titles.end() && it->first.starts_with(predicate.text()); ++it) {
+            result.add(it->second);
+        }
+        return result;
+    }
+    case Op::And:
+        return conjunction(predicate, explain, depth, method);
+    case Op::Or: {
+        method = "union";
+        Bitmap result;
+        for (const auto &operand : predicate.operands()) {
+            const std::size_t line = Explain::reserve(explain);
+            std::string operand_method;
+            const Bitmap matches = lookup(operand, explain, depth + 1, operand_method);
+            result |= matches;
+            Explain::set(explain, line, depth, describe(operand), operand_method,
+                         matches.cardinality());
+        }
+        return result;
+    }
+    case Op::Not: {
+        Bitmap result =
+            _tags.tasks() - lookup(predicate.operands().front(), explain, depth, method);
+        method += ", complement";
+        return result;
+    }
+    }
+    LINES_UNREACHABLE();
+}
+
+auto Lines::TaskQueryIndex::conjunction(const TaskPredicate &predicate, Explain *explain,
+                                        std::size_t depth, std::string &method) const -> Bitmap {
+    struct Step {
+        const TaskPredicate *operand;
+        std::size_t estimate;
+    };
+    // Positive operands go first, most selective first, negated ones are
+    // applied to what is left
+    std::vector<Step> steps;
+    std::size_t cap = size();
+    for (const auto &operand : predicate.operands()) {
+        if (operand.op() != TaskPredicate::Op::Not) {
+            steps.push_back({&operand, estimate(operand, cap)});
+            cap = std::min(cap, steps.back().estimate);
+        }
+    }
+    std::ranges::stable_sort(steps, {}, &Step::estimate);
+    for (const auto &operand : predicate.operands()) {
+        if (operand.op() == TaskPredicate::Op::Not) {
+            steps.push_back({&operand, 0});
+        }
+    }
+
+    method = "intersect";
+    Bitmap result;
+    std::size_t first = 0;
+    if (steps.empty() || steps.front().operand->op() == TaskPredicate::Op::Not) {
+        result = _tags.tasks();
+        Explain::set(explain, Explain::reserve(explain), depth, "all", "all tasks",
+                     result.cardinality());
+    } else {
+        const std::size_t line = Explain::reserve(explain);
+        std::string operand_method;
+        result = lookup(*steps.front().operand, explain, depth + 1, operand_method);
+        Explain::set(explain, line, depth, describe(*steps.front().operand), operand_method,
+                     result.cardinality());
+        first = 1;
+    }
+
+    for (std::size_t i = first; i < steps.size(); ++i) {
+        const TaskPredicate &operand = *steps[i].operand;
+        const bool negated = operand.op() == TaskPredicate::Op::Not;
+        const TaskPredicate &target = negated ? operand.operands().front() : operand;
+        const std::size_t line = Explain::reserve(explain);
+        if (result.empty()) {
+            Explain::set(explain, line, depth, describe(operand), "skipped", 0);
+            continue;
+        }
+        const std::size_t candidates = result.cardinality();
+        const std::size_t threshold = candidates * SCAN_RATIO;
+        std::string operand_method;
+        if (estimate(target, threshold + 1) > threshold) {
+            Bitmap kept;
+            result.for_each([&](TaskID id) {
+                if (test(target, id) != negated) {
+                    kept.add(id);
+                }
+            });
+            result = std::move(kept);
+            operand_method = "scan " + std::to_string(candidates) + " candidates";
+        } else {
+            const Bitmap matches = lookup(target, explain, depth + 1, operand_method);
+            if (negated) {
+                result -= matches;
+                operand_method += ", subtract";
+            } else {
+                result &= matches;
+                operand_method += ", intersect";
+            }
+        }
+        Explain::set(explain, line, depth, describe(operand), operand_method,
+                     result.cardinality());
+    }
+    return result;
+}
+
+auto Lines::TaskQueryIndex::by_deadline(const Bitmap &matches, std::size_t count,
+                                        Explain *explain) const -> std::vector<TaskID> {
+    std::vector<TaskID> result;
+    const std::size_t total = matches.cardinality();
+    if (count == 0) {
+        Explain::add(explain, "order by deadline: nothing to order");
+        return result;
+    }
+    result.reserve(count);
+
+    // Walking the deadline index visits about count / density entries, the
+    // heap visits every match
+    const Bitmap undated = matches - _dated;
+    const std::size_t dated = total - undated.cardinality();
+    const std::size_t walk =
+        dated == 0 ? 0 : std::min(_deadlines.size(), count * _deadlines.size() / dated);
+    if (walk < total) {
+        std::size_t visited = 0;
+        for (auto it = _deadlines.begin(); it != _deadlines.end() && result.size() < count; ++it) {
+            ++visited;
+            if (matches.contains(it->second)) {
+                result.push_back(it->second);
+            }
+        }
+        undated.for_each([&](TaskID id) {
+            if (result.size() < count) {
+                result.push_back(id);
+            }
+        });
+        Explain::add(explain, "order by deadline: index walk over " + std::to_string(visited) +
+                                  " deadlines -> " + std::to_string(result.size()));
+        return result;
+    }
+
+    struct Key {
+        const std::optional<Temporal::TimePoint> *deadline;
+        TaskID id;
+    };
+    const auto earlier = [](const Key &lhs, const Key &rhs) {
+        if (lhs.deadline->has_value() != rhs.deadline->has_value()) {
+            return lhs.deadline->has_value();
+        }
+        if (lhs.deadline->has_value() && **lhs.deadline != **rhs.deadline) {
+            return **lhs.deadline < **rhs.deadline;
+        }
+        return lhs.id < rhs.id;
+    };
+    // Max-heap of the `count` earliest keys seen so far
+    std::vector<Key> heap;
+    heap.reserve(count + 1);
+    matches.for_each([&](TaskID id) {
+        const Key key{&entry(id)->deadline, id};
+        if (heap.size() == count && !earlier(key, heap.front())) {
+            return;
+        }
+        heap.push_back(key);
+        std::ranges::push_heap(heap, earlier);
+        if (heap.size() > count) {
+            std::ranges::pop_heap(heap, earlier);
+            heap.pop_back();
+        }
+    });
+    std::ranges::sort_heap(heap, earlier);
+    for (const Key &key : heap) {
+        result.push_back(key.id);
+    }
+    Explain::add(explain, "order by deadline: heap top " + std::to_string(count) + " of " +
+                              std::to_string(total) + " -> " + std::to_string(result.size()));
+    return result;
+}
+
+auto Lines::TaskQueryIndex::execute(const TaskQuery &query, Explain *explain) const
+    -> std::vector<TaskID> {
+    const std::size_t line = Explain::reserve(explain);
+    std::string method;
+    const Bitmap matches = lookup(query.where, explain, 1, method);
+    const std::size_t total = matches.cardinality();
+    Explain::set(explain, line, 0, describe(query.where), method, total);
+
+    // Only the first offset + limit matches in query order are needed
+    const std::size_t count =
+        query.limit >= total || query.offset >= total - query.limit ? total
+                                                                    : query.offset + query.limit;
+    std::vector<TaskID> result;
+    if (query.order == TaskOrder::Deadline) {
+        result = by_deadline(matches, count, explain);
+    } else {
+        result.reserve(count);
+        matches.for_each([&](TaskID id) {
+            if (result.size() < count) {
+                result.push_back(id);
+            }
+        });
+        Explain::add(explain, "order by id -> " + std::to_string(result.size()));
+    }
+    const auto skipped = static_cast<std::ptrdiff_t>(std::min(query.offset, result.size()));
+    result.erase(result.begin(), result.begin() + skipped);
+    Explain::add(explain, "offset " + std::to_string(query.offset) + ", limit " +
+                              (query.limit == TaskQuery::NO_LIMIT ? std::string{"none"}
+                                                                  : std::to_string(query.limit)) +
+                              " -> " + std::to_string(result.size()));
+    return result;
+}
+
+auto Lines::TaskQueryIndex::select(const TaskPredicate &predicate) const
+    -> Containers::RoaringBitmap {
+    std::string method;
+    return lookup(predicate, nullptr, 0, method);
+}
+
+auto Lines::TaskQueryIndex::run(const TaskQuery &query) const -> std::vector<TaskID> {
+    return execute(query, nullptr);
+}
+
+auto Lines::TaskQueryIndex::explain(const TaskQuery &query) const -> std::string {
+    Explain explain;
+    execute(query, &explain);
+    return explain.str();
+}
+
+void Lines::TaskQueryIndex::on_title_changed(TaskID id, const Task &task,
+                                             const std::pmr::string & /*old_title*/) {
+    if (Entry *changed = entry(id)) {
+        _titles.erase(changed->title);
+        changed->title = _titles.emplace(std::string{task.title()}, id).first;
+    }
+}
+
+void Lines::TaskQueryIndex::on_tags_changed(TaskID id, const Task &task, const Tags &old_tags) {
+    if (entry(id) != nullptr) {
+        _tags.on_tags_changed(id, task, old_tags);
+    }
+}
+
+void Lines::TaskQueryIndex::on_deadline_changed(
+    TaskID id, const Task &task, const std::optional<Temporal::TimePoint> & /*old_deadline*/) {
+    if (Entry *changed = entry(id)) {
+        set_deadline(id, *changed, task.deadline());
+    }
+}
+
+void Lines::TaskQueryIndex::on_completion_changed(TaskID id, const Task &task) {
+    if (entry(id) == nullptr) {
+        return;
+    }
+    if (task.completed()) {
+        _completed.add(id);
+    } else {
+        _completed.remove(id);
+    }
+}
+
+void Lines::TaskQueryIndex::on_repeat_rule_changed(TaskID id, const Task &task) {
+    if (entry(id) == nullptr) {
+        return;
+    }
+    if (task.repeat_rule()) {
+        _repeating.add(id);
+    } else {
+        _repeating.remove(id);
+    }
+}
@@ -0,0 +1,244 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/tasks/task_sort.hpp"
+#include "lines/tasks/task_batch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace {
+using Lines::Task;
+
+// Below this many keys the histogram passes cost more than comparisons
+LINES_CONSTEXPR std::size_t RADIX_MIN = 256;
+LINES_CONSTEXPR std::size_t RADIX_BITS = 8;
+LINES_CONSTEXPR std::size_t RADIX_PASSES = 64 / RADIX_BITS;
+
+struct Keyed {
+    std::uint64_t key;
+    std::uint32_t index;
+};
+
+auto earlier(const Keyed &lhs, const Keyed &rhs) -> bool {
+    return lhs.key != rhs.key ? lhs.key < rhs.key : lhs.index < rhs.index;
+}
+
+// Flipping the sign bit makes the signed encoding order as unsigned
+auto key_of(const Task &task) -> std::uint64_t {
+    return static_cast<std::uint64_t>(Lines::Tasks::encode_deadline(task.deadline())) ^
+           (std::uint64_t{1} << 63U);
+}
+
+auto digit(std::uint64_t key, std::size_t pass) -> std::size_t {
+    return (key >> (pass * RADIX_BITS)) & ((1U << RADIX_BITS) - 1);
+}
+
+// Stable LSD radix sort by key. All histograms are built in one read, passes
+// over a digit every key shares, usually the high bytes of nearby
+// timestamps, are skipped.
+void radix_sort(std::vector<Keyed> &items) {
+    if (items.size() < RADIX_MIN) {
+        std::ranges::stable_sort(items, {}, &Keyed::key);
+        return;
+    }
+    std::array<std::array<std::size_t, 1U << RADIX_BITS>, RADIX_PASSES> counts{};
+    for (const Keyed &item : items) {
+        for (std::size_t pass = 0; pass < RADIX_PASSES; ++pass) {
+            ++counts[pass][digit(item.key, pass)];
+        }
+    }
+    std::vector<Keyed> buffer(items.size());
+    for (std::size_t pass = 0; pass < RADIX_PASSES; ++pass) {
+        auto &offsets = counts[pass];
+        if (offsets[digit(items.front().key, pass)] == items.size()) {
+            continue;
+        }
+        std::size_t offset = 0;
+        for (std::size_t &count : offsets) {
+            offset += std::exchange(count, offset);
+        }
+        for (const Keyed &item : items) {
+            buffer[offsets[digit(item.key, pass)]++] = item;
+        }
+        items.swap(buffer);
+    }
+}
+
+template <typename IndexOf>
+auto top_k(std::size_t count, IndexOf index_of, std::span<const Task> tasks, std::size_t k)
+    -> std::vector<std::uint32_t> {
+    k = std::min(k, count);
+    // Max-heap of the k earliest (key, position) pairs seen so far
+    std::vector<Keyed> heap;
+    heap.reserve(k);
+    for (std::size_t position = 0; position < count && k != 0; ++position) {
+        const Keyed item{key_of(tasks[index_of(position)]), static_cast<std::uint32_t>(position)};
+        if (heap.size() < k) {
+            heap.push_back(item);
+            std::ranges::push_heap(heap, earlier);
+        } else if (item.key < heap.front().key) {
+            std::ranges::pop_heap(heap, earlier);
+            heap.back() = item;
+            std::ranges::push_heap(heap, earlier);
+        }
+    }
+    std::ranges::sort_heap(heap, earlier);
+    std::vector<std::uint32_t> result;
+    result.reserve(heap.size());
+    for (const Keyed &item : heap) {
+        result.push_back(static_cast<std::uint32_t>(index_of(item.index)));
+    }
+    return result;
+}
+
+void sort_by_key(std::span<std::uint32_t> permutation, std::span<const Task> tasks,
+                 Lines::Tasks::SortKey key) {
+    switch (key) {
+    case Lines::Tasks::SortKey::Deadline:
+        Lines::Tasks::sort_by_deadline(permutation, tasks);
+        break;
+    case Lines::Tasks::SortKey::Completed:
+        std::ranges::stable_partition(
+            permutation, [&](std::uint32_t index) { return !tasks[index].completed(); });
+        break;
+    case Lines::Tasks::SortKey::Title:
+        std::ranges::stable_sort(permutation, {}, [&](std::uint32_t index) {
+            return std::string_view{tasks[index].title()};
+        });
+        break;
+    }
+}
+
+auto same_key(const Task &lhs, const Task &rhs, Lines::Tasks::SortKey key) -> bool {
+    switch (key) {
+    case Lines::Tasks::SortKey::Deadline:
+        return lhs.deadline() == rhs.deadline();
+    case Lines::Tasks::SortKey::Completed:
+        return lhs.completed() == rhs.completed();
+    case Lines::Tasks::SortKey::Title:
+        return std::string_view{lhs.title()} == std::string_view{rhs.title()};
+    }
+    LINES_UNREACHABLE();
+}
+} // namespace
+
+auto Lines::Tasks::identity_permutation(std::span<const Task> tasks)
+    -> std::vector<std::uint32_t> {
+    if (tasks.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("Tasks::identity_permutation: too many tasks");
+    }
+    std::vector<std::uint32_t> permutation(tasks.size());
+    for (std::size_t i = 0; i < permutation.size(); ++i) {
+        permutation[i] = static_cast<std::uint32_t>(i);
+    }
+    return permutation;
+}
+
+auto Lines::Tasks::sort_by_deadline(std::span<const Task> tasks) -> std::vector<std::uint32_t> {
+    auto permutation = identity_permutation(tasks);
+    sort_by_deadline(permutation, tasks);
+    return permutation;
+}
+
+void Lines::Tasks::sort_by_deadline(std::span<std::uint32_t> permutation,
+                                    std::span<const Task> tasks) {
+    std::vector<Keyed> items;
+    items.reserve(permutation.size());
+    for (const std::uint32_t index : permutation) {
+        items.push_back({key_of(tasks[index]), index});
+    }
+    radix_sort(items);
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        permutation[i] = items[i].index;
+    }
+}
+
+void Lines::Tasks::sort_by_deadline(std::span<Task> tasks) {
+    apply_permutation(tasks, sort_by_deadline(std::span<const Task>{tasks}));
+}
+
+void Lines::Tasks::sort_by(std::span<std::uint32_t> permutation, std::span<const Task> tasks,
+                           std::initializer_list<SortKey> keys) {
+    sort_by(permutation, tasks, std::span<const SortKey>{keys.begin(), keys.size()});
+}
+
+void Lines::Tasks::sort_by(std::span<std::uint32_t> permutation, std::span<const Task> tasks,
+                           std::span<const SortKey> keys) {
+    if (keys.empty() || permutation.size() < 2) {
+        return;
+    }
+    sort_by_key(permutation, tasks, keys.front());
+    if (keys.size() == 1) {
+        return;
+    }
+    // Only runs tied on this key need the next ones
+    std::size_t run = 0;
+    for (std::size_t i = 1; i <= permutation.size(); ++i) {
+        if (i == permutation.size() ||
+            !same_key(tasks[permutation[run]], tasks[permutation[i]], keys.front())) {
+            if (i - run > 1) {
+                sort_by(permutation.subspan(run, i - run), tasks, keys.subspan(1));
+            }
+            run = i;
+        }
+    }
+}
+
+auto Lines::Tasks::top_by_deadline(std::span<const Task> tasks, std::size_t k)
+    -> std::vector<std::uint32_t> {
+    return top_k(tasks.size(), [](std::size_t position) { return position; }, tasks, k);
+}
+
+auto Lines::Tasks::top_by_deadline(std::span<const std::uint32_t> permutation,
+                                   std::span<const Task> tasks, std::size_t k)
+    -> std::vector<std::uint32_t> {
+    return top_k(
+        permutation.size(), [&](std::size_t position) { return permutation[position]; }, tasks,
+        k);
+}
+
+void Lines::Tasks::apply_permutation(std::span<Task> tasks,
+                                     std::span<const std::uint32_t> permutation) {
+    if (permutation.size() != tasks.size()) {
+        throw std::invalid_argument("Tasks::apply_permutation: permutation does not cover tasks");
+    }
+    // Checked up front so a bad permutation leaves the tasks untouched
+    std::vector<bool> placed(tasks.size());
+    for (const std::uint32_t index : permutation) {
+        if (index >= tasks.size() || placed[index]) {
+            throw std::invalid_argument("Tasks::apply_permutation: not a permutation");
+        }
+        placed[index] = true;
+    }
+    // Follows every cycle once, each task is moved twice at most
+    placed.assign(tasks.size(), false);
+    for (std::size_t start = 0; start < tasks.size(); ++start) {
+        if (placed[start]) {
+            continue;
+        }
+        Task carried = std::move(tasks[start]);
+        std::size_t current = start;
+        while (permutation[current] != start) {
+            tasks[current] = std::move(tasks[permutation[current]]);
+            placed[current] = true;
+            current = permutation[current];
+        }
+        tasks[current] = std::move(carried);
+        placed[current] = true;
+    }
+}
@@ -0,0 +1,259 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/tasks/task_statistics.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+using Lines::TaskCounts;
+
+// Orders the deadline heap earliest first
+const auto later = [](const auto &lhs, const auto &rhs) { return lhs.deadline > rhs.deadline; };
+} // namespace
+
+Lines::TaskStatistics::TaskStatistics(const Temporal::TimePoint &now) : _now(now) {}
+
+auto Lines::TaskStatistics::status_of(bool completed,
+                                      const std::optional<Temporal::TimePoint> &deadline) const
+    -> Status {
+    if (completed) {
+        return Status::Completed;
+    }
+    return !deadline || _now <= *deadline ? Status::Active : Status::Overdue;
+}
+
+void Lines::TaskStatistics::count(const Entry &entry, bool add) {
+    const auto apply = [&](TaskCounts &counts) {
+        std::size_t &field = entry.status == Status::Completed ? counts.completed
+                             : entry.status == Status::Active  ? counts.active
+                                                               : counts.overdue;
+        if (add) {
+            ++counts.total;
+            ++field;
+        } else {
+            --counts.total;
+            --field;
+        }
+    };
+    apply(_counts);
+    for (const TagId tag : entry.tags) {
+        apply(_tag_counts[tag]);
+    }
+}
+
+void Lines::TaskStatistics::set_status(Entry &entry, Status status) {
+    if (entry.status == status) {
+        return;
+    }
+    count(entry, false);
+    entry.status = status;
+    count(entry, true);
+}
+
+void Lines::TaskStatistics::set_tags(Entry &entry, const Tags &tags) {
+    entry.tags.clear();
+    for (const auto &tag : tags) {
+        entry.tags.push_back(_interner.intern(tag));
+    }
+    std::ranges::sort(entry.tags);
+    const auto duplicates = std::ranges::unique(entry.tags);
+    entry.tags.erase(duplicates.begin(), duplicates.end());
+    _tag_counts.resize(_interner.size());
+}
+
+void Lines::TaskStatistics::arm(TaskID id, Entry &entry) {
+    ++entry.generation;
+    ++_armed;
+    _cursor.push_back(Due{.deadline = *entry.deadline, .id = id, .generation = entry.generation});
+    std::push_heap(_cursor.begin(), _cursor.end(), later);
+    // Every change of an armed deadline leaves a stale entry behind
+    if (_cursor.size() > 2 * _armed + 64) {
+        rebuild_cursor();
+    }
+}
+
+void Lines::TaskStatistics::disarm(Entry &entry) {
+    if (entry.status == Status::Active && entry.deadline) {
+        ++entry.generation;
+        --_armed;
+    }
+}
+
+void Lines::TaskStatistics::rebuild_cursor() {
+    _cursor.clear();
+    for (std::size_t id = 0; id < _entries.size(); ++id) {
+        const Entry &entry = _entries[id];
+        if (entry.tracked && entry.status == Status::Active && entry.deadline) {
+            _cursor.push_back(Due{.deadline = *entry.deadline,
+                                  .id = static_cast<TaskID>(id),
+                                  .generation = entry.generation});
+        }
+    }
+    _armed = _cursor.size();
+    std::make_heap(_cursor.begin(), _cursor.end(), later);
+}
+
+void Lines::TaskStatistics::refresh(TaskID id, const Task &task) {
+    if (id >= _entries.size() || !_entries[id].tracked) {
+        return;
+    }
+    Entry &entry = _entries[id];
+    disarm(entry);
+    entry.deadline = task.deadline();
+    set_status(entry, status_of(task.completed(), entry.deadline));
+    if (entry.status == Status::Active && entry.deadline) {
+        arm(id, entry);
+    }
+    publish();
+}
+
+void Lines::TaskStatistics::publish() {
+    const std::uint64_t sequence = _sequence.load(std::memory_order_relaxed);
+    _sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _published[0].store(_counts.total, std::memory_order_relaxed);
+    _published[1].store(_counts.completed, std::memory_order_relaxed);
+    _published[2].store(_counts.active, std::memory_order_relaxed);
+    _published[3].store(_counts.overdue, std::memory_order_relaxed);
+    _sequence.store(sequence + 2, std::memory_order_release);
+}
+
+void Lines::TaskStatistics::track(Task &task, TaskID id) {
+    if (task.attached()) {
+        throw std::invalid_argument("TaskStatistics::track: task is already attached");
+    }
+    insert(id, task);
+    task.attach(*this, id);
+}
+
+void Lines::TaskStatistics::untrack(Task &task) {
+    if (const auto id = task.id()) {
+        erase(*id);
+    }
+    task.detach();
+}
+
+void Lines::TaskStatistics::insert(TaskID id, const Task &task) {
+    if (id >= _entries.size()) {
+        _entries.resize(std::size_t{id} + 1);
+    }
+    Entry &entry = _entries[id];
+    if (entry.tracked) {
+        throw std::invalid_argument("TaskStatistics::insert: task is already counted");
+    }
+    entry.tracked = true;
+    entry.deadline = task.deadline();
+    entry.status = status_of(task.completed(), entry.deadline);
+    set_tags(entry, task.info().tags);
+    count(entry, true);
+    if (entry.status == Status::Active && entry.deadline) {
+        arm(id, entry);
+    }
+    publish();
+}
+
+void Lines::TaskStatistics::erase(TaskID id) {
+    if (id >= _entries.size() || !_entries[id].tracked) {
+        return;
+    }
+    Entry &entry = _entries[id];
+    count(entry, false);
+    disarm(entry);
+    entry.tracked = false;
+    entry.deadline.reset();
+    entry.tags.clear();
+    publish();
+}
+
+auto Lines::TaskStatistics::advance_to(const Temporal::TimePoint &now) -> std::size_t {
+    if (now < _now) {
+        _now = now;
+        for (Entry &entry : _entries) {
+            if (entry.tracked) {
+                set_status(entry, status_of(entry.status == Status::Completed, entry.deadline));
+            }
+        }
+        rebuild_cursor();
+        publish();
+        return 0;
+    }
+    _now = now;
+    std::size_t overdue = 0;
+    while (!_cursor.empty() && _cursor.front().deadline < _now) {
+        std::pop_heap(_cursor.begin(), _cursor.end(), later);
+        const Due due = _cursor.back();
+        _cursor.pop_back();
+        Entry &entry = _entries[due.id];
+        if (entry.tracked && entry.generation == due.generation &&
+            entry.status == Status::Active) {
+            set_status(entry, Status::Overdue);
+            --_armed;
+            ++overdue;
+        }
+    }
+    if (overdue != 0) {
+        publish();
+    }
+    return overdue;
+}
+
+auto Lines::TaskStatistics::counts(std::string_view tag) const -> TaskCounts {
+    if (const auto tag_id = _interner.find(tag)) {
+        return counts(*tag_id);
+    }
+    return {};
+}
+
+auto Lines::TaskStatistics::counts(TagId tag) const -> TaskCounts {
+    return tag < _tag_counts.size() ? _tag_counts[tag] : TaskCounts{};
+}
+
+auto Lines::TaskStatistics::snapshot() const -> TaskCounts {
+    for (;;) {
+        const std::uint64_t before = _sequence.load(std::memory_order_acquire);
+        if ((before & 1U) != 0) {
+            continue;
+        }
+        const TaskCounts counts{.total = _published[0].load(std::memory_order_relaxed),
+                                .completed = _published[1].load(std::memory_order_relaxed),
+                                .active = _published[2].load(std::memory_order_relaxed),
+                                .overdue = _published[3].load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_sequence.load(std::memory_order_relaxed) == before) {
+            return counts;
+        }
+    }
+}
+
+void Lines::TaskStatistics::on_tags_changed(TaskID id, const Task &task,
+                                            const Tags & /*old_tags*/) {
+    if (id >= _entries.size() || !_entries[id].tracked) {
+        return;
+    }
+    Entry &entry = _entries[id];
+    count(entry, false);
+    set_tags(entry, task.info().tags);
+    count(entry, true);
+    publish();
+}
+
+void Lines::TaskStatistics::on_deadline_changed(
+    TaskID id, const Task &task, const std::optional<Temporal::TimePoint> & /*old_deadline*/) {
+    refresh(id, task);
+}
+
+void Lines::TaskStatistics::on_completion_changed(TaskID id, const Task &task) {
+    refresh(id, task);
+}
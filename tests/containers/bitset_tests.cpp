@@ -0,0 +1,89 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/containers/bitset.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace Lines::Containers;
+
+TEST(Bitset, Construction) {
+    Bitset empty;
+    EXPECT_TRUE(empty.empty());
+
+    Bitset ones(70, true);
+    EXPECT_EQ(ones.size(), 70);
+    EXPECT_EQ(ones.count(), 70);
+    EXPECT_EQ(ones.words()[1], (Bitset::Word{1} << 6) - 1);
+}
+
+TEST(Bitset, SetResetTest) {
+    Bitset bits(130);
+    bits.set(0);
+    bits.set(64);
+    bits.set(129);
+    EXPECT_TRUE(bits.test(64));
+    EXPECT_EQ(bits.count(), 3);
+
+    bits.reset(64);
+    EXPECT_FALSE(bits[64]);
+    EXPECT_TRUE(bits.any());
+
+    bits.reset();
+    EXPECT_TRUE(bits.none());
+}
+
+TEST(Bitset, Resize) {
+    Bitset bits(3, true);
+    bits.resize(67, true);
+    EXPECT_EQ(bits.count(), 67);
+
+    bits.resize(5);
+    EXPECT_EQ(bits.count(), 5);
+
+    bits.push_back(false);
+    bits.push_back(true);
+    EXPECT_EQ(bits.size(), 7);
+    EXPECT_FALSE(bits[5]);
+    EXPECT_TRUE(bits[6]);
+}
+
+TEST(Bitset, Operations) {
+    Bitset lhs(66);
+    Bitset rhs(66);
+    lhs.set(1);
+    lhs.set(65);
+    rhs.set(65);
+    rhs.set(2);
+
+    EXPECT_EQ((lhs & rhs).count(), 1);
+    EXPECT_EQ((lhs | rhs).count(), 3);
+    EXPECT_EQ((lhs ^ rhs).count(), 2);
+    EXPECT_EQ((~lhs).count(), 64);
+    EXPECT_EQ(Bitset{lhs}.subtract(rhs).count(), 1);
+
+    EXPECT_THROW(lhs &= Bitset(3), std::invalid_argument);
+}
+
+TEST(Bitset, ForEachSet) {
+    Bitset bits(200);
+    bits.set(3);
+    bits.set(64);
+    bits.set(199);
+
+    std::vector<std::size_t> seen;
+    bits.for_each_set([&](std::size_t i) { seen.push_back(i); });
+    EXPECT_EQ(seen, (std::vector<std::size_t>{3, 64, 199}));
+}
@@ -0,0 +1,111 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/containers/roaring.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <vector>
+
+using namespace Lines::Containers;
+
+namespace {
+auto to_set(const RoaringBitmap &bitmap) -> std::set<RoaringBitmap::Value> {
+    const auto values = bitmap.to_vector();
+    return {values.begin(), values.end()};
+}
+} // namespace
+
+TEST(RoaringBitmap, AddRemoveContains) {
+    RoaringBitmap bitmap;
+    EXPECT_TRUE(bitmap.empty());
+    EXPECT_TRUE(bitmap.add(5));
+    EXPECT_FALSE(bitmap.add(5));
+    EXPECT_TRUE(bitmap.add(70000));
+    EXPECT_EQ(bitmap.container_count(), 2);
+    EXPECT_TRUE(bitmap.contains(70000));
+    EXPECT_FALSE(bitmap.contains(6));
+
+    EXPECT_TRUE(bitmap.remove(70000));
+    EXPECT_FALSE(bitmap.remove(70000));
+    EXPECT_EQ(bitmap.container_count(), 1);
+    EXPECT_EQ(bitmap.cardinality(), 1);
+
+    bitmap.clear();
+    EXPECT_TRUE(bitmap.empty());
+}
+
+TEST(RoaringBitmap, DenseContainers) {
+    RoaringBitmap bitmap;
+    for (RoaringBitmap::Value value = 0; value < 10000; ++value) {
+        bitmap.add(value * 2);
+    }
+    EXPECT_EQ(bitmap.cardinality(), 10000);
+    EXPECT_TRUE(bitmap.contains(19998));
+    EXPECT_FALSE(bitmap.contains(19999));
+
+    for (RoaringBitmap::Value value = 0; value < 9000; ++value) {
+        bitmap.remove(value * 2);
+    }
+    EXPECT_EQ(bitmap.cardinality(), 1000);
+    EXPECT_EQ(bitmap.to_vector().front(), 18000);
+}
+
+TEST(RoaringBitmap, SetOperations) {
+    // Mix sparse and dense containers on both sides
+    RoaringBitmap lhs;
+    RoaringBitmap rhs;
+    std::set<RoaringBitmap::Value> lset;
+    std::set<RoaringBitmap::Value> rset;
+    for (RoaringBitmap::Value value = 0; value < 200000; value += 3) {
+        lhs.add(value);
+        lset.insert(value);
+    }
+    for (RoaringBitmap::Value value = 0; value < 300000; value += 97) {
+        rhs.add(value);
+        rset.insert(value);
+    }
+    for (RoaringBitmap::Value value = 65536; value < 70000; ++value) {
+        rhs.add(value);
+        rset.insert(value);
+    }
+
+    std::set<RoaringBitmap::Value> expected;
+    std::ranges::set_intersection(lset, rset, std::inserter(expected, expected.end()));
+    EXPECT_EQ(to_set(lhs & rhs), expected);
+
+    expected.clear();
+    std::ranges::set_union(lset, rset, std::inserter(expected, expected.end()));
+    EXPECT_EQ(to_set(lhs | rhs), expected);
+
+    expected.clear();
+    std::ranges::set_difference(lset, rset, std::inserter(expected, expected.end()));
+    EXPECT_EQ(to_set(lhs - rhs), expected);
+
+    expected.clear();
+    std::ranges::set_difference(rset, lset, std::inserter(expected, expected.end()));
+    EXPECT_EQ(to_set(rhs - lhs), expected);
+}
+
+TEST(RoaringBitmap, Equality) {
+    RoaringBitmap lhs{1, 2, 3};
+    RoaringBitmap rhs{3, 2, 1};
+    EXPECT_EQ(lhs, rhs);
+
+    rhs.add(100000);
+    EXPECT_NE(lhs, rhs);
+    EXPECT_EQ(lhs - rhs, RoaringBitmap{});
+}
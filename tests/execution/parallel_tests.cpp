@@ -0,0 +1,100 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/execution/parallel.hpp"
+#include "lines/execution/work_stealing.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_batch.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+using namespace Lines;
+using namespace Lines::Execution;
+
+namespace {
+// Executor of a caller's own, counting the work routed into it
+class CountingExecutor final : public Executor {
+    InlineExecutor _inline;
+
+  public:
+    std::size_t calls = 0;
+
+    void bulk(std::size_t count, FunctionRef<void(std::size_t)> fn) override {
+        calls += count;
+        _inline.bulk(count, fn);
+    }
+    LINES_NODISCARD auto concurrency() const -> std::size_t override { return 2; }
+};
+} // namespace
+
+TEST(Parallel, ForVisitsRange) {
+    WorkStealingExecutor executor{4};
+    std::vector<std::atomic<int>> calls(1000);
+    parallel_for(executor, 10, 990, [&](std::size_t i) { calls[i].fetch_add(1); }, 7);
+    for (std::size_t i = 0; i < calls.size(); ++i) {
+        ASSERT_EQ(calls[i].load(), i >= 10 && i < 990 ? 1 : 0) << i;
+    }
+    parallel_for(executor, 5, 5, [](std::size_t /*i*/) { FAIL(); });
+}
+
+TEST(Parallel, ReduceIsDeterministic) {
+    WorkStealingExecutor pool{4};
+    InlineExecutor serial;
+    const auto sum = [](Executor &executor) {
+        return parallel_reduce(
+            executor, 0, 100'000, std::uint64_t{0},
+            [](std::uint64_t acc, std::size_t i) { return acc + i; },
+            [](std::uint64_t lhs, std::uint64_t rhs) { return lhs + rhs; });
+    };
+    EXPECT_EQ(sum(pool), 99'999ULL * 100'000 / 2);
+
+    // Chunk results combine left to right, order sensitive reductions agree
+    const auto digits = [](Executor &executor) {
+        return parallel_reduce(
+            executor, 0, 500, std::string{},
+            [](std::string acc, std::size_t i) { return acc + std::to_string(i % 10); },
+            [](std::string lhs, const std::string &rhs) { return lhs + rhs; }, 16);
+    };
+    EXPECT_EQ(digits(pool), digits(serial));
+    EXPECT_EQ(digits(pool).substr(0, 12), "012345678901");
+
+    // Chunk results of bool are stored apart, not packed like std::vector<bool>
+    const auto all_below = [&](std::size_t bound) {
+        return parallel_reduce(
+            pool, 0, 10'000, true, [&](bool acc, std::size_t i) { return acc && i < bound; },
+            [](bool lhs, bool rhs) { return lhs && rhs; }, 1);
+    };
+    EXPECT_TRUE(all_below(10'000));
+    EXPECT_FALSE(all_below(9'999));
+}
+
+TEST(Parallel, DefaultExecutorHook) {
+    CountingExecutor counting;
+    set_default_executor(&counting);
+    EXPECT_EQ(&default_executor(), &counting);
+
+    std::vector<Task> tasks(3000, Task{TaskInfo{"task"}});
+    Tasks::advance_deadlines(tasks, Temporal::TimePoint{Temporal::Days{1}});
+    EXPECT_EQ(counting.calls, 3U);
+    std::size_t visited = 0;
+    parallel_for(0, 10, [&](std::size_t /*i*/) { ++visited; });
+    EXPECT_EQ(visited, 10U);
+
+    set_default_executor(nullptr);
+    EXPECT_NE(&default_executor(), &counting);
+}
@@ -0,0 +1,163 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/execution/timer.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Lines;
+using namespace Lines::Execution;
+
+namespace {
+auto at(int64_t seconds) -> Temporal::TimePoint {
+    return Temporal::TimePoint{Temporal::Seconds{seconds}};
+}
+
+// Reminder flow: waits for each time in turn and logs it
+auto remind(TimerQueue &timers, std::string name, std::vector<int64_t> times,
+            std::vector<std::string> &log) -> Detached {
+    for (const int64_t time : times) {
+        co_await until(timers, at(time));
+        log.push_back(name + "@" + std::to_string(timers.clock().now().time_since_epoch().count()));
+    }
+}
+
+// Flags its destruction, to see when a coroutine frame is freed
+struct Sentinel {
+    bool *destroyed;
+    ~Sentinel() { *destroyed = true; }
+};
+
+auto wait_forever(TimerQueue &timers, bool &destroyed) -> Detached {
+    const Sentinel sentinel{&destroyed};
+    co_await until(timers, at(1'000'000));
+}
+} // namespace
+
+TEST(TimerQueue, SimulatedClockDrivesCoroutines) {
+    ManualClock clock{at(0)};
+    TimerQueue timers{clock};
+    std::vector<std::string> log;
+    remind(timers, "a", {10, 30}, log);
+    remind(timers, "b", {0, 10, 20}, log);
+    // b's first time has come already and did not suspend
+    EXPECT_EQ(log, (std::vector<std::string>{"b@0"}));
+    EXPECT_EQ(timers.pending(), 2);
+    EXPECT_EQ(timers.next_wakeup(), at(10));
+
+    EXPECT_EQ(timers.run_due(), 0);
+    clock.advance(Temporal::Seconds{15});
+    EXPECT_EQ(timers.run_due(), 2);
+    clock.set(at(100));
+    EXPECT_EQ(timers.run_due(), 2);
+    EXPECT_EQ(log, (std::vector<std::string>{"b@0", "a@15", "b@15", "b@100", "a@100"}));
+    EXPECT_EQ(timers.pending(), 0);
+    EXPECT_FALSE(timers.next_wakeup());
+}
+
+TEST(TimerQueue, CancelAndAbandon) {
+    ManualClock clock{at(0)};
+    bool destroyed = false;
+    {
+        TimerQueue timers{clock};
+        wait_forever(timers, destroyed);
+        EXPECT_EQ(timers.pending(), 1);
+        EXPECT_FALSE(destroyed);
+    }
+    EXPECT_TRUE(destroyed);
+
+    struct Counter final : TimerQueue::Timer {
+        int fired = 0;
+        void fire() override { ++fired; }
+    };
+    TimerQueue timers{clock};
+    Counter counter;
+    timers.schedule(counter, at(5));
+    timers.schedule(counter, at(8));
+    EXPECT_EQ(timers.pending(), 1);
+    EXPECT_TRUE(timers.cancel(counter));
+    EXPECT_FALSE(timers.cancel(counter));
+    {
+        Counter dropped;
+        timers.schedule(dropped, at(1));
+    }
+    clock.set(at(10));
+    EXPECT_EQ(timers.run_due(), 0);
+    EXPECT_EQ(counter.fired, 0);
+}
+
+TEST(TimerQueue, TimerThreadResumes) {
+    ManualClock clock{at(0)};
+    TimerQueue timers{clock};
+    std::promise<std::thread::id> resumed;
+    [](TimerQueue &timers, std::promise<std::thread::id> &resumed) -> Detached {
+        co_await until(timers, at(60));
+        resumed.set_value(std::this_thread::get_id());
+    }(timers, resumed);
+
+    const TimerThread thread{timers};
+    clock.advance(Temporal::Seconds{60});
+    timers.wake();
+    auto future = resumed.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds{10}), std::future_status::ready);
+    EXPECT_NE(future.get(), std::this_thread::get_id());
+}
+
+TEST(TimerQueue, DestroyWaitsForFire) {
+    struct Slow final : TimerQueue::Timer {
+        std::promise<void> entered;
+        std::shared_future<void> proceed;
+        std::atomic<bool> *finished = nullptr;
+        void fire() override {
+            entered.set_value();
+            proceed.wait();
+            finished->store(true);
+        }
+        ~Slow() override { disarm(); }
+    };
+    ManualClock clock{at(0)};
+    TimerQueue timers{clock};
+    std::promise<void> proceed;
+    std::atomic<bool> finished{false};
+    auto slow = std::make_unique<Slow>();
+    slow->proceed = proceed.get_future().share();
+    slow->finished = &finished;
+    auto entered = slow->entered.get_future();
+    timers.schedule(*slow, at(0));
+
+    std::jthread driver{[&timers] { EXPECT_EQ(timers.run_due(), 1); }};
+    entered.wait();
+    std::atomic<bool> destroyed{false};
+    bool finished_before = false;
+    std::jthread destroyer{[&] {
+        slow.reset();
+        finished_before = finished.load();
+        destroyed.store(true);
+    }};
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_FALSE(destroyed.load());
+    proceed.set_value();
+    destroyer.join();
+    driver.join();
+    EXPECT_TRUE(finished_before);
+    EXPECT_EQ(timers.pending(), 0);
+}
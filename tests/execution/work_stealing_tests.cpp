@@ -0,0 +1,114 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/execution/work_stealing.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace Lines::Execution;
+
+TEST(ChaseLevDeque, OwnerAndThiefEnds) {
+    ChaseLevDeque<int> deque{2};
+    for (int i = 0; i < 10; ++i) {
+        deque.push(i);
+    }
+    EXPECT_EQ(deque.size(), 10U);
+    EXPECT_EQ(deque.pop(), 9);
+    EXPECT_EQ(deque.steal(), 0);
+    EXPECT_EQ(deque.steal(), 1);
+    EXPECT_EQ(deque.pop(), 8);
+
+    while (deque.pop()) {
+    }
+    EXPECT_TRUE(deque.empty());
+    EXPECT_FALSE(deque.steal());
+    EXPECT_FALSE(deque.pop());
+}
+
+TEST(ChaseLevDeque, EveryValueTakenOnce) {
+    LINES_CONSTEXPR int VALUES = 200'000;
+    LINES_CONSTEXPR int THIEVES = 3;
+    ChaseLevDeque<int> deque{8};
+    std::vector<std::atomic<int>> taken(VALUES);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < THIEVES; ++i) {
+        thieves.emplace_back([&] {
+            while (!done.load() || !deque.empty()) {
+                if (const auto value = deque.steal()) {
+                    taken[*value].fetch_add(1);
+                }
+            }
+        });
+    }
+    for (int i = 0; i < VALUES; ++i) {
+        deque.push(i);
+        // The owner takes some back, racing the thieves for the last ones
+        if (i % 3 == 0) {
+            if (const auto value = deque.pop()) {
+                taken[*value].fetch_add(1);
+            }
+        }
+    }
+    while (const auto value = deque.pop()) {
+        taken[*value].fetch_add(1);
+    }
+    done.store(true);
+    for (auto &thief : thieves) {
+        thief.join();
+    }
+    for (int i = 0; i < VALUES; ++i) {
+        ASSERT_EQ(taken[i].load(), 1) << i;
+    }
+}
+
+TEST(WorkStealingExecutor, RunsEveryIndexOnce) {
+    WorkStealingExecutor executor{4};
+    EXPECT_EQ(executor.concurrency(), 4U);
+    for (const std::size_t count : {0, 1, 7, 10'000}) {
+        std::vector<std::atomic<int>> calls(count);
+        executor.bulk(count, [&](std::size_t i) { calls[i].fetch_add(1); });
+        for (std::size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(calls[i].load(), 1) << i;
+        }
+    }
+}
+
+TEST(WorkStealingExecutor, NestedBulk) {
+    WorkStealingExecutor executor{3};
+    std::atomic<std::size_t> sum{0};
+    executor.bulk(16, [&](std::size_t outer) {
+        executor.bulk(100, [&](std::size_t inner) { sum.fetch_add(outer * 100 + inner); });
+    });
+    EXPECT_EQ(sum.load(), 1600U * 1599U / 2);
+}
+
+TEST(WorkStealingExecutor, RethrowsAndStaysUsable) {
+    WorkStealingExecutor executor{2};
+    EXPECT_THROW(executor.bulk(1000,
+                               [](std::size_t i) {
+                                   if (i == 500) {
+                                       throw std::runtime_error{"job failed"};
+                                   }
+                               }),
+                 std::runtime_error);
+    std::atomic<std::size_t> calls{0};
+    executor.bulk(1000, [&](std::size_t /*i*/) { calls.fetch_add(1); });
+    EXPECT_EQ(calls.load(), 1000U);
+}
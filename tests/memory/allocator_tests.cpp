@@ -0,0 +1,161 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_info.hpp"
+#include "lines/tasks/task_repeat.hpp"
+#include "lines/temporal/duration.hpp"
+#include "lines/temporal/timepoint.hpp"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+
+using namespace Lines;
+
+// Counts every allocation that reaches the global heap. All the unaligned
+// forms are replaced so that each pair allocates and frees consistently, the
+// aligned forms are left to the runtime.
+namespace {
+std::atomic<std::size_t> global_allocations{0};
+
+auto counted_malloc(std::size_t size) noexcept -> void * {
+    global_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size); // NOLINT
+}
+} // namespace
+
+auto operator new(std::size_t size) -> void * {
+    if (void *ptr = counted_malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+auto operator new[](std::size_t size) -> void * { return operator new(size); }
+
+auto operator new(std::size_t size, const std::nothrow_t & /*tag*/) noexcept -> void * {
+    return counted_malloc(size);
+}
+
+auto operator new[](std::size_t size, const std::nothrow_t & /*tag*/) noexcept -> void * {
+    return counted_malloc(size);
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); } // NOLINT
+
+void operator delete[](void *ptr) noexcept { std::free(ptr); } // NOLINT
+
+void operator delete(void *ptr, std::size_t /*size*/) noexcept { std::free(ptr); } // NOLINT
+
+void operator delete[](void *ptr, std::size_t /*size*/) noexcept { std::free(ptr); } // NOLINT
+
+void operator delete(void *ptr, const std::nothrow_t & /*tag*/) noexcept {
+    std::free(ptr); // NOLINT
+}
+
+void operator delete[](void *ptr, const std::nothrow_t & /*tag*/) noexcept {
+    std::free(ptr); // NOLINT
+}
+
+namespace {
+// Long enough to defeat the small string optimization
+LINES_CONSTEXPR std::string_view LONG_TITLE = "A task title that does not fit into the SSO buffer";
+LINES_CONSTEXPR std::string_view LONG_DESCRIPTION =
+    "A description that is also long enough to require a heap allocation";
+
+auto daily(const Allocator &alloc) -> TaskRepeatRule {
+    return TaskRepeatRule{
+        .repeat_type = TaskRepeat::EveryUnit{
+            .interval = Temporal::duration_cast<Temporal::Seconds>(Temporal::Days{1}),
+            .unit_str = std::pmr::string("days, spelled out far beyond the SSO limit", alloc)}};
+}
+
+struct Arena {
+    alignas(std::max_align_t) std::array<std::byte, 1U << 20U> buffer{};
+    // Running out of the buffer throws instead of falling back to the heap
+    std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size(),
+                                                 std::pmr::null_memory_resource()};
+};
+} // namespace
+
+TEST(Allocator, TaskWorkspaceStaysInArena) {
+    static Arena arena;
+    const std::size_t before = global_allocations.load();
+    {
+        std::pmr::vector<Task> tasks(&arena.resource);
+        for (int i = 0; i < 64; ++i) {
+            // Growing the vector moves the tasks with the arena allocator
+            tasks.emplace_back(TaskInfo{std::allocator_arg, &arena.resource, LONG_TITLE,
+                                        LONG_DESCRIPTION, {"work", "a-tag-longer-than-the-sso"}},
+                               daily(&arena.resource));
+        }
+        for (auto &task : tasks) {
+            task.set_title(LONG_DESCRIPTION);
+            task.set_description(LONG_TITLE);
+            task.set_tags(detail::make_tags({"home", "another-tag-longer-than-the-sso"},
+                                            &arena.resource));
+            task.set_repeat_rule(daily(&arena.resource));
+            task.set_deadline(Temporal::TimePoint{Temporal::Days{7}});
+            task.complete();
+            task.advance_deadline(Temporal::TimePoint{Temporal::Days{7}});
+        }
+        std::pmr::vector<Task> copies(tasks, &arena.resource);
+        EXPECT_EQ(copies.size(), tasks.size());
+    }
+    EXPECT_EQ(global_allocations.load(), before);
+}
+
+TEST(Allocator, RoadmapWorkspaceStaysInArena) {
+    static Arena arena;
+    const std::size_t before = global_allocations.load();
+    {
+        Roadmap rmap{RoadmapInfo{std::allocator_arg, &arena.resource, LONG_TITLE, LONG_DESCRIPTION,
+                                 {"a-roadmap-tag-longer-than-the-sso"}}};
+        auto parent = rmap.root();
+        for (int i = 0; i < 64; ++i) {
+            parent = rmap.add_node(parent, RoadmapNodeInfo{std::allocator_arg, &arena.resource,
+                                                           LONG_TITLE, LONG_DESCRIPTION});
+        }
+        rmap.remove_node(32);
+        rmap.add_node(rmap.root(),
+                      RoadmapNodeInfo{std::allocator_arg, &arena.resource, LONG_TITLE});
+        EXPECT_EQ(rmap.size(), 65);
+    }
+    EXPECT_EQ(global_allocations.load(), before);
+}
+
+TEST(Allocator, Propagation) {
+    std::pmr::monotonic_buffer_resource arena;
+    Task task{TaskInfo{std::allocator_arg, &arena, LONG_TITLE}, daily({})};
+    EXPECT_EQ(task.get_allocator().resource(), &arena);
+    EXPECT_EQ(task.info().title.get_allocator().resource(), &arena);
+
+    // Plain copies use the default resource, allocator-extended copies the given one
+    const Task copy = task; // NOLINT(performance-unnecessary-copy-initialization)
+    EXPECT_EQ(copy.get_allocator().resource(), std::pmr::get_default_resource());
+    const Task moved{std::allocator_arg, &arena, Task{copy}};
+    EXPECT_EQ(moved.get_allocator().resource(), &arena);
+    EXPECT_EQ(moved.title(), LONG_TITLE);
+
+    Roadmap rmap{RoadmapInfo{std::allocator_arg, &arena, "Roadmap"}};
+    auto node = rmap.add_node(rmap.root(), RoadmapNodeInfo{LONG_TITLE});
+    EXPECT_EQ(rmap.get_allocator().resource(), &arena);
+    EXPECT_EQ(node.lock()->info().title.get_allocator().resource(), &arena);
+}
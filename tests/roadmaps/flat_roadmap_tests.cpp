@@ -0,0 +1,520 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/roadmaps/flat_roadmap.hpp"
+#include "lines/roadmaps/roadmap_views.hpp"
+#include "lines/roadmaps/roadmaps_algorithms.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Lines;
+
+namespace {
+auto titles(const FlatRoadmap &rmap, const std::vector<NodeHandle> &nodes)
+    -> std::vector<std::string> {
+    std::vector<std::string> result;
+    for (const NodeHandle node : nodes) {
+        result.emplace_back(rmap.info(node).title);
+    }
+    return result;
+}
+
+auto ids(const Roadmap &rmap) -> std::vector<RoadmapNode::NodeID> {
+    std::vector<RoadmapNode::NodeID> result;
+    Roadmaps::dfs_foreach(rmap, [&](const RoadmapNode::NodePtr &node) {
+        result.push_back(node.lock()->id());
+    });
+    return result;
+}
+
+auto ids(const FlatRoadmap &rmap) -> std::vector<RoadmapNode::NodeID> {
+    std::vector<RoadmapNode::NodeID> result;
+    Roadmaps::dfs_foreach(rmap, [&](NodeHandle node) { result.push_back(rmap.id(node)); });
+    return result;
+}
+} // namespace
+
+TEST(FlatRoadmap, Creation) {
+    FlatRoadmap rmap{RoadmapInfo{"Rmap", "Desc", {"Tag"}}};
+    const NodeHandle a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A", "Desc", {"Tag1"}});
+    const NodeHandle b = rmap.add_node(a, RoadmapNodeInfo{"B"});
+    const NodeHandle c = rmap.add_node(rmap.root(), RoadmapNodeInfo{"C"});
+
+    EXPECT_EQ(rmap.size(), 4);
+    EXPECT_EQ(rmap.id(a), 1);
+    EXPECT_EQ(rmap.id(c), 3);
+    EXPECT_TRUE(rmap.is_root(rmap.root()));
+    EXPECT_EQ(rmap.parent(b), a);
+    EXPECT_EQ(rmap.parent(a), rmap.root());
+    EXPECT_FALSE(rmap.parent(rmap.root()).valid());
+    EXPECT_EQ(rmap.first_child(rmap.root()), a);
+    EXPECT_EQ(rmap.next_sibling(a), c);
+    EXPECT_FALSE(rmap.next_sibling(c).valid());
+    EXPECT_EQ(rmap.out_degree(rmap.root()), 2);
+
+    EXPECT_EQ(rmap.info(a).title, "A");
+    EXPECT_EQ(rmap.info(a).description.value(), "Desc");
+    EXPECT_EQ(rmap.info(a).tags.size(), 1);
+    EXPECT_EQ(rmap.title(), "Rmap");
+    EXPECT_EQ(rmap.description().value(), "Desc");
+    EXPECT_EQ(rmap.tags().size(), 1);
+
+    EXPECT_THROW(FlatRoadmap{RoadmapInfo{""}}, std::invalid_argument);
+    EXPECT_THROW(rmap.add_node(a, RoadmapNodeInfo{""}), std::invalid_argument);
+}
+
+TEST(FlatRoadmap, States) {
+    FlatRoadmap rmap{RoadmapInfo{"Rmap"}};
+    const NodeHandle a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+
+    EXPECT_EQ(rmap.state(a), RoadmapNode::State::NotCompleted);
+    rmap.set_state(a, RoadmapNode::State::InProgress);
+    EXPECT_EQ(rmap.state(a), RoadmapNode::State::InProgress);
+}
+
+TEST(FlatRoadmap, StaleHandles) {
+    FlatRoadmap rmap{RoadmapInfo{"Rmap"}};
+    const NodeHandle a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+    rmap.remove_node(a);
+
+    EXPECT_FALSE(rmap.contains(a));
+    EXPECT_FALSE(rmap.find(1).has_value());
+    EXPECT_THROW((void)rmap.info(a), std::out_of_range);
+    EXPECT_THROW(rmap.add_node(a, RoadmapNodeInfo{"B"}), std::invalid_argument);
+    EXPECT_THROW(rmap.remove_node(a), std::out_of_range);
+    EXPECT_THROW(rmap.remove_node(rmap.root()), std::invalid_argument);
+
+    // The slot is reused under a new generation
+    const NodeHandle b = rmap.add_node(rmap.root(), RoadmapNodeInfo{"B"});
+    EXPECT_EQ(b.index, a.index);
+    EXPECT_NE(b, a);
+    EXPECT_FALSE(rmap.contains(a));
+    EXPECT_EQ(rmap.find(1), b);
+    EXPECT_EQ(rmap.size(), 2);
+}
+
+TEST(FlatRoadmap, RemovalMatchesRoadmap) {
+    Roadmap legacy{RoadmapInfo{"Rmap"}};
+    FlatRoadmap flat{RoadmapInfo{"Rmap"}};
+    std::vector<RoadmapNode::NodePtr> legacy_nodes{legacy.root()};
+    std::vector<NodeHandle> flat_nodes{flat.root()};
+    // Node i hangs under node i / 3
+    for (std::size_t i = 1; i < 40; ++i) {
+        legacy_nodes.push_back(legacy.add_node(legacy_nodes[i / 3], RoadmapNodeInfo{"N"}));
+        flat_nodes.push_back(flat.add_node(flat_nodes[i / 3], RoadmapNodeInfo{"N"}));
+    }
+    for (const std::size_t id : {4, 1, 13, 2, 39, 12}) {
+        legacy.remove_node(id);
+        flat.remove_node(flat_nodes[id]);
+        EXPECT_EQ(ids(flat), ids(legacy));
+    }
+    // Freed slots are reused, most recently freed first
+    EXPECT_EQ(flat.id(flat.add_node(flat.root(), RoadmapNodeInfo{"M"})), 12);
+    EXPECT_EQ(flat.id(flat.add_node(flat.root(), RoadmapNodeInfo{"M"})), 39);
+    EXPECT_EQ(flat.size(), 36);
+}
+
+TEST(FlatRoadmap, SiblingLinks) {
+    FlatRoadmap rmap{RoadmapInfo{"Rmap"}};
+    const NodeHandle a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+    const NodeHandle b = rmap.add_node(rmap.root(), RoadmapNodeInfo{"B"});
+    const NodeHandle c = rmap.add_node(rmap.root(), RoadmapNodeInfo{"C"});
+    const NodeHandle d = rmap.add_node(b, RoadmapNodeInfo{"D"});
+
+    EXPECT_FALSE(rmap.prev_sibling(a).valid());
+    EXPECT_EQ(rmap.prev_sibling(c), b);
+    EXPECT_EQ(rmap.last_child(rmap.root()), c);
+    EXPECT_FALSE(rmap.last_child(a).valid());
+
+    rmap.remove_node(c);
+    EXPECT_EQ(rmap.last_child(rmap.root()), b);
+    rmap.remove_node(a);
+    EXPECT_EQ(rmap.first_child(rmap.root()), b);
+    EXPECT_FALSE(rmap.prev_sibling(b).valid());
+    rmap.remove_node(b);
+    EXPECT_EQ(rmap.first_child(rmap.root()), d);
+    EXPECT_EQ(rmap.last_child(rmap.root()), d);
+    EXPECT_EQ(rmap.parent(d), rmap.root());
+}
+
+TEST(FlatRoadmap, RemoveSubtree) {
+    Roadmap legacy{RoadmapInfo{"Rmap"}};
+    FlatRoadmap flat{RoadmapInfo{"Rmap"}};
+    std::vector<RoadmapNode::NodePtr> legacy_nodes{legacy.root()};
+    std::vector<NodeHandle> flat_nodes{flat.root()};
+    for (std::size_t i = 1; i < 60; ++i) {
+        legacy_nodes.push_back(legacy.add_node(legacy_nodes[i / 3], RoadmapNodeInfo{"N"}));
+        flat_nodes.push_back(flat.add_node(flat_nodes[i / 3], RoadmapNodeInfo{"N"}));
+    }
+    EXPECT_EQ(flat.remove_subtree(flat_nodes[4]), legacy.remove_subtree(4));
+    EXPECT_EQ(ids(flat), ids(legacy));
+    flat.remove_node(flat_nodes[2]);
+    legacy.remove_node(2);
+    EXPECT_EQ(flat.remove_subtree(flat_nodes[7]), legacy.remove_subtree(7));
+    EXPECT_EQ(flat.remove_subtree(flat_nodes[59]), 1);
+    legacy.remove_subtree(59);
+    EXPECT_EQ(ids(flat), ids(legacy));
+    EXPECT_EQ(flat.size(), Roadmaps::dfs(flat).size());
+    EXPECT_FALSE(flat.contains(flat_nodes[13]));
+    EXPECT_THROW(flat.remove_subtree(flat.root()), std::invalid_argument);
+
+    // All 19 freed slots are reusable
+    for (std::size_t i = 0; i < 19; ++i) {
+        flat.add_node(flat.root(), RoadmapNodeInfo{"M"});
+    }
+    EXPECT_EQ(flat.size(), 60);
+    EXPECT_EQ(flat.capacity(), 60);
+}
+
+TEST(FlatRoadmap, Traversals) {
+    FlatRoadmap rmap{RoadmapInfo{"Rmap"}};
+    const NodeHandle a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+    const NodeHandle b = rmap.add_node(a, RoadmapNodeInfo{"B"});
+    rmap.add_node(b, RoadmapNodeInfo{"D"});
+    rmap.add_node(rmap.root(), RoadmapNodeInfo{"C"});
+    rmap.add_node(a, RoadmapNodeInfo{"E"});
+
+    EXPECT_EQ(titles(rmap, Roadmaps::dfs(rmap)),
+              (std::vector<std::string>{"Root", "A", "B", "D", "E", "C"}));
+    EXPECT_EQ(titles(rmap, Roadmaps::bfs(rmap)),
+              (std::vector<std::string>{"Root", "A", "C", "B", "E", "D"}));
+
+    const FlatRoadmap single{RoadmapInfo{"Single"}};
+    EXPECT_EQ(Roadmaps::dfs(single).size(), 1);
+    EXPECT_EQ(Roadmaps::bfs(single).size(), 1);
+}
+
+TEST(FlatRoadmap, VisitControl) {
+    // Root
+    // +- A (completed)
+    // |  +- B
+    // +- C
+    //    +- D (completed)
+    //    |  +- F
+    //    +- E
+    FlatRoadmap rmap{RoadmapInfo{"Rmap"}};
+    const NodeHandle a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+    rmap.add_node(a, RoadmapNodeInfo{"B"});
+    const NodeHandle c = rmap.add_node(rmap.root(), RoadmapNodeInfo{"C"});
+    const NodeHandle d = rmap.add_node(c, RoadmapNodeInfo{"D"});
+    rmap.add_node(d, RoadmapNodeInfo{"F"});
+    const NodeHandle e = rmap.add_node(c, RoadmapNodeInfo{"E"});
+    rmap.set_state(a, RoadmapNode::State::Completed);
+    rmap.set_state(d, RoadmapNode::State::Completed);
+
+    std::string visited;
+    const auto record = [&](NodeHandle node) { visited += rmap.info(node).title; };
+    const auto skip_completed = [&](NodeHandle node) {
+        record(node);
+        return rmap.state(node) == RoadmapNode::State::Completed ? Roadmaps::Visit::SkipChildren
+                                                                : Roadmaps::Visit::Continue;
+    };
+    Roadmaps::dfs_foreach(rmap, skip_completed);
+    EXPECT_EQ(visited, "RootACDE");
+    visited.clear();
+    Roadmaps::bfs_foreach(rmap, skip_completed);
+    EXPECT_EQ(visited, "RootACDE");
+
+    NodeHandle found;
+    Roadmaps::dfs_foreach(rmap, [&](NodeHandle node) {
+        if (rmap.state(node) == RoadmapNode::State::Completed) {
+            return Roadmaps::Visit::SkipChildren;
+        }
+        if (!rmap.first_child(node).valid()) {
+            found = node;
+            return Roadmaps::Visit::Stop;
+        }
+        return Roadmaps::Visit::Continue;
+    });
+    EXPECT_EQ(found, e);
+
+    visited.clear();
+    Roadmaps::dfs_foreach(rmap, record, {.max_depth = 2, .states = {}});
+    EXPECT_EQ(visited, "RootABCDE");
+    visited.clear();
+    Roadmaps::bfs_foreach(rmap, record, {.max_depth = 1, .states = {}});
+    EXPECT_EQ(visited, "RootAC");
+
+    const Roadmaps::StateFilter completed{RoadmapNode::State::Completed};
+    visited.clear();
+    Roadmaps::dfs_foreach(rmap, record, {.states = completed});
+    EXPECT_EQ(visited, "RootA");
+    visited.clear();
+    Roadmaps::bfs_foreach(rmap, record, {.states = {RoadmapNode::State::NotCompleted}});
+    EXPECT_EQ(visited, "RootCE");
+}
+
+TEST(FlatRoadmap, EulerTourLabels) {
+    FlatRoadmap rmap{RoadmapInfo{"Rmap"}};
+    const NodeHandle a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+    const NodeHandle b = rmap.add_node(a, RoadmapNodeInfo{"B"});
+    const NodeHandle c = rmap.add_node(b, RoadmapNodeInfo{"C"});
+    const NodeHandle d = rmap.add_node(rmap.root(), RoadmapNodeInfo{"D"});
+
+    EXPECT_TRUE(rmap.in_subtree(c, a));
+    EXPECT_TRUE(rmap.in_subtree(a, a));
+    EXPECT_FALSE(rmap.is_ancestor(a, a));
+    EXPECT_TRUE(rmap.is_ancestor(rmap.root(), d));
+    EXPECT_FALSE(rmap.in_subtree(d, a));
+    EXPECT_FALSE(rmap.in_subtree(a, c));
+    EXPECT_EQ(rmap.depth(c), 3);
+    EXPECT_EQ(rmap.subtree_size(a), 3);
+    EXPECT_EQ(rmap.subtree_size(rmap.root()), 5);
+    EXPECT_EQ(rmap.preorder_index(d), 4);
+    EXPECT_EQ(titles(rmap, {rmap.subtree_span(a).begin(), rmap.subtree_span(a).end()}),
+              (std::vector<std::string>{"A", "B", "C"}));
+
+    // Labels follow edits
+    const NodeHandle e = rmap.add_node(b, RoadmapNodeInfo{"E"});
+    EXPECT_EQ(rmap.subtree_size(a), 4);
+    EXPECT_EQ(rmap.preorder_index(d), 5);
+    rmap.remove_node(b);
+    EXPECT_EQ(rmap.depth(e), 2);
+    EXPECT_TRUE(rmap.is_ancestor(a, e));
+    EXPECT_EQ(titles(rmap, {rmap.subtree_span(a).begin(), rmap.subtree_span(a).end()}),
+              (std::vector<std::string>{"A", "C", "E"}));
+    rmap.remove_subtree(a);
+    EXPECT_EQ(rmap.subtree_size(rmap.root()), 2);
+    EXPECT_EQ(rmap.preorder_index(d), 1);
+    EXPECT_THROW((void)rmap.depth(a), std::out_of_range);
+}
+
+TEST(FlatRoadmap, LabelsMatchWalks) {
+    std::mt19937 rng{7};
+    FlatRoadmap rmap{RoadmapInfo{"Rmap"}};
+    std::vector<NodeHandle> nodes{rmap.root()};
+    for (int round = 0; round < 300; ++round) {
+        const std::uint32_t op = rng() % 10;
+        if (op < 6 || nodes.size() < 3) {
+            nodes.push_back(rmap.add_node(nodes[rng() % nodes.size()], RoadmapNodeInfo{"N"}));
+        } else {
+            const NodeHandle victim = nodes[1 + rng() % (nodes.size() - 1)];
+            if (op < 8) {
+                rmap.remove_node(victim);
+            } else {
+                rmap.remove_subtree(victim);
+            }
+            std::erase_if(nodes, [&](NodeHandle node) { return !rmap.contains(node); });
+        }
+        if (rng() % 3 != 0) {
+            continue;
+        }
+        const auto order = Roadmaps::dfs(rmap);
+        ASSERT_EQ(order.size(), rmap.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            const NodeHandle node = order[i];
+            ASSERT_EQ(rmap.preorder_index(node), i);
+            std::size_t depth = 0;
+            for (NodeHandle up = rmap.parent(node); up.valid(); up = rmap.parent(up)) {
+                ASSERT_TRUE(rmap.is_ancestor(up, node));
+                ++depth;
+            }
+            ASSERT_EQ(rmap.depth(node), depth);
+            ASSERT_EQ(rmap.subtree_size(node),
+                      static_cast<std::size_t>(std::ranges::count_if(order, [&](NodeHandle other) {
+                          return rmap.in_subtree(other, node);
+                      })));
+        }
+    }
+}
+
+TEST(FlatRoadmap, CommonAncestors) {
+    FlatRoadmap rmap{RoadmapInfo{"Rmap"}};
+    const NodeHandle a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+    const NodeHandle b = rmap.add_node(a, RoadmapNodeInfo{"B"});
+    const NodeHandle c = rmap.add_node(b, RoadmapNodeInfo{"C"});
+    const NodeHandle d = rmap.add_node(a, RoadmapNodeInfo{"D"});
+    const NodeHandle e = rmap.add_node(rmap.root(), RoadmapNodeInfo{"E"});
+
+    EXPECT_EQ(rmap.lca(c, d), a);
+    EXPECT_EQ(rmap.lca(c, b), b);
+    EXPECT_EQ(rmap.lca(c, c), c);
+    EXPECT_EQ(rmap.lca(c, e), rmap.root());
+    EXPECT_EQ(rmap.distance(c, d), 3);
+    EXPECT_EQ(rmap.distance(c, c), 0);
+    EXPECT_EQ(titles(rmap, rmap.path(c, e)),
+              (std::vector<std::string>{"C", "B", "A", "Root", "E"}));
+    EXPECT_EQ(titles(rmap, rmap.path(a, c)), (std::vector<std::string>{"A", "B", "C"}));
+
+    // The subtree of a removed node moves up a level
+    rmap.remove_node(a);
+    EXPECT_EQ(rmap.depth(c), 2);
+    EXPECT_EQ(rmap.lca(c, d), rmap.root());
+    EXPECT_EQ(titles(rmap, rmap.path(c, d)), (std::vector<std::string>{"C", "B", "Root", "D"}));
+    EXPECT_THROW((void)rmap.lca(a, c), std::out_of_range);
+}
+
+TEST(FlatRoadmap, CommonAncestorsMatchWalks) {
+    std::mt19937 rng{11};
+    FlatRoadmap rmap{RoadmapInfo{"Rmap"}};
+    std::vector<NodeHandle> nodes{rmap.root()};
+    // Chains make the jumps long
+    for (int i = 0; i < 200; ++i) {
+        nodes.push_back(rmap.add_node(nodes.back(), RoadmapNodeInfo{"N"}));
+    }
+    const auto ancestors = [&](NodeHandle node) {
+        std::vector<NodeHandle> chain;
+        for (; node.valid(); node = rmap.parent(node)) {
+            chain.push_back(node);
+        }
+        return chain;
+    };
+    for (int round = 0; round < 400; ++round) {
+        const std::uint32_t op = rng() % 10;
+        if (op < 7 || nodes.size() < 3) {
+            nodes.push_back(rmap.add_node(nodes[rng() % nodes.size()], RoadmapNodeInfo{"N"}));
+        } else {
+            const NodeHandle victim = nodes[1 + rng() % (nodes.size() - 1)];
+            if (op < 9) {
+                rmap.remove_node(victim);
+            } else {
+                rmap.remove_subtree(victim);
+            }
+            std::erase_if(nodes, [&](NodeHandle node) { return !rmap.contains(node); });
+        }
+        const NodeHandle first = nodes[rng() % nodes.size()];
+        const NodeHandle second = nodes[rng() % nodes.size()];
+        auto up = ancestors(first);
+        auto down = ancestors(second);
+        ASSERT_EQ(rmap.depth(first), up.size() - 1);
+        while (up.size() > 1 && down.size() > 1 && up[up.size() - 2] == down[down.size() - 2]) {
+            up.pop_back();
+            down.pop_back();
+        }
+        ASSERT_EQ(rmap.lca(first, second), up.back());
+        down.pop_back();
+        up.insert(up.end(), down.rbegin(), down.rend());
+        ASSERT_EQ(rmap.path(first, second), up);
+        ASSERT_EQ(rmap.distance(first, second), up.size() - 1);
+    }
+}
+
+TEST(FlatRoadmap, Progress) {
+    using State = RoadmapNode::State;
+    FlatRoadmap rmap{RoadmapInfo{"Rmap"}};
+    const NodeHandle a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+    const NodeHandle b = rmap.add_node(a, RoadmapNodeInfo{"B"});
+    const NodeHandle c = rmap.add_node(a, RoadmapNodeInfo{"C"});
+    const NodeHandle d = rmap.add_node(c, RoadmapNodeInfo{"D"});
+
+    EXPECT_EQ(rmap.progress(a), (RoadmapProgress{.total = 4, .not_completed = 4}));
+    rmap.set_state(b, State::Completed);
+    rmap.set_state(d, State::Skipped);
+    rmap.set_state(c, State::InProgress);
+    EXPECT_EQ(rmap.progress(rmap.root()),
+              (RoadmapProgress{
+                  .total = 5, .not_completed = 2, .completed = 1, .skipped = 1, .in_progress = 1}));
+    EXPECT_DOUBLE_EQ(rmap.progress(a).ratio(), 1.0 / 3.0);
+    EXPECT_DOUBLE_EQ(rmap.progress(d).ratio(), 1.0);
+
+    rmap.remove_node(c);
+    EXPECT_EQ(rmap.progress(a),
+              (RoadmapProgress{.total = 3, .not_completed = 1, .completed = 1, .skipped = 1}));
+    rmap.remove_subtree(a);
+    EXPECT_EQ(rmap.progress(rmap.root()), (RoadmapProgress{.total = 1, .not_completed = 1}));
+    EXPECT_DOUBLE_EQ(rmap.progress(rmap.root()).ratio(), 0.0);
+}
+
+TEST(FlatRoadmap, ProgressMatchesWalks) {
+    std::mt19937 rng{13};
+    FlatRoadmap rmap{RoadmapInfo{"Rmap"}};
+    std::vector<NodeHandle> nodes{rmap.root()};
+    for (int round = 0; round < 600; ++round) {
+        const std::uint32_t op = rng() % 10;
+        if (op < 4 || nodes.size() < 3) {
+            nodes.push_back(rmap.add_node(nodes[rng() % nodes.size()], RoadmapNodeInfo{"N"}));
+        } else if (op < 8) {
+            rmap.set_state(nodes[rng() % nodes.size()], static_cast<RoadmapNode::State>(rng() % 4));
+        } else {
+            const NodeHandle victim = nodes[1 + rng() % (nodes.size() - 1)];
+            if (op < 9) {
+                rmap.remove_node(victim);
+            } else {
+                rmap.remove_subtree(victim);
+            }
+            std::erase_if(nodes, [&](NodeHandle node) { return !rmap.contains(node); });
+        }
+        if (rng() % 4 != 0) {
+            continue;
+        }
+        const NodeHandle top = nodes[rng() % nodes.size()];
+        RoadmapProgress expected;
+        for (const NodeHandle node : Roadmaps::preorder(rmap, top)) {
+            ++expected.total;
+            switch (rmap.state(node)) {
+            case RoadmapNode::State::NotCompleted:
+                ++expected.not_completed;
+                break;
+            case RoadmapNode::State::Completed:
+                ++expected.completed;
+                break;
+            case RoadmapNode::State::Skipped:
+                ++expected.skipped;
+                break;
+            case RoadmapNode::State::InProgress:
+                ++expected.in_progress;
+                break;
+            }
+        }
+        ASSERT_EQ(rmap.progress(top), expected);
+    }
+}
+
+TEST(FlatRoadmap, RoadmapAdapter) {
+    Roadmap legacy{RoadmapInfo{"Rmap", "Desc", {"Tag"}}};
+    auto a = legacy.add_node(legacy.root(), RoadmapNodeInfo{"A", "Desc A", {"X", "Y"}});
+    auto b = legacy.add_node(a, RoadmapNodeInfo{"B"});
+    legacy.add_node(legacy.root(), RoadmapNodeInfo{"C"});
+    legacy.add_node(b, RoadmapNodeInfo{"D"});
+    b.lock()->set_state(RoadmapNode::State::Completed);
+    legacy.remove_node(b.lock()->id());
+
+    const FlatRoadmap flat{legacy};
+    EXPECT_EQ(flat.title(), "Rmap");
+    EXPECT_EQ(flat.size(), 4);
+    EXPECT_EQ(ids(flat), ids(legacy));
+    EXPECT_FALSE(flat.find(2).has_value());
+    EXPECT_EQ(flat.info(*flat.find(1)).description.value(), "Desc A");
+    EXPECT_EQ(flat.info(*flat.find(1)).tags.size(), 2);
+    EXPECT_EQ(flat.depth(*flat.find(4)), 2);
+    EXPECT_EQ(flat.lca(*flat.find(4), *flat.find(3)), flat.root());
+    EXPECT_EQ(flat.progress(*flat.find(1)), (RoadmapProgress{.total = 2, .not_completed = 2}));
+
+    FlatRoadmap copy = flat;
+    // The hole left by B is filled first
+    EXPECT_EQ(copy.id(copy.add_node(copy.root(), RoadmapNodeInfo{"E"})), 2);
+
+    copy.set_state(*copy.find(3), RoadmapNode::State::Skipped);
+    Roadmap back = copy.to_roadmap();
+    EXPECT_EQ(back.description().value(), "Desc");
+    EXPECT_EQ(ids(back), ids(copy));
+    EXPECT_EQ(back[3].lock()->state(), RoadmapNode::State::Skipped);
+    EXPECT_EQ(back[1].lock()->tags().size(), 2);
+    EXPECT_EQ(back[2].lock()->title(), "E");
+}
+
+TEST(FlatRoadmap, Allocator) {
+    std::pmr::monotonic_buffer_resource arena;
+    FlatRoadmap rmap{std::allocator_arg, &arena, RoadmapInfo{"Rmap"}};
+    const NodeHandle a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A long title that allocates"});
+
+    EXPECT_EQ(rmap.get_allocator().resource(), &arena);
+    EXPECT_EQ(rmap.info(a).get_allocator().resource(), &arena);
+    EXPECT_EQ(rmap.to_roadmap().get_allocator().resource(), &arena);
+}
@@ -0,0 +1,109 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/roadmaps/roadmap_builder.hpp"
+#include "lines/roadmaps/roadmaps_algorithms.hpp"
+
+#include "gtest/gtest.h"
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+using namespace Lines;
+
+namespace {
+auto titles(const Roadmap &rmap) -> std::vector<std::string> {
+    std::vector<std::string> result;
+    Roadmaps::dfs_foreach(rmap, [&](const RoadmapNode::NodePtr &node) {
+        result.emplace_back(node.lock()->title());
+    });
+    return result;
+}
+
+auto titles(const FlatRoadmap &rmap) -> std::vector<std::string> {
+    std::vector<std::string> result;
+    Roadmaps::dfs_foreach(rmap,
+                          [&](NodeHandle node) { result.emplace_back(rmap.info(node).title); });
+    return result;
+}
+} // namespace
+
+TEST(RoadmapBuilder, ParentIndices) {
+    RoadmapBuilder builder{RoadmapInfo{"Rmap", "Desc"}};
+    builder.reserve(4);
+    const auto a = builder.add(Roadmap::ROOT_ID, RoadmapNodeInfo{"A"});
+    const auto b = builder.add(Roadmap::ROOT_ID, RoadmapNodeInfo{"B"});
+    builder.add(a, RoadmapNodeInfo{"C"});
+    builder.add(b, RoadmapNodeInfo{"D", "Desc D", {"Tag"}});
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(builder.size(), 4);
+
+    RoadmapBuilder flat_builder = builder;
+    const Roadmap rmap = builder.build();
+    EXPECT_EQ(builder.size(), 0);
+    EXPECT_EQ(rmap.description().value(), "Desc");
+    EXPECT_EQ(titles(rmap), (std::vector<std::string>{"Root", "A", "C", "B", "D"}));
+    EXPECT_EQ(rmap.root().lock()->out_degree(), 2);
+    EXPECT_EQ(rmap.lca(4, 2), 2);
+    EXPECT_EQ(rmap.distance(4, 3), 4);
+    EXPECT_EQ(rmap.progress(2).total, 2);
+
+    const FlatRoadmap flat = flat_builder.build_flat();
+    EXPECT_EQ(flat.size(), 5);
+    EXPECT_EQ(titles(flat), titles(rmap));
+    EXPECT_EQ(flat.info(*flat.find(4)).tags.size(), 1);
+    EXPECT_EQ(flat.lca(*flat.find(4), *flat.find(2)), *flat.find(2));
+    EXPECT_EQ(flat.distance(*flat.find(4), *flat.find(3)), 4);
+    EXPECT_EQ(flat.progress(*flat.find(2)).total, 2);
+
+    EXPECT_THROW(builder.add(1, RoadmapNodeInfo{"E"}), std::invalid_argument);
+    EXPECT_THROW(builder.add(Roadmap::ROOT_ID, RoadmapNodeInfo{""}), std::invalid_argument);
+}
+
+TEST(RoadmapBuilder, PreOrderDepths) {
+    RoadmapBuilder builder{RoadmapInfo{"Rmap"}};
+    builder.add_at_depth(1, RoadmapNodeInfo{"A"});
+    builder.add_at_depth(2, RoadmapNodeInfo{"B"});
+    builder.add_at_depth(3, RoadmapNodeInfo{"C"});
+    builder.add_at_depth(2, RoadmapNodeInfo{"D"});
+    builder.add_at_depth(1, RoadmapNodeInfo{"E"});
+    EXPECT_THROW(builder.add_at_depth(3, RoadmapNodeInfo{"X"}), std::invalid_argument);
+    EXPECT_THROW(builder.add_at_depth(0, RoadmapNodeInfo{"X"}), std::invalid_argument);
+    // add() moves the walk to the new node
+    builder.add(2, RoadmapNodeInfo{"F"});
+    builder.add_at_depth(4, RoadmapNodeInfo{"G"});
+
+    Roadmap rmap = builder.build();
+    EXPECT_EQ(titles(rmap),
+              (std::vector<std::string>{"Root", "A", "B", "C", "F", "G", "D", "E"}));
+    EXPECT_EQ(rmap[7].lock()->parent().lock()->id(), 6);
+
+    // The built roadmap takes new nodes as usual
+    EXPECT_EQ(rmap.add_node(rmap.root(), RoadmapNodeInfo{"H"}).lock()->id(), 8);
+    rmap.remove_node(3);
+    EXPECT_EQ(rmap.add_node(rmap.root(), RoadmapNodeInfo{"I"}).lock()->id(), 3);
+}
+
+TEST(RoadmapBuilder, Allocator) {
+    std::pmr::monotonic_buffer_resource arena;
+    RoadmapBuilder builder{std::allocator_arg, &arena, RoadmapInfo{"Rmap"}};
+    builder.add_at_depth(1, RoadmapNodeInfo{"A title long enough to allocate"});
+
+    RoadmapBuilder flat_builder = builder;
+    Roadmap rmap = builder.build();
+    EXPECT_EQ(rmap.get_allocator().resource(), &arena);
+    EXPECT_EQ(rmap[1].lock()->info().title.get_allocator().resource(), &arena);
+    EXPECT_EQ(flat_builder.build_flat().get_allocator().resource(),
+              std::pmr::get_default_resource());
+}
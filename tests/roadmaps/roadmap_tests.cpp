@@ -12,11 +12,46 @@
   SPDX-License-Identifier: LGPL-3.0-or-later.
 */
 #include "lines/roadmaps/roadmaps.hpp"
+#include "lines/roadmaps/roadmaps_algorithms.hpp"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
 using namespace Lines;
 
+namespace {
+struct RecordingObserver final : RoadmapObserver {
+    std::vector<std::pair<char, RoadmapNode::NodeID>> events;
+
+    void on_node_added(RoadmapID /*id*/, const RoadmapNode &node) override {
+        events.emplace_back('+', node.id());
+    }
+    void on_node_removed(RoadmapID /*id*/, const RoadmapNode &node) override {
+        events.emplace_back('-', node.id());
+    }
+    void on_node_state_changed(RoadmapID /*id*/, const RoadmapNode &node,
+                               RoadmapNode::State /*old_state*/) override {
+        events.emplace_back('s', node.id());
+    }
+};
+
+auto titles(Roadmap &rmap, std::span<const RoadmapNode::NodeID> ids) -> std::vector<std::string> {
+    std::vector<std::string> result;
+    for (const RoadmapNode::NodeID id : ids) {
+        result.emplace_back(rmap[id].lock()->title());
+    }
+    return result;
+}
+} // namespace
+
 TEST(RoadmapNode, EmptyTitle) {
     Roadmap rmap{RoadmapInfo{"Rmap"}};
     EXPECT_THROW(rmap.add_node(rmap.root(), RoadmapNodeInfo{""}), std::invalid_argument);
@@ -97,6 +132,59 @@ TEST(Roadmap, DeletionFromMiddle) {
     EXPECT_EQ(b_id, d.lock()->id()); // ID of node is not topologic
 }
 
+TEST(Roadmap, FreeIdReuse) {
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    for (int i = 0; i < 6; ++i) {
+        rmap.add_node(rmap.root(), RoadmapNodeInfo{"N"});
+    }
+    rmap.remove_node(5);
+    rmap.remove_node(2);
+    rmap.remove_node(4);
+    // Slots skipped by an explicit id are free as well, filled ones are not
+    rmap.add_node(rmap.root(), RoadmapNodeInfo{"N"}, 9);
+    rmap.add_node(rmap.root(), RoadmapNodeInfo{"N"}, 4);
+
+    std::vector<RoadmapNode::NodeID> ids;
+    for (int i = 0; i < 6; ++i) {
+        ids.push_back(rmap.add_node(rmap.root(), RoadmapNodeInfo{"N"}).lock()->id());
+    }
+    EXPECT_EQ(ids, (std::vector<RoadmapNode::NodeID>{2, 5, 7, 8, 10, 11}));
+}
+
+TEST(Roadmap, RemoveSubtree) {
+    struct Recorder final : RoadmapObserver {
+        std::vector<std::pair<RoadmapNode::NodeID, std::size_t>> removed;
+        void on_node_removed(RoadmapID /*id*/, const RoadmapNode &node) override {
+            removed.emplace_back(node.id(), node.out_degree());
+        }
+    };
+
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    auto a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+    auto b = rmap.add_node(a, RoadmapNodeInfo{"B"});
+    rmap.add_node(b, RoadmapNodeInfo{"C"});
+    rmap.add_node(a, RoadmapNodeInfo{"D"});
+    auto e = rmap.add_node(rmap.root(), RoadmapNodeInfo{"E"});
+    Recorder recorder;
+    rmap.attach(recorder, 7);
+
+    EXPECT_EQ(rmap.remove_subtree(1), 4);
+    EXPECT_TRUE(a.expired());
+    EXPECT_TRUE(b.expired());
+    ASSERT_EQ(rmap.root().lock()->out_degree(), 1);
+    EXPECT_EQ(rmap.root().lock()->children()[0].lock(), e.lock());
+    // Every node is reported after its descendants, without children
+    EXPECT_EQ(recorder.removed, (std::vector<std::pair<RoadmapNode::NodeID, std::size_t>>{
+                                    {3, 0}, {4, 0}, {2, 0}, {1, 0}}));
+    EXPECT_EQ(rmap.add_node(e, RoadmapNodeInfo{"F"}).lock()->id(), 1);
+    EXPECT_THROW(rmap.remove_subtree(Roadmap::ROOT_ID), std::invalid_argument);
+    // Removed and never used ids leave the roadmap alone
+    EXPECT_THROW(rmap.remove_subtree(2), std::out_of_range);
+    EXPECT_THROW(rmap.remove_subtree(100), std::out_of_range);
+    EXPECT_EQ(rmap.root().lock()->out_degree(), 1);
+    EXPECT_EQ(recorder.removed.size(), 4);
+}
+
 TEST(RoadmapNode, States) {
     Roadmap rmap{RoadmapInfo{"Rmap"}};
     RoadmapNode::NodePtr a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
@@ -139,3 +227,334 @@ TEST(RoadmapNode, Accessors) {
     EXPECT_EQ(a.lock()->children()[0].lock(), b.lock());
     EXPECT_EQ(a.lock()->children()[1].lock(), c.lock());
 }
+
+TEST(Roadmap, CopiesAreDeep) {
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    auto a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+    rmap.add_node(a, RoadmapNodeInfo{"B"});
+    rmap.add_node(rmap.root(), RoadmapNodeInfo{"C"});
+    rmap.remove_node(3);
+    RecordingObserver observer;
+    rmap.attach(observer, 0);
+
+    Roadmap copy = rmap;
+    EXPECT_FALSE(copy.attached());
+    ASSERT_EQ(copy.size(), rmap.size());
+    EXPECT_EQ(copy[3].lock(), nullptr);
+    const auto copied_a = copy[1].lock();
+    EXPECT_NE(copied_a, a.lock());
+    EXPECT_EQ(copied_a->title(), "A");
+    EXPECT_EQ(copied_a->parent().lock(), copy.root().lock());
+    ASSERT_EQ(copied_a->out_degree(), 1);
+    EXPECT_EQ(copied_a->children()[0].lock(), copy[2].lock());
+
+    // Changes to the copy stay there and are not reported
+    copied_a->set_state(RoadmapNode::State::Completed);
+    copy.add_node(copied_a, RoadmapNodeInfo{"D"});
+    EXPECT_EQ(a.lock()->state(), RoadmapNode::State::NotCompleted);
+    EXPECT_EQ(a.lock()->out_degree(), 1);
+    EXPECT_TRUE(observer.events.empty());
+}
+
+TEST(Roadmap, CopyAssignmentWithoutObserver) {
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+    Roadmap other{RoadmapInfo{"Other"}};
+    auto x = other.add_node(other.root(), RoadmapNodeInfo{"X"});
+    other.add_node(x, RoadmapNodeInfo{"Y"});
+
+    rmap = other;
+    EXPECT_FALSE(rmap.attached());
+    EXPECT_EQ(rmap.title(), "Other");
+    ASSERT_EQ(rmap.size(), 3);
+    EXPECT_EQ(rmap[2].lock()->title(), "Y");
+    EXPECT_NE(rmap[1].lock(), x.lock());
+    EXPECT_EQ(rmap.depth(2), 2);
+    EXPECT_EQ(rmap.subtree_size(Roadmap::ROOT_ID), 3);
+}
+
+TEST(Roadmap, AssignmentReportsReplacedNodes) {
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    auto a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+    rmap.add_node(a, RoadmapNodeInfo{"B"});
+    RecordingObserver observer;
+    rmap.attach(observer, 0);
+
+    Roadmap other{RoadmapInfo{"Other"}};
+    other.add_node(other.root(), RoadmapNodeInfo{"X"});
+    rmap = other;
+    EXPECT_TRUE(rmap.attached());
+    EXPECT_EQ(rmap.title(), "Other");
+    EXPECT_EQ(observer.events,
+              (std::vector<std::pair<char, RoadmapNode::NodeID>>{{'-', 2}, {'-', 1}, {'+', 1}}));
+
+    // The assigned nodes report to the attachment of the target
+    observer.events.clear();
+    rmap[1].lock()->set_state(RoadmapNode::State::Skipped);
+    other[1].lock()->set_state(RoadmapNode::State::Completed);
+    rmap = std::move(other);
+    EXPECT_EQ(rmap[1].lock()->state(), RoadmapNode::State::Completed);
+    EXPECT_EQ(observer.events, (std::vector<std::pair<char, RoadmapNode::NodeID>>{
+                                   {'s', 1}, {'-', 1}, {'+', 1}}));
+}
+
+TEST(RoadmapObserver, ObserverList) {
+    RecordingObserver first;
+    RecordingObserver second;
+    RoadmapObserverList list;
+    list.add(first);
+    list.add(second);
+
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    rmap.attach(list, 0);
+    auto a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+
+    list.remove(second);
+    a.lock()->set_state(RoadmapNode::State::InProgress);
+    rmap.remove_node(1);
+
+    EXPECT_EQ(first.events.size(), 3);
+    EXPECT_EQ(second.events.size(), 1);
+    EXPECT_EQ(list.size(), 1);
+}
+
+TEST(Roadmap, EulerTourLabels) {
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    const auto a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"}).lock()->id();
+    const auto b = rmap.add_node(rmap[a], RoadmapNodeInfo{"B"}).lock()->id();
+    const auto c = rmap.add_node(rmap[b], RoadmapNodeInfo{"C"}).lock()->id();
+    const auto d = rmap.add_node(rmap.root(), RoadmapNodeInfo{"D"}).lock()->id();
+
+    EXPECT_TRUE(rmap.in_subtree(c, a));
+    EXPECT_TRUE(rmap.in_subtree(a, a));
+    EXPECT_FALSE(rmap.is_ancestor(a, a));
+    EXPECT_TRUE(rmap.is_ancestor(Roadmap::ROOT_ID, d));
+    EXPECT_FALSE(rmap.in_subtree(d, a));
+    EXPECT_FALSE(rmap.in_subtree(a, c));
+    EXPECT_EQ(rmap.depth(c), 3);
+    EXPECT_EQ(rmap.subtree_size(a), 3);
+    EXPECT_EQ(rmap.subtree_size(Roadmap::ROOT_ID), 5);
+    EXPECT_EQ(rmap.preorder_index(d), 4);
+    EXPECT_EQ(titles(rmap, rmap.subtree_span(a)), (std::vector<std::string>{"A", "B", "C"}));
+
+    // Labels follow edits
+    const auto e = rmap.add_node(rmap[b], RoadmapNodeInfo{"E"}).lock()->id();
+    EXPECT_EQ(rmap.subtree_size(a), 4);
+    EXPECT_EQ(rmap.preorder_index(d), 5);
+    rmap.remove_node(b);
+    EXPECT_EQ(rmap.depth(e), 2);
+    EXPECT_TRUE(rmap.is_ancestor(a, e));
+    EXPECT_EQ(titles(rmap, rmap.subtree_span(a)), (std::vector<std::string>{"A", "C", "E"}));
+    rmap.remove_subtree(a);
+    EXPECT_EQ(rmap.subtree_size(Roadmap::ROOT_ID), 2);
+    EXPECT_EQ(rmap.preorder_index(d), 1);
+    EXPECT_THROW((void)rmap.depth(a), std::out_of_range);
+    EXPECT_THROW((void)rmap.in_subtree(d, 100), std::out_of_range);
+
+    // A reused id is labeled anew
+    const auto f = rmap.add_node(rmap[d], RoadmapNodeInfo{"F"}).lock()->id();
+    EXPECT_EQ(f, a);
+    EXPECT_EQ(rmap.depth(f), 2);
+    EXPECT_TRUE(rmap.is_ancestor(d, f));
+    // Copies are labeled on their own
+    const Roadmap copy{rmap};
+    EXPECT_EQ(copy.preorder_index(f), 2);
+}
+
+TEST(Roadmap, LabelsMatchWalks) {
+    std::mt19937 rng{7};
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    std::vector<RoadmapNode::NodeID> ids{Roadmap::ROOT_ID};
+    for (int round = 0; round < 300; ++round) {
+        const std::uint32_t op = rng() % 10;
+        if (op < 6 || ids.size() < 3) {
+            const auto parent = rmap[ids[rng() % ids.size()]];
+            ids.push_back(rmap.add_node(parent, RoadmapNodeInfo{"N"}).lock()->id());
+        } else {
+            const RoadmapNode::NodeID victim = ids[1 + rng() % (ids.size() - 1)];
+            if (op < 8) {
+                rmap.remove_node(victim);
+            } else {
+                rmap.remove_subtree(victim);
+            }
+            std::erase_if(ids, [&](RoadmapNode::NodeID id) { return rmap[id].expired(); });
+        }
+        if (rng() % 3 != 0) {
+            continue;
+        }
+        const auto order = Roadmaps::dfs(rmap);
+        ASSERT_EQ(order.size(), ids.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            const auto node = order[i].lock();
+            ASSERT_EQ(rmap.preorder_index(node->id()), i);
+            std::size_t depth = 0;
+            for (auto up = node->parent().lock(); up; up = up->parent().lock()) {
+                ASSERT_TRUE(rmap.is_ancestor(up->id(), node->id()));
+                ++depth;
+            }
+            ASSERT_EQ(rmap.depth(node->id()), depth);
+            const auto inside = std::ranges::count_if(order, [&](const auto &other) {
+                return rmap.in_subtree(other.lock()->id(), node->id());
+            });
+            ASSERT_EQ(rmap.subtree_size(node->id()), static_cast<std::size_t>(inside));
+        }
+    }
+}
+
+TEST(Roadmap, CommonAncestors) {
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    const auto a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"}).lock()->id();
+    const auto b = rmap.add_node(rmap[a], RoadmapNodeInfo{"B"}).lock()->id();
+    const auto c = rmap.add_node(rmap[b], RoadmapNodeInfo{"C"}).lock()->id();
+    const auto d = rmap.add_node(rmap[a], RoadmapNodeInfo{"D"}).lock()->id();
+    const auto e = rmap.add_node(rmap.root(), RoadmapNodeInfo{"E"}).lock()->id();
+
+    EXPECT_EQ(rmap.lca(c, d), a);
+    EXPECT_EQ(rmap.lca(c, b), b);
+    EXPECT_EQ(rmap.lca(c, c), c);
+    EXPECT_EQ(rmap.lca(c, e), Roadmap::ROOT_ID);
+    EXPECT_EQ(rmap.distance(c, d), 3);
+    EXPECT_EQ(rmap.distance(c, c), 0);
+    EXPECT_EQ(titles(rmap, rmap.path(c, e)),
+              (std::vector<std::string>{"C", "B", "A", "Root", "E"}));
+    EXPECT_EQ(titles(rmap, rmap.path(a, c)), (std::vector<std::string>{"A", "B", "C"}));
+
+    // The subtree of a removed node moves up a level
+    rmap.remove_node(a);
+    EXPECT_EQ(rmap.depth(c), 2);
+    EXPECT_EQ(rmap.lca(c, d), Roadmap::ROOT_ID);
+    EXPECT_EQ(titles(rmap, rmap.path(c, d)), (std::vector<std::string>{"C", "B", "Root", "D"}));
+    EXPECT_THROW((void)rmap.lca(a, c), std::out_of_range);
+    // Copies keep the depths
+    const Roadmap copy{rmap};
+    EXPECT_EQ(copy.distance(c, e), 3);
+}
+
+TEST(Roadmap, CommonAncestorsMatchWalks) {
+    std::mt19937 rng{11};
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    std::vector<RoadmapNode::NodeID> ids{Roadmap::ROOT_ID};
+    // Chains make the jumps long
+    for (int i = 0; i < 200; ++i) {
+        ids.push_back(rmap.add_node(rmap[ids.back()], RoadmapNodeInfo{"N"}).lock()->id());
+    }
+    const auto ancestors = [&](RoadmapNode::NodeID id) {
+        std::vector<RoadmapNode::NodeID> chain;
+        for (auto node = rmap[id].lock(); node; node = node->parent().lock()) {
+            chain.push_back(node->id());
+        }
+        return chain;
+    };
+    for (int round = 0; round < 400; ++round) {
+        const std::uint32_t op = rng() % 10;
+        if (op < 7 || ids.size() < 3) {
+            const auto parent = rmap[ids[rng() % ids.size()]];
+            ids.push_back(rmap.add_node(parent, RoadmapNodeInfo{"N"}).lock()->id());
+        } else {
+            const RoadmapNode::NodeID victim = ids[1 + rng() % (ids.size() - 1)];
+            if (op < 9) {
+                rmap.remove_node(victim);
+            } else {
+                rmap.remove_subtree(victim);
+            }
+            std::erase_if(ids, [&](RoadmapNode::NodeID id) { return rmap[id].expired(); });
+        }
+        const RoadmapNode::NodeID first = ids[rng() % ids.size()];
+        const RoadmapNode::NodeID second = ids[rng() % ids.size()];
+        auto up = ancestors(first);
+        auto down = ancestors(second);
+        ASSERT_EQ(rmap.depth(first), up.size() - 1);
+        while (up.size() > 1 && down.size() > 1 && up[up.size() - 2] == down[down.size() - 2]) {
+            up.pop_back();
+            down.pop_back();
+        }
+        ASSERT_EQ(rmap.lca(first, second), up.back());
+        down.pop_back();
+        up.insert(up.end(), down.rbegin(), down.rend());
+        ASSERT_EQ(rmap.path(first, second), up);
+        ASSERT_EQ(rmap.distance(first, second), up.size() - 1);
+    }
+}
+
+TEST(Roadmap, Progress) {
+    using State = RoadmapNode::State;
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    const auto a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"}).lock()->id();
+    const auto b = rmap.add_node(rmap[a], RoadmapNodeInfo{"B"}).lock()->id();
+    const auto c = rmap.add_node(rmap[a], RoadmapNodeInfo{"C"}).lock()->id();
+    const auto d = rmap.add_node(rmap[c], RoadmapNodeInfo{"D"}).lock()->id();
+
+    EXPECT_EQ(rmap.progress(a), (RoadmapProgress{.total = 4, .not_completed = 4}));
+    rmap[b].lock()->set_state(State::Completed);
+    rmap[d].lock()->set_state(State::Skipped);
+    rmap[c].lock()->set_state(State::InProgress);
+    EXPECT_EQ(rmap.progress(Roadmap::ROOT_ID),
+              (RoadmapProgress{
+                  .total = 5, .not_completed = 2, .completed = 1, .skipped = 1, .in_progress = 1}));
+    EXPECT_DOUBLE_EQ(rmap.progress(a).ratio(), 1.0 / 3.0);
+    EXPECT_DOUBLE_EQ(rmap.progress(d).ratio(), 1.0);
+
+    rmap.remove_node(c);
+    EXPECT_EQ(rmap.progress(a),
+              (RoadmapProgress{.total = 3, .not_completed = 1, .completed = 1, .skipped = 1}));
+    // Copies count on their own
+    const Roadmap copy{rmap};
+    rmap.remove_subtree(a);
+    EXPECT_EQ(rmap.progress(Roadmap::ROOT_ID), (RoadmapProgress{.total = 1, .not_completed = 1}));
+    EXPECT_DOUBLE_EQ(rmap.progress(Roadmap::ROOT_ID).ratio(), 0.0);
+    EXPECT_EQ(copy.progress(Roadmap::ROOT_ID).total, 4);
+    EXPECT_THROW((void)rmap.progress(a), std::out_of_range);
+}
+
+TEST(Roadmap, ProgressMatchesWalks) {
+    std::mt19937 rng{13};
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    std::vector<RoadmapNode::NodeID> ids{Roadmap::ROOT_ID};
+    for (int round = 0; round < 600; ++round) {
+        const std::uint32_t op = rng() % 10;
+        if (op < 4 || ids.size() < 3) {
+            const auto parent = rmap[ids[rng() % ids.size()]];
+            ids.push_back(rmap.add_node(parent, RoadmapNodeInfo{"N"}).lock()->id());
+        } else if (op < 8) {
+            rmap[ids[rng() % ids.size()]].lock()->set_state(
+                static_cast<RoadmapNode::State>(rng() % 4));
+        } else {
+            const RoadmapNode::NodeID victim = ids[1 + rng() % (ids.size() - 1)];
+            if (op < 9) {
+                rmap.remove_node(victim);
+            } else {
+                rmap.remove_subtree(victim);
+            }
+            std::erase_if(ids, [&](RoadmapNode::NodeID id) { return rmap[id].expired(); });
+        }
+        if (rng() % 4 != 0) {
+            continue;
+        }
+        const RoadmapNode::NodeID top = ids[rng() % ids.size()];
+        RoadmapProgress expected;
+        std::vector<std::shared_ptr<RoadmapNode>> stack{rmap[top].lock()};
+        while (!stack.empty()) {
+            const auto node = std::move(stack.back());
+            stack.pop_back();
+            ++expected.total;
+            switch (node->state()) {
+            case RoadmapNode::State::NotCompleted:
+                ++expected.not_completed;
+                break;
+            case RoadmapNode::State::Completed:
+                ++expected.completed;
+                break;
+            case RoadmapNode::State::Skipped:
+                ++expected.skipped;
+                break;
+            case RoadmapNode::State::InProgress:
+                ++expected.in_progress;
+                break;
+            }
+            for (const auto &child : node->children()) {
+                stack.push_back(child.lock());
+            }
+        }
+        ASSERT_EQ(rmap.progress(top), expected);
+    }
+}
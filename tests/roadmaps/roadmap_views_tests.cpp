@@ -0,0 +1,120 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/roadmaps/roadmap_views.hpp"
+
+#include "gtest/gtest.h"
+
+#include <ranges>
+#include <string>
+#include <vector>
+
+using namespace Lines;
+
+static_assert(std::ranges::forward_range<Roadmaps::PreorderView>);
+static_assert(std::ranges::forward_range<Roadmaps::PostorderView>);
+static_assert(std::ranges::input_range<Roadmaps::LevelorderView>);
+static_assert(std::ranges::view<Roadmaps::PreorderView>);
+static_assert(std::ranges::view<Roadmaps::LevelorderView>);
+
+namespace {
+// Root
+// +- A
+// |  +- B
+// |  |  +- C
+// |  +- D
+// +- E
+// +- F
+//    +- G
+struct Sample {
+    FlatRoadmap rmap{RoadmapInfo{"Rmap"}};
+    NodeHandle a, b, f;
+
+    Sample() {
+        a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+        b = rmap.add_node(a, RoadmapNodeInfo{"B"});
+        rmap.add_node(b, RoadmapNodeInfo{"C"});
+        rmap.add_node(a, RoadmapNodeInfo{"D"});
+        rmap.add_node(rmap.root(), RoadmapNodeInfo{"E"});
+        f = rmap.add_node(rmap.root(), RoadmapNodeInfo{"F"});
+        rmap.add_node(f, RoadmapNodeInfo{"G"});
+    }
+
+    template <std::ranges::input_range R> auto titles(R &&range) const -> std::string {
+        std::string result;
+        for (const NodeHandle node : range) {
+            result += rmap.info(node).title;
+        }
+        return result;
+    }
+};
+} // namespace
+
+TEST(RoadmapViews, Preorder) {
+    const Sample sample;
+    EXPECT_EQ(sample.titles(Roadmaps::preorder(sample.rmap)), "RootABCDEFG");
+    EXPECT_EQ(sample.titles(Roadmaps::preorder(sample.rmap, sample.a)), "ABCD");
+    EXPECT_EQ(sample.titles(Roadmaps::preorder(sample.rmap, sample.f)), "FG");
+
+    const auto view = Roadmaps::preorder(sample.rmap);
+    EXPECT_EQ(std::ranges::distance(view), 8);
+    EXPECT_TRUE(std::ranges::equal(view, Roadmaps::dfs(sample.rmap)));
+}
+
+TEST(RoadmapViews, Postorder) {
+    const Sample sample;
+    EXPECT_EQ(sample.titles(Roadmaps::postorder(sample.rmap)), "CBDAEGFRoot");
+    EXPECT_EQ(sample.titles(Roadmaps::postorder(sample.rmap, sample.a)), "CBDA");
+    EXPECT_EQ(sample.titles(Roadmaps::postorder(sample.rmap, sample.b)), "CB");
+
+    const FlatRoadmap single{RoadmapInfo{"Single"}};
+    EXPECT_EQ(std::ranges::distance(Roadmaps::postorder(single)), 1);
+}
+
+TEST(RoadmapViews, Levelorder) {
+    const Sample sample;
+    std::vector<NodeHandle> buffer;
+    EXPECT_EQ(sample.titles(Roadmaps::levelorder(sample.rmap, buffer)), "RootAEFBDGC");
+    EXPECT_TRUE(std::ranges::equal(Roadmaps::levelorder(sample.rmap, buffer),
+                                   Roadmaps::bfs(sample.rmap)));
+
+    // Later walks reuse the buffer
+    const auto *data = buffer.data();
+    EXPECT_EQ(sample.titles(Roadmaps::levelorder(sample.rmap, buffer, sample.a)), "ABDC");
+    EXPECT_EQ(buffer.data(), data);
+}
+
+TEST(RoadmapViews, Subtree) {
+    Sample sample;
+    EXPECT_EQ(sample.titles(Roadmaps::subtree(sample.rmap, sample.rmap.id(sample.b))), "BC");
+    EXPECT_THROW((void)Roadmaps::subtree(sample.rmap, 42), std::out_of_range);
+
+    sample.rmap.remove_node(sample.b);
+    EXPECT_EQ(sample.titles(Roadmaps::subtree(sample.rmap, sample.rmap.id(sample.a))), "ADC");
+    EXPECT_THROW((void)Roadmaps::preorder(sample.rmap, sample.b), std::out_of_range);
+}
+
+TEST(RoadmapViews, Composition) {
+    Sample sample;
+    sample.rmap.set_state(sample.b, RoadmapNode::State::Completed);
+    sample.rmap.set_state(sample.f, RoadmapNode::State::Completed);
+
+    const auto &rmap = sample.rmap;
+    auto completed = Roadmaps::preorder(rmap) | std::views::filter([&](NodeHandle node) {
+                         return rmap.state(node) == RoadmapNode::State::Completed;
+                     });
+    EXPECT_EQ(sample.titles(completed), "BF");
+
+    auto first_two = Roadmaps::postorder(rmap) | std::views::take(2);
+    EXPECT_EQ(sample.titles(first_two), "CB");
+}
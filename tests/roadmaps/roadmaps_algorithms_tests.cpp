@@ -2,6 +2,8 @@
 
 #include "gtest/gtest.h"
 
+#include <string>
+
 using namespace Lines;
 
 TEST(RoadmapsAlgorithms, DFS) {
@@ -59,3 +61,80 @@ TEST(RoadmapsAlgorithms, BFSForeach) {
         EXPECT_EQ(node.lock()->state(), RoadmapNode::State::Completed);
     }
 }
+
+namespace {
+// Root
+// +- A (completed)
+// |  +- B
+// +- C
+//    +- D (completed)
+//    +- E
+auto controlled_roadmap() -> Roadmap {
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    auto a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"A"});
+    rmap.add_node(a, RoadmapNodeInfo{"B"});
+    auto c = rmap.add_node(rmap.root(), RoadmapNodeInfo{"C"});
+    auto d = rmap.add_node(c, RoadmapNodeInfo{"D"});
+    rmap.add_node(c, RoadmapNodeInfo{"E"});
+    a.lock()->set_state(RoadmapNode::State::Completed);
+    d.lock()->set_state(RoadmapNode::State::Completed);
+    return rmap;
+}
+} // namespace
+
+TEST(RoadmapsAlgorithms, VisitControl) {
+    const Roadmap rmap = controlled_roadmap();
+    std::string visited;
+    const auto skip_completed = [&](const RoadmapNode::NodePtr &node) {
+        const auto nptr = node.lock();
+        visited += nptr->title();
+        return nptr->state() == RoadmapNode::State::Completed ? Roadmaps::Visit::SkipChildren
+                                                             : Roadmaps::Visit::Continue;
+    };
+    Roadmaps::dfs_foreach(rmap, skip_completed);
+    EXPECT_EQ(visited, "RootACDE");
+    visited.clear();
+    Roadmaps::bfs_foreach(rmap, skip_completed);
+    EXPECT_EQ(visited, "RootACDE");
+
+    // First incomplete leaf
+    RoadmapNode::NodeID found = Roadmap::ROOT_ID;
+    std::size_t calls = 0;
+    const auto first_incomplete_leaf = [&](const RoadmapNode::NodePtr &node) {
+        ++calls;
+        const auto nptr = node.lock();
+        if (nptr->state() == RoadmapNode::State::Completed) {
+            return Roadmaps::Visit::SkipChildren;
+        }
+        if (nptr->out_degree() == 0) {
+            found = nptr->id();
+            return Roadmaps::Visit::Stop;
+        }
+        return Roadmaps::Visit::Continue;
+    };
+    Roadmaps::dfs_foreach(rmap, first_incomplete_leaf);
+    EXPECT_EQ(found, 5);
+    EXPECT_EQ(calls, 5);
+}
+
+TEST(RoadmapsAlgorithms, TraversalLimits) {
+    const Roadmap rmap = controlled_roadmap();
+    std::string visited;
+    const auto record = [&](const RoadmapNode::NodePtr &node) { visited += node.lock()->title(); };
+
+    Roadmaps::dfs_foreach(rmap, record, {.max_depth = 1, .states = {}});
+    EXPECT_EQ(visited, "RootAC");
+    visited.clear();
+    Roadmaps::bfs_foreach(rmap, record, {.max_depth = 0, .states = {}});
+    EXPECT_EQ(visited, "Root");
+
+    // Completed branches are left out as a whole
+    const Roadmaps::StateFilter open{RoadmapNode::State::NotCompleted,
+                                     RoadmapNode::State::InProgress};
+    visited.clear();
+    Roadmaps::dfs_foreach(rmap, record, {.states = open});
+    EXPECT_EQ(visited, "RootCE");
+    visited.clear();
+    Roadmaps::bfs_foreach(rmap, record, {.max_depth = 1, .states = open});
+    EXPECT_EQ(visited, "RootC");
+}
@@ -0,0 +1,105 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/search/search_index.hpp"
+#include "lines/tasks/task.hpp"
+
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <vector>
+
+using namespace Lines;
+using namespace Lines::Search;
+
+namespace {
+auto ids(const std::vector<SearchHit> &hits) -> std::vector<std::uint32_t> {
+    std::vector<std::uint32_t> result;
+    for (const auto &hit : hits) {
+        result.push_back(hit.id);
+    }
+    return result;
+}
+} // namespace
+
+TEST(TaskSearchIndex, TracksTitleAndDescription) {
+    std::vector<Task> tasks;
+    tasks.emplace_back(TaskInfo{"Write report", "quarterly numbers"});
+    tasks.emplace_back(TaskInfo{"Numbers", "check the report"});
+    tasks.emplace_back(TaskInfo{"Gym"});
+
+    TaskSearchIndex index;
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        index.track(tasks[id], id);
+    }
+
+    auto hits = index.search("report");
+    EXPECT_EQ(ids(hits), (std::vector<std::uint32_t>{0, 1}));
+    EXPECT_EQ(hits[0].field, Field::Title);
+    EXPECT_EQ(hits[1].field, Field::Description);
+
+    // Title match of the same quality wins over the description
+    EXPECT_EQ(ids(index.search("numbers")), (std::vector<std::uint32_t>{1, 0}));
+
+    tasks[2].set_title("Report to the gym");
+    tasks[0].set_description("");
+    EXPECT_EQ(ids(index.search("report", MatchMode::Prefix)),
+              (std::vector<std::uint32_t>{2, 0, 1}));
+    EXPECT_EQ(ids(index.search("quarterly")), (std::vector<std::uint32_t>{}));
+
+    TaskSearchIndex other;
+    EXPECT_THROW(other.track(tasks[0], 0), std::invalid_argument);
+
+    index.untrack(tasks[1]);
+    EXPECT_EQ(index.size(), 2);
+    EXPECT_EQ(ids(index.search("numbers")), (std::vector<std::uint32_t>{}));
+}
+
+TEST(TaskSearchIndex, ReinsertReplacesDescription) {
+    TaskSearchIndex index;
+    index.insert(0, Task{TaskInfo{"Write report", "quarterly numbers"}});
+    EXPECT_EQ(ids(index.search("quarterly")), (std::vector<std::uint32_t>{0}));
+
+    index.insert(0, Task{TaskInfo{"Write report"}});
+    EXPECT_EQ(index.size(), 1);
+    EXPECT_TRUE(index.search("quarterly").empty());
+    EXPECT_EQ(ids(index.search("report")), (std::vector<std::uint32_t>{0}));
+}
+
+TEST(RoadmapSearchIndex, FollowsNodes) {
+    Roadmap rmap{RoadmapInfo{"Rmap"}};
+    auto a = rmap.add_node(rmap.root(), RoadmapNodeInfo{"Learn C++", "templates first"});
+
+    RoadmapSearchIndex index;
+    index.track(rmap, 1);
+    EXPECT_EQ(rmap.id(), 1);
+    EXPECT_EQ(index.size(), 1);
+    RoadmapSearchIndex other;
+    EXPECT_THROW(other.track(rmap, 2), std::invalid_argument);
+    EXPECT_EQ(other.size(), 0);
+
+    auto b = rmap.add_node(a, RoadmapNodeInfo{"Templates"});
+    EXPECT_EQ(ids(index.search("templ")), (std::vector<std::uint32_t>{2, 1}));
+
+    rmap.remove_node(a.lock()->id());
+    EXPECT_EQ(ids(index.search("templ")), (std::vector<std::uint32_t>{2}));
+    EXPECT_TRUE(index.search("root").empty());
+
+    EXPECT_THROW(other.untrack(rmap), std::invalid_argument);
+    EXPECT_EQ(ids(index.search("templ")), (std::vector<std::uint32_t>{2}));
+    index.untrack(rmap);
+    EXPECT_FALSE(rmap.attached());
+    EXPECT_EQ(index.size(), 0);
+    EXPECT_THROW(index.untrack(rmap), std::invalid_argument);
+}
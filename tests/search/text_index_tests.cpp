@@ -0,0 +1,129 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/execution/work_stealing.hpp"
+#include "lines/search/text_index.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Lines::Search;
+
+namespace {
+auto docs(const std::vector<TextMatch> &matches) -> std::vector<DocID> {
+    std::vector<DocID> result;
+    for (const auto &match : matches) {
+        result.push_back(match.doc);
+    }
+    return result;
+}
+} // namespace
+
+TEST(TextSearch, FoldCase) { EXPECT_EQ(fold_case("Hello, WORLD ё"), "hello, world ё"); }
+
+TEST(TextSearch, Find) {
+    // Long haystacks go through the vectorized blocks, short ones and tails through the
+    // scalar path
+    std::string haystack(200, 'a');
+    haystack.replace(150, 3, "abc");
+    EXPECT_EQ(find(haystack, "abc"), 150);
+    EXPECT_EQ(find(haystack, "abc", 151), std::string::npos);
+    EXPECT_EQ(find(haystack, "aab"), 149);
+    EXPECT_EQ(find(haystack, "b"), 151);
+    EXPECT_EQ(find("short", "ort"), 2);
+    EXPECT_EQ(find("short", "xyz"), std::string::npos);
+    EXPECT_EQ(find("ab", "abc"), std::string::npos);
+
+    for (std::size_t pos = 0; pos + 4 <= 100; ++pos) {
+        std::string text(100, '-');
+        text.replace(pos, 4, "need");
+        EXPECT_EQ(find(text, "need"), pos);
+    }
+}
+
+TEST(TextIndex, SubstringAndRanking) {
+    TextIndex index;
+    index.insert(0, "Buy milk");
+    index.insert(1, "Milk");
+    index.insert(2, "Milkshake recipe");
+    index.insert(3, "Semilkable thing");
+    index.insert(4, "Fix CI");
+    EXPECT_EQ(index.size(), 5);
+
+    const auto matches = index.search("MILK");
+    ASSERT_EQ(matches.size(), 4);
+    EXPECT_EQ(docs(matches), (std::vector<DocID>{1, 2, 0, 3}));
+    EXPECT_EQ(matches[0].quality, MatchQuality::Exact);
+    EXPECT_EQ(matches[1].quality, MatchQuality::Prefix);
+    EXPECT_EQ(matches[2].quality, MatchQuality::WordPrefix);
+    EXPECT_EQ(matches[2].position, 4);
+    EXPECT_EQ(matches[3].quality, MatchQuality::Substring);
+
+    EXPECT_EQ(docs(index.search("milk", MatchMode::Substring, 2)), (std::vector<DocID>{1, 2}));
+    EXPECT_TRUE(index.search("").empty());
+    EXPECT_TRUE(index.search("absent").empty());
+}
+
+TEST(TextIndex, Prefix) {
+    TextIndex index;
+    index.insert(0, "Plan the roadmap");
+    index.insert(1, "Explain the plan");
+    index.insert(2, "Airplane");
+
+    EXPECT_EQ(docs(index.search("pla", MatchMode::Prefix)), (std::vector<DocID>{0, 1}));
+    EXPECT_EQ(docs(index.search("pla")), (std::vector<DocID>{0, 1, 2}));
+    // Short queries bypass the trigram lists
+    EXPECT_EQ(docs(index.search("pl", MatchMode::Prefix)), (std::vector<DocID>{0, 1}));
+}
+
+TEST(TextIndex, Updates) {
+    TextIndex index;
+    index.insert(0, "Old title");
+    index.update(0, "New title");
+    EXPECT_TRUE(index.search("old").empty());
+    EXPECT_EQ(docs(index.search("new")), (std::vector<DocID>{0}));
+
+    index.erase(0);
+    index.erase(0);
+    EXPECT_FALSE(index.contains(0));
+    EXPECT_TRUE(index.search("title").empty());
+}
+
+TEST(TextIndex, BulkInsert) {
+    std::vector<std::string> titles;
+    for (std::size_t i = 0; i < 2000; ++i) {
+        titles.push_back((i % 3 == 0 ? "Write report " : "Call Mom ") + std::to_string(i));
+    }
+    const std::vector<std::string_view> views{titles.begin(), titles.end()};
+
+    TextIndex serial;
+    for (std::size_t i = 0; i < titles.size(); ++i) {
+        serial.insert(static_cast<DocID>(i + 1), titles[i]);
+    }
+    Lines::Execution::WorkStealingExecutor pool{4};
+    TextIndex bulk;
+    bulk.insert(1, "Old title");
+    bulk.insert(1, views, pool);
+
+    EXPECT_EQ(bulk.size(), serial.size());
+    for (const std::string_view query : {"report", "mom 1", "12", "old", "wr"}) {
+        EXPECT_EQ(docs(bulk.search(query)), docs(serial.search(query))) << query;
+        EXPECT_EQ(docs(bulk.search(query, MatchMode::Prefix)),
+                  docs(serial.search(query, MatchMode::Prefix)))
+            << query;
+    }
+    EXPECT_THROW(bulk.insert(std::numeric_limits<DocID>::max(), views, pool), std::length_error);
+}
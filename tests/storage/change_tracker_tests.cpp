@@ -0,0 +1,165 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/storage/change_tracker.hpp"
+#include "lines/storage/workspace.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace Lines;
+using namespace Lines::Storage;
+
+namespace {
+auto sample_workspace() -> Workspace {
+    Workspace workspace;
+    workspace.tasks.emplace_back(TaskInfo{"Report"});
+    workspace.tasks.emplace_back(
+        TaskInfo{"Gym"},
+        TaskRepeatRule{.repeat_type = TaskRepeat::EveryUnit{.interval = Temporal::Seconds{3600},
+                                                            .unit_str = "hours"}});
+    workspace.tasks.back().set_deadline(Temporal::TimePoint{Temporal::Seconds{0}});
+    Roadmap &rmap = workspace.roadmaps.emplace_back(RoadmapInfo{"Plan"});
+    rmap.add_node(rmap.root(), RoadmapNodeInfo{"Existing"});
+    return workspace;
+}
+
+// Separate copy of the workspace, Roadmap copies share their nodes
+auto replica(const Workspace &workspace) -> Workspace {
+    return read_workspace_snapshot(write_workspace_snapshot(workspace));
+}
+
+void attach(Workspace &workspace, ChangeTracker &tracker) {
+    for (std::size_t i = 0; i < workspace.tasks.size(); ++i) {
+        workspace.tasks[i].attach(tracker, static_cast<TaskID>(i));
+    }
+    for (std::size_t i = 0; i < workspace.roadmaps.size(); ++i) {
+        workspace.roadmaps[i].attach(tracker, static_cast<RoadmapID>(i));
+    }
+}
+} // namespace
+
+TEST(ChangeTracker, CoalescesTaskFields) {
+    Workspace workspace = sample_workspace();
+    ChangeTracker tracker;
+    attach(workspace, tracker);
+
+    workspace.tasks[0].set_title("Draft");
+    workspace.tasks[0].set_title("Final report");
+    workspace.tasks[0].complete();
+    workspace.tasks[0].uncomplete();
+    workspace.tasks[0].complete();
+    for (int i = 0; i < 3; ++i) {
+        workspace.tasks[1].advance_deadline();
+    }
+    EXPECT_EQ(tracker.size(), 3U);
+    EXPECT_EQ(tracker.dirty_tasks().to_vector(), (std::vector<std::uint32_t>{0, 1}));
+
+    const auto changes = tracker.take_changes();
+    ASSERT_EQ(changes.size(), 3U);
+    EXPECT_EQ(std::get<Delta::TaskTitle>(changes[0]).title, "Final report");
+    EXPECT_TRUE(std::get<Delta::TaskCompletion>(changes[1]).completed);
+    EXPECT_EQ(std::get<Delta::TaskDeadline>(changes[2]).deadline,
+              Temporal::TimePoint{Temporal::Seconds{3 * 3600}});
+    EXPECT_TRUE(tracker.empty());
+    EXPECT_TRUE(tracker.dirty_tasks().empty());
+    EXPECT_TRUE(tracker.take_changes().empty());
+}
+
+TEST(ChangeTracker, CoalescesRoadmapChanges) {
+    Workspace workspace = sample_workspace();
+    ChangeTracker tracker;
+    attach(workspace, tracker);
+    Roadmap &rmap = workspace.roadmaps[0];
+
+    // A node added and removed within the batch is never seen
+    const auto scratch = rmap.add_node(rmap.root(), RoadmapNodeInfo{"Scratch"});
+    scratch.lock()->set_state(RoadmapNode::State::InProgress);
+    rmap.remove_node(scratch.lock()->id());
+    EXPECT_TRUE(tracker.empty());
+    EXPECT_EQ(tracker.dirty_roadmaps().to_vector(), (std::vector<std::uint32_t>{0}));
+
+    // State changes fold into the NodeAdded of a new node
+    const auto step = rmap.add_node(rmap.root(), RoadmapNodeInfo{"Step", "Details"});
+    step.lock()->set_state(RoadmapNode::State::InProgress);
+    step.lock()->set_state(RoadmapNode::State::Completed);
+    // and into one NodeState for an existing node, which removal drops
+    rmap[1].lock()->set_state(RoadmapNode::State::Skipped);
+    rmap[1].lock()->set_state(RoadmapNode::State::Completed);
+    EXPECT_EQ(tracker.size(), 2U);
+    rmap.remove_node(1);
+
+    const auto changes = tracker.take_changes();
+    ASSERT_EQ(changes.size(), 2U);
+    const auto &added = std::get<Delta::NodeAdded>(changes[0]);
+    EXPECT_EQ(added.node, step.lock()->id());
+    EXPECT_EQ(added.parent, Roadmap::ROOT_ID);
+    EXPECT_EQ(added.info.title, "Step");
+    EXPECT_EQ(added.state, RoadmapNode::State::Completed);
+    EXPECT_EQ(std::get<Delta::NodeRemoved>(changes[1]).node, 1U);
+}
+
+TEST(ChangeTracker, ReplicaClearsDescription) {
+    Workspace workspace = sample_workspace();
+    workspace.tasks[0].set_description("Numbers");
+    Workspace other = replica(workspace);
+    ChangeTracker tracker;
+    attach(workspace, tracker);
+
+    workspace.tasks[0].set_description(std::nullopt);
+    const auto changes = tracker.take_changes();
+    ASSERT_EQ(changes.size(), 1U);
+    EXPECT_FALSE(std::get<Delta::TaskDescription>(changes[0]).description.has_value());
+    apply_changes(other, changes);
+    EXPECT_FALSE(other.tasks[0].description().has_value());
+}
+
+TEST(ChangeTracker, ReplicaConvergesThroughDeltas) {
+    Workspace workspace = sample_workspace();
+    Workspace other = replica(workspace);
+    ChangeTracker tracker;
+    attach(workspace, tracker);
+    Roadmap &rmap = workspace.roadmaps[0];
+
+    for (int round = 0; round < 3; ++round) {
+        workspace.tasks[0].set_tags({"work", "round"});
+        workspace.tasks[1].complete();
+        workspace.tasks[1].advance_deadline();
+        const auto parent = rmap.add_node(rmap.root(), RoadmapNodeInfo{"Parent"});
+        rmap.add_node(parent, RoadmapNodeInfo{"Child"});
+        // Removing a node with children keeps its NodeAdded, the children move up
+        rmap.remove_node(parent.lock()->id());
+        rmap.last().lock()->set_state(RoadmapNode::State::Completed);
+
+        apply_changes(other, tracker.take_changes());
+        ASSERT_EQ(other.roadmaps[0].size(), rmap.size());
+        for (std::size_t id = 0; id < rmap.size(); ++id) {
+            const auto lhs = rmap[id].lock();
+            const auto rhs = other.roadmaps[0][id].lock();
+            ASSERT_EQ(lhs == nullptr, rhs == nullptr);
+            if (lhs && !Roadmap::is_root(id)) {
+                EXPECT_EQ(lhs->parent().lock()->id(), rhs->parent().lock()->id());
+                EXPECT_EQ(lhs->state(), rhs->state());
+            }
+        }
+    }
+    EXPECT_EQ(other.tasks[0].tags(), workspace.tasks[0].tags());
+    EXPECT_EQ(other.tasks[1].deadline(), workspace.tasks[1].deadline());
+    EXPECT_TRUE(other.tasks[1].completed());
+    EXPECT_THROW(apply_changes(other, std::vector<Change>{Delta::TaskCompletion{.task = 7}}),
+                 std::out_of_range);
+}
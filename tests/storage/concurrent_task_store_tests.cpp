@@ -0,0 +1,159 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/concurrent_task_store.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Lines;
+using namespace Lines::Storage;
+
+namespace {
+auto at(int64_t hours) -> Temporal::TimePoint {
+    return Temporal::TimePoint{Temporal::Hours{hours}};
+}
+} // namespace
+
+TEST(ConcurrentTaskStore, SnapshotsAreIsolated) {
+    ConcurrentTaskStore store{4};
+    std::vector<TaskID> ids;
+    for (int i = 0; i < 10; ++i) {
+        ids.push_back(store.insert(Task{TaskInfo{"Task " + std::to_string(i)}}));
+    }
+    EXPECT_EQ(ids.back(), 9U);
+    EXPECT_THROW(ConcurrentTaskStore{0}, std::invalid_argument);
+
+    const auto before = store.snapshot();
+    store.update(ids[5], [](Task &task) { task.set_title("Renamed"); });
+    EXPECT_TRUE(store.erase(ids[7]));
+    EXPECT_FALSE(store.erase(ids[7]));
+    EXPECT_THROW(store.update(ids[7], [](Task &task) { task.complete(); }), std::out_of_range);
+    EXPECT_THROW(store.update(ids[2], [](Task & /*task*/) { throw std::runtime_error{"no"}; }),
+                 std::runtime_error);
+
+    EXPECT_EQ(before.find(ids[5])->title(), "Task 5");
+    EXPECT_EQ(before.size(), 10U);
+    EXPECT_EQ(store.read(ids[5], [](const Task *task) { return std::string{task->title()}; }),
+              "Renamed");
+    EXPECT_EQ(store.read(42, [](const Task *task) { return task == nullptr; }), true);
+
+    const auto after = store.snapshot();
+    EXPECT_EQ(after.find(ids[7]), nullptr);
+    std::vector<TaskID> seen;
+    after.for_each([&](TaskID id, const Task &task) {
+        seen.push_back(id);
+        EXPECT_EQ(std::string{task.title()},
+                  id == ids[5] ? "Renamed" : "Task " + std::to_string(id));
+    });
+    EXPECT_EQ(seen.size(), 9U);
+}
+
+TEST(ConcurrentTaskStore, ReclaimsOnceReadersLeave) {
+    ConcurrentTaskStore store{1};
+    const TaskID id = store.insert(Task{TaskInfo{"Counter"}});
+    {
+        const auto pinned = store.snapshot();
+        for (int i = 0; i < 200; ++i) {
+            store.update(id, [&](Task &task) { task.set_deadline(at(i)); });
+        }
+        // Every version may still be read through the pinned snapshot
+        EXPECT_GE(store.pending_reclamation(), 400U);
+        EXPECT_EQ(pinned.find(id)->deadline(), std::nullopt);
+    }
+    for (int i = 0; i < 30; ++i) {
+        store.update(id, [&](Task &task) { task.set_deadline(at(i)); });
+    }
+    EXPECT_LT(store.pending_reclamation(), 64U);
+}
+
+TEST(ConcurrentTaskStore, StressReadersAndWriters) {
+    LINES_CONSTEXPR int WRITERS = 4;
+    LINES_CONSTEXPR int READERS = 4;
+    LINES_CONSTEXPR TaskID TASKS = 256;
+    LINES_CONSTEXPR int ROUNDS = 200;
+
+    ConcurrentTaskStore store{8};
+    for (TaskID id = 0; id < TASKS; ++id) {
+        Task task{TaskInfo{"0"}};
+        task.set_deadline(at(0));
+        store.insert(std::move(task));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> failures{0};
+    std::vector<std::thread> threads;
+    for (int writer = 0; writer < WRITERS; ++writer) {
+        threads.emplace_back([&, writer] {
+            for (int round = 1; round <= ROUNDS; ++round) {
+                for (TaskID id = writer; id < TASKS; id += WRITERS) {
+                    // Title and deadline change together, readers check they agree
+                    store.update(id, [&](Task &task) {
+                        task.set_title(std::to_string(round));
+                        task.set_deadline(at(round));
+                    });
+                }
+            }
+        });
+    }
+    threads.emplace_back([&] {
+        for (int i = 0; i < 500; ++i) {
+            store.insert(Task{TaskInfo{"extra"}});
+        }
+    });
+    for (int reader = 0; reader < READERS; ++reader) {
+        threads.emplace_back([&] {
+            std::vector<int64_t> last(TASKS, 0);
+            std::size_t last_size = 0;
+            while (!done.load()) {
+                const auto snapshot = store.snapshot();
+                std::size_t size = 0;
+                snapshot.for_each([&](TaskID id, const Task &task) {
+                    ++size;
+                    if (id >= TASKS) {
+                        return;
+                    }
+                    const int64_t round = std::stoll(std::string{task.title()});
+                    if (*task.deadline() != at(round) || round < last[id]) {
+                        failures.fetch_add(1);
+                    }
+                    last[id] = round;
+                });
+                if (size < last_size) {
+                    failures.fetch_add(1);
+                }
+                last_size = size;
+            }
+        });
+    }
+    for (int i = 0; i < WRITERS + 1; ++i) {
+        threads[i].join();
+    }
+    done.store(true);
+    for (std::size_t i = WRITERS + 1; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+
+    EXPECT_EQ(failures.load(), 0U);
+    const auto snapshot = store.snapshot();
+    EXPECT_EQ(snapshot.size(), TASKS + 500);
+    for (TaskID id = 0; id < TASKS; ++id) {
+        EXPECT_EQ(snapshot.find(id)->deadline(), at(ROUNDS));
+    }
+}
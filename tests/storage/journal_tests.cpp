@@ -0,0 +1,298 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/storage/file.hpp"
+#include "lines/storage/journal.hpp"
+#include "lines/storage/workspace.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Lines;
+using namespace Lines::Storage;
+
+namespace {
+class TempDir {
+    std::filesystem::path _path;
+
+  public:
+    TempDir() {
+        std::random_device random;
+        _path = std::filesystem::temp_directory_path() /
+                ("lines-journal-" + std::to_string(random()) + std::to_string(random()));
+        std::filesystem::create_directories(_path);
+    }
+    TempDir(const TempDir &) = delete;
+    TempDir(TempDir &&) = delete;
+    auto operator=(const TempDir &) -> TempDir & = delete;
+    auto operator=(TempDir &&) -> TempDir & = delete;
+    ~TempDir() { std::filesystem::remove_all(_path); }
+
+    LINES_NODISCARD auto path() const -> const std::filesystem::path & { return _path; }
+};
+
+auto log_of(const Journal &journal) -> std::filesystem::path {
+    return journal.directory() / ("journal-" + std::to_string(journal.generation()) + ".log");
+}
+
+// Adds a task to `workspace` and records it
+auto add_task(Workspace &workspace, Journal &journal, std::string_view title) -> Task & {
+    const auto id = static_cast<TaskID>(workspace.tasks.size());
+    Task &task = workspace.tasks.emplace_back(TaskInfo{title});
+    journal.task_added(id, task);
+    task.attach(journal, id);
+    return task;
+}
+
+void expect_same_tasks(const std::vector<Task> &actual, const std::vector<Task> &expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i].title(), expected[i].title());
+        EXPECT_EQ(actual[i].description(), expected[i].description());
+        EXPECT_EQ(actual[i].tags(), expected[i].tags());
+        EXPECT_EQ(actual[i].deadline(), expected[i].deadline());
+        EXPECT_EQ(actual[i].completed(), expected[i].completed());
+        EXPECT_EQ(actual[i].repeat_rule().has_value(), expected[i].repeat_rule().has_value());
+    }
+}
+
+void expect_same_roadmap(Roadmap &actual, Roadmap &expected) {
+    EXPECT_EQ(actual.title(), expected.title());
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t id = 0; id < actual.size(); ++id) {
+        const auto lhs = actual[id].lock();
+        const auto rhs = expected[id].lock();
+        ASSERT_EQ(lhs == nullptr, rhs == nullptr) << "node " << id;
+        if (!lhs) {
+            continue;
+        }
+        EXPECT_EQ(lhs->title(), rhs->title());
+        EXPECT_EQ(lhs->state(), rhs->state());
+        EXPECT_EQ(lhs->out_degree(), rhs->out_degree());
+        if (!Roadmap::is_root(id)) {
+            EXPECT_EQ(lhs->parent().lock()->id(), rhs->parent().lock()->id());
+        }
+    }
+}
+} // namespace
+
+TEST(Journal, RecoversCommittedMutations) {
+    const TempDir dir;
+    Workspace workspace;
+    {
+        Journal journal{dir.path()};
+        workspace.tasks.reserve(2);
+        Task &report = add_task(workspace, journal, "Report");
+        Task &gym = add_task(workspace, journal, "Gym");
+        report.set_title("Quarterly report");
+        report.set_description("Numbers");
+        report.set_tags({"work"});
+        report.set_deadline(Temporal::TimePoint{Temporal::Days{3}});
+        report.complete();
+        gym.set_repeat_rule(TaskRepeatRule{
+            .repeat_type =
+                TaskRepeat::EveryUnit{.interval = Temporal::Seconds{60}, .unit_str = "m"}});
+
+        Roadmap &rmap = workspace.roadmaps.emplace_back(RoadmapInfo{"Plan"});
+        rmap.add_node(rmap.root(), RoadmapNodeInfo{"Existing"});
+        journal.roadmap_added(0, rmap);
+        rmap.attach(journal, 0);
+        const auto node = rmap.add_node(rmap.root(), RoadmapNodeInfo{"Step"});
+        rmap.add_node(node, RoadmapNodeInfo{"Sub step"});
+        node.lock()->set_state(RoadmapNode::State::InProgress);
+        rmap.remove_node(1);
+        journal.commit();
+    }
+    Workspace recovered = Journal::recover(dir.path());
+    expect_same_tasks(recovered.tasks, workspace.tasks);
+    ASSERT_EQ(recovered.roadmaps.size(), 1U);
+    expect_same_roadmap(recovered.roadmaps[0], workspace.roadmaps[0]);
+}
+
+TEST(Journal, RecoversClearedDescription) {
+    const TempDir dir;
+    Workspace workspace;
+    {
+        Journal journal{dir.path()};
+        Task &report = add_task(workspace, journal, "Report");
+        report.set_description("Numbers");
+        journal.commit();
+        report.set_description(std::nullopt);
+        journal.commit();
+    }
+    Workspace recovered = Journal::recover(dir.path());
+    ASSERT_EQ(recovered.tasks.size(), 1U);
+    EXPECT_FALSE(recovered.tasks[0].description().has_value());
+    expect_same_tasks(recovered.tasks, workspace.tasks);
+}
+
+TEST(Journal, DropsTornTail) {
+    const TempDir dir;
+    std::uintmax_t committed{};
+    {
+        Journal journal{dir.path()};
+        Workspace workspace;
+        Task &task = add_task(workspace, journal, "Task");
+        journal.commit();
+        committed = std::filesystem::file_size(log_of(journal));
+        task.set_title("Renamed");
+        task.complete();
+        journal.commit();
+        // Simulate a crash in the middle of writing the second batch
+        std::filesystem::resize_file(log_of(journal),
+                                     (committed + std::filesystem::file_size(log_of(journal))) / 2);
+    }
+    // Only the torn batch is lost
+    const Workspace recovered = Journal::recover(dir.path());
+    ASSERT_EQ(recovered.tasks.size(), 1U);
+    EXPECT_EQ(recovered.tasks[0].title(), "Task");
+    EXPECT_FALSE(recovered.tasks[0].completed());
+}
+
+TEST(Journal, StopsAtCorruptFrame) {
+    const TempDir dir;
+    std::filesystem::path log;
+    {
+        Journal journal{dir.path()};
+        Workspace workspace;
+        Task &task = add_task(workspace, journal, "Task");
+        task.set_title("Renamed");
+        journal.commit();
+        log = log_of(journal);
+    }
+    auto bytes = read_file(log);
+    bytes.back() ^= std::byte{0xFF};
+    write_file_atomically(log, bytes);
+
+    const Workspace recovered = Journal::recover(dir.path());
+    ASSERT_EQ(recovered.tasks.size(), 1U);
+    EXPECT_EQ(recovered.tasks[0].title(), "Task");
+}
+
+TEST(Journal, GroupCommitFromThreads) {
+    LINES_CONSTEXPR std::size_t THREADS = 8;
+    LINES_CONSTEXPR int ROUNDS = 50;
+    const TempDir dir;
+    Workspace workspace;
+    {
+        Journal journal{dir.path(), {.sync = JournalOptions::SyncPolicy::Never}};
+        for (std::size_t i = 0; i < THREADS; ++i) {
+            add_task(workspace, journal, "Task " + std::to_string(i));
+        }
+        journal.commit();
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < THREADS; ++i) {
+            threads.emplace_back([&, i] {
+                for (int round = 0; round < ROUNDS; ++round) {
+                    workspace.tasks[i].set_deadline(Temporal::TimePoint{Temporal::Seconds{round}});
+                    journal.commit();
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+    const Workspace recovered = Journal::recover(dir.path());
+    expect_same_tasks(recovered.tasks, workspace.tasks);
+    for (const auto &task : recovered.tasks) {
+        EXPECT_EQ(task.deadline(), Temporal::TimePoint{Temporal::Seconds{ROUNDS - 1}});
+    }
+}
+
+TEST(Journal, IntervalSyncFromThreads) {
+    LINES_CONSTEXPR std::size_t THREADS = 4;
+    LINES_CONSTEXPR int ROUNDS = 50;
+    const TempDir dir;
+    Workspace workspace;
+    {
+        Journal journal{dir.path(),
+                        {.sync = JournalOptions::SyncPolicy::Interval,
+                         .sync_interval = std::chrono::milliseconds{1}}};
+        for (std::size_t i = 0; i < THREADS; ++i) {
+            add_task(workspace, journal, "Task " + std::to_string(i));
+        }
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < THREADS; ++i) {
+            threads.emplace_back([&, i] {
+                for (int round = 0; round < ROUNDS; ++round) {
+                    workspace.tasks[i].set_deadline(Temporal::TimePoint{Temporal::Seconds{round}});
+                    journal.commit();
+                    if (round % 10 == 0) {
+                        // Leaves the last write to the background sync
+                        std::this_thread::sleep_for(std::chrono::milliseconds{2});
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        journal.compact();
+        workspace.tasks[0].complete();
+        journal.commit();
+    }
+    const Workspace recovered = Journal::recover(dir.path());
+    expect_same_tasks(recovered.tasks, workspace.tasks);
+}
+
+TEST(Journal, CompactionFoldsLogsIntoSnapshot) {
+    const TempDir dir;
+    Workspace workspace;
+    {
+        Journal journal{dir.path()};
+        Task &task = add_task(workspace, journal, "Task");
+        task.set_tags({"a", "b"});
+        journal.commit();
+        const auto folded = journal.generation();
+        journal.compact();
+        task.complete();
+        journal.commit();
+        journal.wait_for_compaction();
+
+        EXPECT_TRUE(
+            std::filesystem::exists(dir.path() / ("snapshot-" + std::to_string(folded + 1))));
+        EXPECT_FALSE(std::filesystem::exists(dir.path() /
+                                             ("journal-" + std::to_string(folded) + ".log")));
+
+        journal.compact();
+        task.set_title("After two compactions");
+        journal.commit();
+    }
+    Workspace recovered = Journal::recover(dir.path());
+    expect_same_tasks(recovered.tasks, workspace.tasks);
+
+    // A new journal continues after the recovered generations
+    Journal journal{dir.path()};
+    EXPECT_GT(journal.generation(), 3U);
+}
+
+TEST(Journal, RejectsRecordsThatDoNotFit) {
+    const TempDir dir;
+    {
+        Journal journal{dir.path()};
+        journal.task_added(1, Task{TaskInfo{"Skips id 0"}});
+        journal.commit();
+    }
+    EXPECT_THROW((void)Journal::recover(dir.path()), SnapshotError);
+}
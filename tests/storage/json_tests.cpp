@@ -0,0 +1,286 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/storage/json.hpp"
+#include "lines/storage/json_io.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Lines;
+using namespace Lines::Storage;
+
+namespace {
+template <typename Write> auto to_json(Write write) -> std::string {
+    std::ostringstream out;
+    {
+        JsonWriter writer{out};
+        write(writer);
+    }
+    return out.str();
+}
+
+auto tokens(const std::string &json) -> std::vector<JsonToken> {
+    std::istringstream in{json};
+    JsonReader reader{in};
+    std::vector<JsonToken> result;
+    for (JsonToken token = reader.next(); token != JsonToken::End; token = reader.next()) {
+        result.push_back(token);
+    }
+    return result;
+}
+
+auto read_string_value(const std::string &json) -> std::string {
+    std::istringstream in{json};
+    JsonReader reader{in};
+    reader.expect(JsonToken::String);
+    return std::string{reader.string()};
+}
+} // namespace
+
+TEST(JsonWriter, Structure) {
+    const auto json = to_json([](JsonWriter &writer) {
+        writer.begin_object();
+        writer.key("a").integer(-42);
+        writer.key("b").begin_array().boolean(true).boolean(false).null().end_array();
+        writer.key("c").begin_object().end_object();
+        writer.key("d").string("x");
+        writer.end_object();
+    });
+    EXPECT_EQ(json, R"({"a":-42,"b":[true,false,null],"c":{},"d":"x"})");
+}
+
+TEST(JsonWriter, Escapes) {
+    const auto json = to_json([](JsonWriter &writer) {
+        writer.string(std::string_view{"q\"b\\n\nt\tc\x01\0", 11});
+    });
+    EXPECT_EQ(json, R"("q\"b\\n\nt\tc\u0001\u0000")");
+}
+
+TEST(JsonReader, Tokens) {
+    using enum JsonToken;
+    EXPECT_EQ(tokens(R"( {"a": [1, -2.5e3, "s", true, false, null], "b": {}} )"),
+              (std::vector<JsonToken>{BeginObject, Key, BeginArray, Number, Number, String, Boolean,
+                                      Boolean, Null, EndArray, Key, BeginObject, EndObject,
+                                      EndObject}));
+    EXPECT_EQ(tokens("[]"), (std::vector<JsonToken>{BeginArray, EndArray}));
+    EXPECT_EQ(tokens("7"), (std::vector<JsonToken>{Number}));
+}
+
+TEST(JsonReader, Values) {
+    std::istringstream in{R"({"n": -9007199254740993, "s": "hi", "t": true})"};
+    JsonReader reader{in};
+    reader.expect(JsonToken::BeginObject);
+    reader.expect(JsonToken::Key);
+    EXPECT_EQ(reader.string(), "n");
+    reader.expect(JsonToken::Number);
+    EXPECT_EQ(reader.integer(), -9007199254740993);
+    reader.expect(JsonToken::Key);
+    EXPECT_EQ(reader.peek(), JsonToken::String);
+    EXPECT_EQ(reader.next(), JsonToken::String);
+    EXPECT_EQ(reader.take_string(), "hi");
+    reader.expect(JsonToken::Key);
+    reader.expect(JsonToken::Boolean);
+    EXPECT_TRUE(reader.boolean());
+    reader.expect(JsonToken::EndObject);
+    EXPECT_EQ(reader.next(), JsonToken::End);
+}
+
+TEST(JsonReader, StringEscapes) {
+    EXPECT_EQ(read_string_value(R"("a\"b\\c\/d\n\t")"), "a\"b\\c/d\n\t");
+    EXPECT_EQ(read_string_value(R"("é€")"), "\xC3\xA9\xE2\x82\xAC");
+    EXPECT_EQ(read_string_value(R"("😀")"), "\xF0\x9F\x98\x80");
+    EXPECT_EQ(read_string_value("\"\xC3\xA9\""), "\xC3\xA9");
+    EXPECT_THROW(read_string_value(R"("\ud83d")"), JsonError);
+    EXPECT_THROW(read_string_value(R"("\x")"), JsonError);
+    EXPECT_THROW(read_string_value("\"a\nb\""), JsonError);
+    EXPECT_THROW(read_string_value(R"("open)"), JsonError);
+}
+
+TEST(JsonReader, Malformed) {
+    for (const std::string json : {"{", "[1,]", "{\"a\" 1}", "{\"a\":1,}", "[1 2]", "01", "-",
+                                   "1.", "tru", "{}x", "{1:2}", "]", ""}) {
+        EXPECT_THROW(tokens(json), JsonError) << json;
+    }
+}
+
+TEST(JsonReader, Skip) {
+    std::istringstream in{R"({"skip": {"a": [1, {"b": []}]}, "keep": 3})"};
+    JsonReader reader{in};
+    reader.expect(JsonToken::BeginObject);
+    reader.expect(JsonToken::Key);
+    reader.skip();
+    reader.expect(JsonToken::Key);
+    EXPECT_EQ(reader.string(), "keep");
+}
+
+TEST(JsonReader, CrossesBufferBoundaries) {
+    const std::string long_string(200 * 1024, 'x');
+    const auto json = to_json([&](JsonWriter &writer) {
+        writer.begin_array();
+        for (int i = 0; i < 3; ++i) {
+            writer.string(long_string + "\n");
+        }
+        writer.end_array();
+    });
+    std::istringstream in{json};
+    JsonReader reader{in};
+    reader.expect(JsonToken::BeginArray);
+    for (int i = 0; i < 3; ++i) {
+        reader.expect(JsonToken::String);
+        EXPECT_EQ(reader.string(), long_string + "\n");
+    }
+    reader.expect(JsonToken::EndArray);
+}
+
+TEST(JsonIO, TaskRoundTrip) {
+    std::vector<Task> tasks;
+    tasks.emplace_back(TaskInfo{"Report", "Q\"3\"", {"work", "urgent"}});
+    tasks.back().set_deadline(Temporal::TimePoint{Temporal::Days{7}});
+    tasks.back().complete();
+    tasks.emplace_back(TaskInfo{"Gym"},
+                       TaskRepeatRule{.repeat_type = TaskRepeat::EveryWeekday{
+                                          .weekdays = {Temporal::Weekday::Monday,
+                                                       Temporal::Weekday::Friday}},
+                                      .end = Temporal::TimePoint{Temporal::Days{100}}});
+    tasks.emplace_back(
+        TaskInfo{"Plants"},
+        TaskRepeatRule{
+            .repeat_type = TaskRepeat::EveryUnit{
+                .interval = Temporal::duration_cast<Temporal::Seconds>(Temporal::Days{3}),
+                .unit_str = "days"}});
+
+    const auto json = to_json([&](JsonWriter &writer) {
+        writer.begin_array();
+        for (const auto &task : tasks) {
+            write_json(writer, task);
+        }
+        writer.end_array();
+    });
+
+    std::istringstream in{json};
+    JsonReader reader{in};
+    reader.expect(JsonToken::BeginArray);
+    std::size_t i = 0;
+    while (reader.peek() != JsonToken::EndArray) {
+        const Task task = read_task(reader);
+        ASSERT_LT(i, tasks.size());
+        EXPECT_EQ(task.title(), tasks[i].title());
+        EXPECT_EQ(task.description(), tasks[i].description());
+        EXPECT_EQ(task.tags(), tasks[i].tags());
+        EXPECT_EQ(task.deadline(), tasks[i].deadline());
+        EXPECT_EQ(task.completed(), tasks[i].completed());
+        EXPECT_EQ(task.repeat_rule().has_value(), tasks[i].repeat_rule().has_value());
+        EXPECT_EQ(task.next_deadline(Temporal::TimePoint{Temporal::Days{10}}),
+                  tasks[i].next_deadline(Temporal::TimePoint{Temporal::Days{10}}));
+        ++i;
+    }
+    EXPECT_EQ(i, tasks.size());
+}
+
+TEST(JsonIO, TaskMembersInAnyOrder) {
+    std::istringstream in{
+        R"({"extra": {"x": [1]}, "completed": true, "tags": ["b"], "deadline": 60, "title": "T"})"};
+    JsonReader reader{in};
+    const Task task = read_task(reader);
+    EXPECT_EQ(task.title(), "T");
+    EXPECT_TRUE(task.completed());
+    EXPECT_EQ(task.tags().size(), 1);
+    EXPECT_EQ(task.deadline(), Temporal::TimePoint{Temporal::Seconds{60}});
+}
+
+TEST(JsonIO, InvalidTasks) {
+    for (const std::string json :
+         {R"({"description": "no title"})", R"({"title": 1})", R"({"title": "T", "tags": [1]})",
+          R"({"title": "T", "repeat": {"end": 5}})",
+          R"({"title": "T", "repeat": {"weekdays": [7]}})"}) {
+        std::istringstream in{json};
+        JsonReader reader{in};
+        EXPECT_THROW((void)read_task(reader), JsonError) << json;
+    }
+}
+
+TEST(JsonIO, UsesReaderAllocator) {
+    std::pmr::monotonic_buffer_resource arena;
+    std::istringstream in{R"({"title": "A title longer than the small string buffer"})"};
+    JsonReader reader{in, &arena};
+    const Task task = read_task(reader);
+    EXPECT_EQ(task.get_allocator().resource(), &arena);
+}
+
+TEST(JsonIO, RoadmapRoundTrip) {
+    Roadmap rmap{RoadmapInfo{"Learn", "Plan", {"study"}}};
+    auto basics = rmap.add_node(rmap.root(), RoadmapNodeInfo{"Basics", std::nullopt, {"a"}});
+    auto syntax = rmap.add_node(basics, RoadmapNodeInfo{"Syntax"});
+    rmap.add_node(basics, RoadmapNodeInfo{"Types", "Static"});
+    rmap.add_node(rmap.root(), RoadmapNodeInfo{"Advanced"});
+    syntax.lock()->set_state(RoadmapNode::State::Completed);
+
+    const auto json = to_json([&](JsonWriter &writer) { write_json(writer, rmap); });
+    std::istringstream in{json};
+    JsonReader reader{in};
+    const Roadmap copy = read_roadmap(reader);
+    EXPECT_EQ(reader.next(), JsonToken::End);
+
+    EXPECT_EQ(copy.title(), "Learn");
+    EXPECT_EQ(copy.description(), "Plan");
+    EXPECT_EQ(copy.size(), rmap.size());
+    const auto &top = copy.root().lock()->children();
+    ASSERT_EQ(top.size(), 2);
+    const auto copied_basics = top[0].lock();
+    EXPECT_EQ(copied_basics->title(), "Basics");
+    EXPECT_EQ(copied_basics->tags().size(), 1);
+    ASSERT_EQ(copied_basics->children().size(), 2);
+    EXPECT_EQ(copied_basics->children()[0].lock()->state(), RoadmapNode::State::Completed);
+    EXPECT_EQ(copied_basics->children()[1].lock()->description(), "Static");
+    EXPECT_EQ(top[1].lock()->title(), "Advanced");
+
+    // Writing the copy reproduces the document
+    EXPECT_EQ(to_json([&](JsonWriter &writer) { write_json(writer, copy); }), json);
+}
+
+TEST(JsonIO, DeepRoadmap) {
+    // Deep enough to overflow the call stack if nodes were handled recursively
+    LINES_CONSTEXPR std::size_t DEPTH = 50'000;
+    Roadmap rmap{RoadmapInfo{"Chain"}};
+    auto node = rmap.root();
+    for (std::size_t i = 0; i < DEPTH; ++i) {
+        node = rmap.add_node(node, RoadmapNodeInfo{"Step"});
+    }
+    node.lock()->set_state(RoadmapNode::State::Skipped);
+
+    const auto json = to_json([&](JsonWriter &writer) { write_json(writer, rmap); });
+    std::istringstream in{json};
+    JsonReader reader{in};
+    const Roadmap copy = read_roadmap(reader);
+    EXPECT_EQ(copy.size(), rmap.size());
+    auto leaf = copy.root().lock();
+    while (!leaf->children().empty()) {
+        leaf = leaf->children().front().lock();
+    }
+    EXPECT_EQ(leaf->state(), RoadmapNode::State::Skipped);
+    EXPECT_EQ(to_json([&](JsonWriter &writer) { write_json(writer, copy); }), json);
+}
+
+TEST(JsonIO, NodeMembersMustPrecedeChildren) {
+    std::istringstream in{R"({"title": "R", "nodes": [{"title": "A", "children": [],
+                              "title": "B"}]})"};
+    JsonReader reader{in};
+    EXPECT_THROW((void)read_roadmap(reader), JsonError);
+}
@@ -0,0 +1,208 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/storage/checksum.hpp"
+#include "lines/storage/snapshot_format.hpp"
+#include "lines/storage/task_snapshot.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+using namespace Lines;
+using namespace Lines::Storage;
+
+namespace {
+auto as_bytes(std::string_view str) -> std::span<const std::byte> {
+    return std::as_bytes(std::span{str.data(), str.size()});
+}
+
+auto sample_tasks() -> std::vector<Task> {
+    std::vector<Task> tasks;
+    tasks.emplace_back(TaskInfo{"Write report", "Quarterly numbers", {"work", "urgent"}});
+    tasks.back().set_deadline(Temporal::TimePoint{Temporal::Days{7}});
+    tasks.back().complete();
+
+    tasks.emplace_back(TaskInfo{"Gym", std::nullopt, {"health"}},
+                       TaskRepeatRule{.repeat_type = TaskRepeat::EveryWeekday{
+                                          .weekdays = {Temporal::Weekday::Friday,
+                                                       Temporal::Weekday::Monday}},
+                                      .end = Temporal::TimePoint{Temporal::Days{365}}});
+
+    tasks.emplace_back(
+        TaskInfo{"Water plants", "", {"home", "work"}},
+        TaskRepeatRule{
+            .repeat_type = TaskRepeat::EveryUnit{
+                .interval = Temporal::duration_cast<Temporal::Seconds>(Temporal::Days{3}),
+                .unit_str = "days"}});
+    tasks.back().set_deadline(Temporal::TimePoint{Temporal::Days{-2}});
+    return tasks;
+}
+} // namespace
+
+TEST(Checksum, Crc32c) {
+    EXPECT_EQ(crc32c(as_bytes("123456789")), 0xE3069283U);
+    EXPECT_EQ(crc32c({}), 0U);
+    // Checksums can be continued over split input
+    const std::string_view text = "The quick brown fox jumps over the lazy dog";
+    EXPECT_EQ(crc32c(as_bytes(text.substr(11)), crc32c(as_bytes(text.substr(0, 11)))),
+              crc32c(as_bytes(text)));
+}
+
+TEST(TaskSnapshot, RoundTrip) {
+    const auto tasks = sample_tasks();
+    const auto bytes = write_task_snapshot(tasks);
+    const TaskSnapshot snapshot{bytes};
+    ASSERT_EQ(snapshot.size(), tasks.size());
+
+    const auto report = snapshot[0];
+    EXPECT_EQ(report.title(), "Write report");
+    EXPECT_EQ(report.description(), "Quarterly numbers");
+    ASSERT_EQ(report.tag_count(), 2);
+    EXPECT_EQ(report.tag(0), "work");
+    EXPECT_EQ(report.tag(1), "urgent");
+    EXPECT_EQ(report.deadline(), Temporal::TimePoint{Temporal::Days{7}});
+    EXPECT_TRUE(report.completed());
+    EXPECT_FALSE(report.has_repeat_rule());
+    EXPECT_THROW((void)report.tag(2), std::out_of_range);
+
+    const auto gym = snapshot[1];
+    EXPECT_FALSE(gym.description());
+    EXPECT_FALSE(gym.deadline());
+    const auto weekly = gym.repeat_rule();
+    ASSERT_TRUE(weekly);
+    EXPECT_EQ(std::get<TaskRepeat::EveryWeekday>(weekly->repeat_type).weekdays,
+              (std::pmr::vector<Temporal::Weekday>{Temporal::Weekday::Monday,
+                                                   Temporal::Weekday::Friday}));
+    EXPECT_EQ(weekly->end, Temporal::TimePoint{Temporal::Days{365}});
+
+    const auto plants = snapshot[2];
+    EXPECT_EQ(plants.description(), "");
+    EXPECT_EQ(plants.deadline(), Temporal::TimePoint{Temporal::Days{-2}});
+    const auto every = plants.repeat_rule();
+    ASSERT_TRUE(every);
+    const auto &unit = std::get<TaskRepeat::EveryUnit>(every->repeat_type);
+    EXPECT_EQ(unit.interval, Temporal::duration_cast<Temporal::Seconds>(Temporal::Days{3}));
+    EXPECT_EQ(unit.unit_str, "days");
+    EXPECT_FALSE(every->end);
+}
+
+TEST(TaskSnapshot, ViewsPointIntoTheImage) {
+    const auto tasks = sample_tasks();
+    const auto bytes = write_task_snapshot(tasks);
+    const TaskSnapshot snapshot{bytes};
+    const auto *begin = reinterpret_cast<const char *>(bytes.data()); // NOLINT
+    const auto *end = begin + bytes.size();                          // NOLINT
+    for (const auto view : snapshot.tasks()) {
+        EXPECT_GE(view.title().data(), begin);
+        EXPECT_LE(view.title().data() + view.title().size(), end);
+    }
+    // Repeated strings are stored once
+    EXPECT_EQ(snapshot[0].tag(0).data(), snapshot[2].tag(1).data());
+}
+
+TEST(TaskSnapshot, ToTask) {
+    const auto tasks = sample_tasks();
+    const auto bytes = write_task_snapshot(tasks);
+    const TaskSnapshot snapshot{bytes};
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        const Task task = snapshot[i].to_task();
+        EXPECT_EQ(task.title(), tasks[i].title());
+        EXPECT_EQ(task.description(), tasks[i].description());
+        EXPECT_EQ(task.tags(), tasks[i].tags());
+        EXPECT_EQ(task.deadline(), tasks[i].deadline());
+        EXPECT_EQ(task.completed(), tasks[i].completed());
+        EXPECT_EQ(task.repeat_rule().has_value(), tasks[i].repeat_rule().has_value());
+        EXPECT_EQ(task.next_deadline(Temporal::TimePoint{Temporal::Days{10}}),
+                  tasks[i].next_deadline(Temporal::TimePoint{Temporal::Days{10}}));
+    }
+}
+
+TEST(TaskSnapshot, At) {
+    const auto bytes = write_task_snapshot(sample_tasks());
+    const TaskSnapshot snapshot{bytes};
+    EXPECT_EQ(snapshot.at(1).title(), "Gym");
+    EXPECT_THROW((void)snapshot.at(3), std::out_of_range);
+}
+
+TEST(TaskSnapshot, RejectsInvalidTasks) {
+    // A zeroed record decodes to a task with an empty title
+    SnapshotWriter writer;
+    writer.add_section(SectionKind::Tasks, std::vector<std::byte>(TaskView::RECORD_SIZE));
+    const auto bytes = writer.finish();
+    const TaskSnapshot snapshot{bytes};
+    ASSERT_EQ(snapshot.size(), 1);
+    EXPECT_EQ(snapshot[0].title(), "");
+    EXPECT_THROW((void)snapshot[0].to_task(), SnapshotError);
+}
+
+TEST(TaskSnapshot, Empty) {
+    const auto bytes = write_task_snapshot({});
+    const TaskSnapshot snapshot{bytes};
+    EXPECT_TRUE(snapshot.empty());
+    EXPECT_TRUE(std::ranges::empty(snapshot.tasks()));
+}
+
+TEST(TaskSnapshot, DetectsCorruption) {
+    const auto tasks = sample_tasks();
+    const auto bytes = write_task_snapshot(tasks);
+
+    auto flipped = bytes;
+    flipped.back() ^= std::byte{0x01};
+    flipped[flipped.size() / 2] ^= std::byte{0x10};
+    EXPECT_THROW(TaskSnapshot{flipped}, SnapshotError);
+
+    auto magic = bytes;
+    magic[0] = std::byte{'X'};
+    EXPECT_THROW(TaskSnapshot{magic}, SnapshotError);
+
+    auto version = bytes;
+    version[4] = std::byte{0xFF};
+    EXPECT_THROW(TaskSnapshot{version}, SnapshotError);
+
+    const std::span<const std::byte> truncated{bytes.data(), bytes.size() / 2};
+    EXPECT_THROW(TaskSnapshot{truncated}, SnapshotError);
+    EXPECT_THROW(TaskSnapshot{std::span<const std::byte>{}}, SnapshotError);
+}
+
+TEST(TaskSnapshot, StructureOnlyVerification) {
+    const auto tasks = sample_tasks();
+    auto bytes = write_task_snapshot(tasks);
+    // Corrupt the title of the first task, its string starts the string table
+    const auto offset = static_cast<std::size_t>(TaskSnapshot{bytes}[0].title().data() -
+                                                 reinterpret_cast<const char *>(bytes.data()));
+    bytes[offset] = std::byte{'w'};
+    EXPECT_THROW(TaskSnapshot{bytes}, SnapshotError);
+    const TaskSnapshot trusted{bytes, Verify::Structure};
+    EXPECT_EQ(trusted[0].title(), "write report");
+}
+
+TEST(SnapshotImage, SkipsUnknownSections) {
+    SnapshotWriter writer;
+    writer.add_section(static_cast<SectionKind>(99), std::vector<std::byte>(5, std::byte{7}));
+    TaskSnapshotWriter tasks;
+    tasks.add(Task{TaskInfo{"Only"}});
+    tasks.write_sections(writer);
+    const auto bytes = writer.finish();
+
+    const SnapshotImage image{bytes};
+    EXPECT_EQ(image.version(), SNAPSHOT_VERSION);
+    EXPECT_EQ(image.section(static_cast<SectionKind>(99)).size(), 5);
+    const TaskSnapshot snapshot{bytes};
+    ASSERT_EQ(snapshot.size(), 1);
+    EXPECT_EQ(snapshot[0].title(), "Only");
+}
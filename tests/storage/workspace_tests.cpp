@@ -0,0 +1,169 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/roadmaps/roadmaps.hpp"
+#include "lines/storage/roadmap_snapshot.hpp"
+#include "lines/storage/workspace.hpp"
+#include "lines/tasks/task.hpp"
+
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Lines;
+using namespace Lines::Storage;
+
+namespace {
+class TempFile {
+    std::filesystem::path _path;
+
+  public:
+    TempFile() {
+        std::random_device random;
+        _path = std::filesystem::temp_directory_path() /
+                ("lines-workspace-" + std::to_string(random()) + std::to_string(random()));
+    }
+    TempFile(const TempFile &) = delete;
+    TempFile(TempFile &&) = delete;
+    auto operator=(const TempFile &) -> TempFile & = delete;
+    auto operator=(TempFile &&) -> TempFile & = delete;
+    ~TempFile() { std::filesystem::remove(_path); }
+
+    LINES_NODISCARD auto path() const -> const std::filesystem::path & { return _path; }
+};
+
+// Two tasks and a roadmap whose node 3 was removed, so ids have a gap
+auto sample_workspace() -> Workspace {
+    Workspace workspace;
+    workspace.tasks.emplace_back(TaskInfo{"Read", "Chapter 3", {"study"}});
+    workspace.tasks.emplace_back(TaskInfo{"Write"});
+    workspace.tasks.back().complete();
+
+    Roadmap &rmap = workspace.roadmaps.emplace_back(RoadmapInfo{"Course", "Autumn", {"uni"}});
+    const auto lectures = rmap.add_node(rmap.root(), RoadmapNodeInfo{"Lectures"});
+    rmap.add_node(lectures, RoadmapNodeInfo{"Week 1", "Intro", {"easy"}});
+    const auto gone = rmap.add_node(lectures, RoadmapNodeInfo{"Week 2"});
+    rmap.add_node(gone, RoadmapNodeInfo{"Homework"})
+        .lock()
+        ->set_state(RoadmapNode::State::Completed);
+    rmap.add_node(rmap.root(), RoadmapNodeInfo{"Exam"});
+    rmap.remove_node(gone.lock()->id());
+    return workspace;
+}
+
+void expect_same_roadmap(Roadmap &actual, Roadmap &expected) {
+    EXPECT_EQ(actual.title(), expected.title());
+    EXPECT_EQ(actual.description(), expected.description());
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t id = 0; id < actual.size(); ++id) {
+        const auto lhs = actual[id].lock();
+        const auto rhs = expected[id].lock();
+        ASSERT_EQ(lhs == nullptr, rhs == nullptr) << "node " << id;
+        if (!lhs) {
+            continue;
+        }
+        EXPECT_EQ(lhs->title(), rhs->title());
+        EXPECT_EQ(lhs->tags(), rhs->tags());
+        EXPECT_EQ(lhs->state(), rhs->state());
+        EXPECT_EQ(lhs->out_degree(), rhs->out_degree());
+        if (!Roadmap::is_root(id)) {
+            EXPECT_EQ(lhs->parent().lock()->id(), rhs->parent().lock()->id());
+        }
+    }
+}
+} // namespace
+
+TEST(WorkspaceSnapshot, PreservesNodeIds) {
+    Workspace workspace = sample_workspace();
+    Workspace loaded = read_workspace_snapshot(write_workspace_snapshot(workspace));
+    ASSERT_EQ(loaded.tasks.size(), 2U);
+    EXPECT_EQ(*loaded.tasks[0].description(), "Chapter 3");
+    EXPECT_TRUE(loaded.tasks[1].completed());
+    ASSERT_EQ(loaded.roadmaps.size(), 1U);
+    expect_same_roadmap(loaded.roadmaps[0], workspace.roadmaps[0]);
+}
+
+TEST(WorkspaceSnapshot, WalksTreeInPlace) {
+    const auto bytes = write_workspace_snapshot(sample_workspace());
+    const RoadmapSnapshot snapshot{bytes};
+    ASSERT_EQ(snapshot.size(), 1U);
+    const RoadmapView rmap = snapshot[0];
+    EXPECT_EQ(rmap.title(), "Course");
+    EXPECT_EQ(rmap.tag(0), "uni");
+    EXPECT_EQ(rmap.node_count(), 4U);
+
+    std::vector<std::string_view> top;
+    for (const NodeView node : rmap.children()) {
+        top.push_back(node.title());
+    }
+    EXPECT_EQ(top, (std::vector<std::string_view>{"Lectures", "Exam"}));
+
+    const NodeView lectures = *rmap.children().begin();
+    EXPECT_EQ(lectures.descendant_count(), 2U);
+    std::vector<RoadmapNode::NodeID> ids;
+    for (const NodeView node : lectures.children()) {
+        ids.push_back(node.id());
+        EXPECT_EQ(node.parent_id(), lectures.id());
+    }
+    // Homework moved up to Lectures when Week 2 was removed
+    EXPECT_EQ(ids, (std::vector<RoadmapNode::NodeID>{2, 4}));
+    EXPECT_EQ(rmap.node(2).state(), RoadmapNode::State::Completed);
+    EXPECT_EQ(*rmap.node(1).description(), "Intro");
+    EXPECT_THROW((void)rmap.node(4), std::out_of_range);
+}
+
+TEST(MappedWorkspace, ReadsInPlaceAndPromotesOnWrite) {
+    const TempFile file;
+    Workspace workspace = sample_workspace();
+    save_workspace_snapshot(file.path(), workspace);
+
+    MappedWorkspace mapped{file.path(), Verify::Checksums};
+    ASSERT_EQ(mapped.task_count(), 2U);
+    ASSERT_EQ(mapped.roadmap_count(), 1U);
+    EXPECT_EQ(mapped.tasks()[0].title(), "Read");
+    EXPECT_EQ(mapped.promoted_count(), 0U);
+    EXPECT_EQ(mapped.find_task(0), nullptr);
+
+    mapped.task(0).set_title("Read again");
+    mapped.roadmap(0).add_node(mapped.roadmap(0).root(), RoadmapNodeInfo{"Retake"});
+    EXPECT_EQ(mapped.promoted_count(), 2U);
+    EXPECT_EQ(mapped.find_task(0)->title(), "Read again");
+    EXPECT_EQ(&mapped.task(0), mapped.find_task(0));
+    // The mapped records stay untouched
+    EXPECT_EQ(mapped.tasks()[0].title(), "Read");
+    EXPECT_THROW((void)mapped.task(2), std::out_of_range);
+
+    // Saving over the mapped file keeps the mapping readable
+    mapped.save(file.path());
+    EXPECT_EQ(mapped.tasks()[0].title(), "Read");
+
+    Workspace saved = MappedWorkspace{file.path()}.to_workspace();
+    ASSERT_EQ(saved.tasks.size(), 2U);
+    EXPECT_EQ(saved.tasks[0].title(), "Read again");
+    EXPECT_TRUE(saved.tasks[1].completed());
+    workspace.roadmaps[0].add_node(workspace.roadmaps[0].root(), RoadmapNodeInfo{"Retake"});
+    expect_same_roadmap(saved.roadmaps[0], workspace.roadmaps[0]);
+}
+
+TEST(MappedWorkspace, RejectsOtherFiles) {
+    const TempFile file;
+    save_workspace_snapshot(file.path(), Workspace{});
+    EXPECT_EQ(MappedWorkspace{file.path()}.task_count(), 0U);
+
+    const std::vector<std::byte> garbage(64, std::byte{0x2A});
+    write_file_atomically(file.path(), garbage);
+    EXPECT_THROW(MappedWorkspace{file.path()}, SnapshotError);
+}
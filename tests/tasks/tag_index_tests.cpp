@@ -0,0 +1,170 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/execution/work_stealing.hpp"
+#include "lines/tasks/tag_index.hpp"
+#include "lines/tasks/task.hpp"
+
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Lines;
+
+namespace {
+using Values = std::vector<Containers::RoaringBitmap::Value>;
+} // namespace
+
+TEST(TagInterner, Intern) {
+    TagInterner interner;
+    const TagId work = interner.intern("work");
+    const TagId home = interner.intern("home");
+
+    EXPECT_NE(work, home);
+    EXPECT_EQ(interner.intern("work"), work);
+    EXPECT_EQ(interner.find("home"), home);
+    EXPECT_FALSE(interner.find("missing"));
+    EXPECT_EQ(interner.name(work), "work");
+    EXPECT_EQ(interner.size(), 2);
+    EXPECT_THROW((void)interner.name(42), std::out_of_range);
+}
+
+TEST(TagIndex, Queries) {
+    std::vector<Task> tasks;
+    tasks.emplace_back(TaskInfo{"a", std::nullopt, {"work", "urgent"}});
+    tasks.emplace_back(TaskInfo{"b", std::nullopt, {"work"}});
+    tasks.emplace_back(TaskInfo{"c", std::nullopt, {"home", "urgent"}});
+    tasks.emplace_back(TaskInfo{"d"});
+
+    TagIndex index;
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        index.track(tasks[id], id);
+    }
+
+    const TagQuery work{"work"};
+    const TagQuery urgent{"urgent"};
+    const TagQuery home{"home"};
+
+    EXPECT_EQ(index.query(work).to_vector(), (Values{0, 1}));
+    EXPECT_EQ(index.query(work & urgent).to_vector(), (Values{0}));
+    EXPECT_EQ(index.query(work | home).to_vector(), (Values{0, 1, 2}));
+    EXPECT_EQ(index.query(urgent & ~work).to_vector(), (Values{2}));
+    EXPECT_EQ(index.query(~urgent).to_vector(), (Values{1, 3}));
+    EXPECT_EQ(index.query(~work & ~home).to_vector(), (Values{3}));
+    EXPECT_TRUE(index.query(TagQuery{"missing"}).empty());
+}
+
+TEST(TagIndex, FollowsSetTags) {
+    std::vector<Task> tasks;
+    tasks.emplace_back(TaskInfo{"a", std::nullopt, {"work"}});
+    tasks.emplace_back(TaskInfo{"b", std::nullopt, {"work"}});
+
+    TagIndex index;
+    index.track(tasks[0], 0);
+    index.track(tasks[1], 1);
+
+    tasks[0].set_tags({"home"});
+    EXPECT_EQ(index.tasks_with("work").to_vector(), (Values{1}));
+    EXPECT_EQ(index.tasks_with("home").to_vector(), (Values{0}));
+
+    // Attachment follows moves
+    tasks.emplace_back(TaskInfo{"c"});
+    tasks[1].set_tags({"home", "work"});
+    EXPECT_EQ(index.tasks_with("home").to_vector(), (Values{0, 1}));
+
+    // Copies are not tracked
+    Task copy = tasks[1];
+    EXPECT_FALSE(copy.attached());
+    copy.set_tags({});
+    EXPECT_EQ(index.tasks_with("work").to_vector(), (Values{1}));
+
+    TagIndex other;
+    EXPECT_THROW(other.track(tasks[0], 0), std::invalid_argument);
+
+    index.untrack(tasks[1]);
+    EXPECT_FALSE(tasks[1].attached());
+    EXPECT_TRUE(index.tasks_with("work").empty());
+    EXPECT_EQ(index.tasks().to_vector(), (Values{0}));
+}
+
+TEST(TagIndex, FollowsAssignment) {
+    std::vector<Task> tasks;
+    tasks.emplace_back(TaskInfo{"a", std::nullopt, {"work"}});
+    tasks.emplace_back(TaskInfo{"b", std::nullopt, {"home"}});
+
+    TagIndex index;
+    index.track(tasks[0], 0);
+    index.track(tasks[1], 1);
+
+    // The target keeps its attachment and reports the new tags
+    const Task detached{TaskInfo{"c", std::nullopt, {"school"}}};
+    tasks[0] = detached;
+    EXPECT_EQ(tasks[0].id(), 0);
+    EXPECT_TRUE(index.tasks_with("work").empty());
+    EXPECT_EQ(index.tasks_with("school").to_vector(), (Values{0}));
+
+    tasks[0] = tasks[1];
+    EXPECT_EQ(index.tasks_with("home").to_vector(), (Values{0, 1}));
+
+    tasks[1] = Task{TaskInfo{"d", std::nullopt, {"gym"}}};
+    EXPECT_EQ(index.tasks_with("gym").to_vector(), (Values{1}));
+    EXPECT_EQ(index.tasks_with("home").to_vector(), (Values{0}));
+
+    // An attached source is left intact
+    tasks[0] = std::move(tasks[1]);
+    EXPECT_EQ(tasks[1].id(), 1);
+    EXPECT_EQ(tasks[1].title(), "d");
+    EXPECT_EQ(index.tasks_with("gym").to_vector(), (Values{0, 1}));
+    EXPECT_TRUE(index.tasks_with("home").empty());
+
+    // A detached target takes the attachment over
+    Task moved{TaskInfo{"e"}};
+    moved = std::move(tasks[0]);
+    EXPECT_EQ(moved.id(), 0);
+    EXPECT_FALSE(tasks[0].attached());
+    moved.set_tags({"yard"});
+    EXPECT_EQ(index.tasks_with("yard").to_vector(), (Values{0}));
+}
+
+TEST(TagIndex, BulkInsert) {
+    const std::vector<std::string> names{"work", "home", "urgent", "later", "rare"};
+    std::vector<Task> tasks;
+    for (std::size_t i = 0; i < 5000; ++i) {
+        Task &task = tasks.emplace_back(TaskInfo{"t"});
+        Tags tags;
+        for (std::size_t tag = 0; tag < names.size(); ++tag) {
+            if ((i * 7 + tag * 3) % (tag + 2) == 0) {
+                tags.emplace_back(names[tag]);
+            }
+        }
+        task.set_tags(std::move(tags));
+    }
+
+    TagIndex serial;
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        serial.insert(id + 3, tasks[id].info().tags);
+    }
+    Execution::WorkStealingExecutor pool{4};
+    TagIndex bulk;
+    bulk.insert(3, tasks, pool);
+
+    EXPECT_EQ(bulk.tasks(), serial.tasks());
+    ASSERT_EQ(bulk.interner().size(), serial.interner().size());
+    for (const auto &name : names) {
+        // Tags are interned in the same order
+        EXPECT_EQ(bulk.interner().find(name), serial.interner().find(name)) << name;
+        EXPECT_EQ(bulk.tasks_with(name), serial.tasks_with(name)) << name;
+    }
+}
@@ -0,0 +1,140 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/execution/timer.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_alarms.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace Lines;
+
+namespace {
+auto at(int64_t seconds) -> Temporal::TimePoint {
+    return Temporal::TimePoint{Temporal::Seconds{seconds}};
+}
+
+// Dispatcher: reports due tasks until `count` were seen
+auto dispatch(TaskAlarms &alarms, std::size_t count, std::vector<TaskID> &seen)
+    -> Execution::Detached {
+    while (seen.size() < count) {
+        seen.push_back(co_await next_due(alarms));
+    }
+}
+} // namespace
+
+TEST(TaskAlarms, ReportsDueTasks) {
+    Execution::ManualClock clock{at(0)};
+    Execution::TimerQueue timers{clock};
+    TaskAlarms alarms{timers};
+    std::vector<Task> tasks;
+    for (int i = 0; i < 5; ++i) {
+        tasks.emplace_back(TaskInfo{"remind me"});
+    }
+    tasks[0].set_deadline(at(30));
+    tasks[1].set_deadline(at(10));
+    tasks[2].set_deadline(at(20));
+    tasks[3].set_deadline(at(10));
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        alarms.track(tasks[id], id);
+    }
+    EXPECT_EQ(timers.next_wakeup(), at(10));
+
+    std::vector<TaskID> seen;
+    dispatch(alarms, 4, seen);
+    clock.set(at(10));
+    timers.run_due();
+    EXPECT_EQ(seen, (std::vector<TaskID>{1, 3}));
+
+    // Completed tasks are not reported, moved deadlines count from the new value
+    tasks[2].complete();
+    tasks[0].set_deadline(at(50));
+    tasks[4].set_deadline(at(40));
+    clock.set(at(45));
+    timers.run_due();
+    EXPECT_EQ(seen, (std::vector<TaskID>{1, 3, 4}));
+    EXPECT_EQ(timers.next_wakeup(), at(50));
+
+    // Setting a passed deadline again reports the task again
+    tasks[1].set_deadline(at(10));
+    clock.set(at(60));
+    timers.run_due();
+    EXPECT_EQ(seen, (std::vector<TaskID>{1, 3, 4, 1}));
+    EXPECT_FALSE(timers.next_wakeup());
+
+    // Without a waiter due tasks are kept for take()
+    tasks[0].set_deadline(at(61));
+    alarms.untrack(tasks[3]);
+    tasks[3].set_deadline(at(61));
+    clock.set(at(70));
+    timers.run_due();
+    EXPECT_EQ(alarms.take(), 0U);
+    EXPECT_FALSE(alarms.take());
+}
+
+TEST(TaskAlarms, ManyFlows) {
+    Execution::ManualClock clock{at(0)};
+    Execution::TimerQueue timers{clock};
+    TaskAlarms alarms{timers};
+    std::vector<Task> tasks;
+    tasks.reserve(1000);
+    for (TaskID id = 0; id < 1000; ++id) {
+        tasks.emplace_back(TaskInfo{"remind me"});
+        tasks.back().set_deadline(at(1000 - id));
+        alarms.track(tasks.back(), id);
+    }
+    // A thousand suspended flows, served in the order they started waiting
+    std::vector<std::vector<TaskID>> seen(1000);
+    for (auto &flow : seen) {
+        dispatch(alarms, 1, flow);
+    }
+    EXPECT_EQ(timers.pending(), 1);
+    clock.set(at(1000));
+    timers.run_due();
+    for (std::size_t flow = 0; flow < seen.size(); ++flow) {
+        ASSERT_EQ(seen[flow], (std::vector<TaskID>{static_cast<TaskID>(999 - flow)}));
+    }
+}
+
+TEST(TaskAlarms, MovedDeadlines) {
+    Execution::ManualClock clock{at(0)};
+    Execution::TimerQueue timers{clock};
+    TaskAlarms alarms{timers};
+    std::vector<Task> tasks(10, Task{TaskInfo{"remind me"}});
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        alarms.track(tasks[id], id);
+    }
+    // Each move leaves a stale alarm behind, the alarms drop them now and then
+    for (int round = 0; round < 1000; ++round) {
+        for (TaskID id = 0; id < tasks.size(); ++id) {
+            tasks[id].set_deadline(at(100 + round + static_cast<int64_t>(id)));
+        }
+    }
+    // Due but not taken yet while the moves continue
+    clock.set(at(1099));
+    timers.run_due();
+    for (int round = 0; round < 1000; ++round) {
+        tasks[9].set_deadline(at(2000 + round));
+    }
+    clock.set(at(1108));
+    timers.run_due();
+    std::vector<TaskID> taken;
+    while (const auto id = alarms.take()) {
+        taken.push_back(*id);
+    }
+    EXPECT_EQ(taken, (std::vector<TaskID>{0, 1, 2, 3, 4, 5, 6, 7, 8}));
+    EXPECT_EQ(timers.next_wakeup(), at(2999));
+}
@@ -0,0 +1,182 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/execution/work_stealing.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_batch.hpp"
+#include "lines/temporal/duration.hpp"
+#include "lines/temporal/timepoint.hpp"
+
+#include "gtest/gtest.h"
+
+#include <utility>
+#include <vector>
+
+using namespace Lines;
+
+namespace {
+auto make_tasks(std::size_t count) -> std::vector<Task> {
+    std::vector<Task> tasks;
+    tasks.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        Task task{TaskInfo{"task"}};
+        if (i % 3 != 0) {
+            task.set_deadline(Temporal::TimePoint{Temporal::Days{static_cast<int64_t>(i % 11)}});
+        }
+        if (i % 7 == 0) {
+            task.complete();
+        }
+        tasks.push_back(std::move(task));
+    }
+    return tasks;
+}
+
+// Every kind of rule, with and without end, deadlines on both sides of day 30
+auto make_repeating_tasks(std::size_t count) -> std::vector<Task> {
+    std::vector<Task> tasks;
+    tasks.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::optional<TaskRepeatRule> rule;
+        const std::optional<Temporal::TimePoint> end =
+            i % 5 == 0 ? std::optional{Temporal::TimePoint{Temporal::Days{33}}} : std::nullopt;
+        if (i % 4 == 1) {
+            const Temporal::Seconds interval{static_cast<int64_t>(i % 6) * 86400};
+            rule = TaskRepeatRule{
+                .repeat_type = TaskRepeat::EveryUnit{.interval = interval, .unit_str = "days"},
+                .end = end};
+        } else if (i % 4 == 2) {
+            std::pmr::vector<Temporal::Weekday> weekdays;
+            weekdays.push_back(static_cast<Temporal::Weekday>(i % 7));
+            weekdays.push_back(static_cast<Temporal::Weekday>((i / 7) % 7));
+            rule = TaskRepeatRule{.repeat_type = TaskRepeat::EveryWeekday{.weekdays = weekdays},
+                                  .end = end};
+        }
+        Task task{TaskInfo{"task"}, rule};
+        if (i % 9 != 0) {
+            task.set_deadline(
+                Temporal::TimePoint{Temporal::Days{static_cast<int64_t>(25 + i % 10)}});
+        }
+        tasks.push_back(std::move(task));
+    }
+    return tasks;
+}
+
+class DeadlineLog : public TaskObserver {
+  public:
+    std::vector<std::pair<TaskID, std::optional<Temporal::TimePoint>>> entries;
+
+    void on_deadline_changed(TaskID id, const Task &task,
+                             const std::optional<Temporal::TimePoint> & /*old_deadline*/) override {
+        entries.emplace_back(id, task.deadline());
+    }
+};
+} // namespace
+
+TEST(TaskBatch, DeadlineEncoding) {
+    EXPECT_EQ(Tasks::encode_deadline(std::nullopt), Tasks::NO_DEADLINE);
+    EXPECT_FALSE(Tasks::decode_deadline(Tasks::NO_DEADLINE));
+
+    const Temporal::TimePoint tp{Temporal::Seconds{42}};
+    EXPECT_EQ(Tasks::encode_deadline(tp), 42);
+    EXPECT_EQ(Tasks::decode_deadline(42), tp);
+}
+
+TEST(TaskBatch, MatchesIsActive) {
+    // Sizes around word boundaries exercise the tail handling
+    for (const std::size_t count : {0, 1, 63, 64, 65, 130, 1000}) {
+        const auto tasks = make_tasks(count);
+        const Temporal::TimePoint now{Temporal::Days{5}};
+
+        const auto gathered = Tasks::is_active(tasks, now);
+        const auto columns =
+            Tasks::is_active(Tasks::deadline_column(tasks), Tasks::completion_bitset(tasks), now);
+
+        ASSERT_EQ(gathered.size(), count);
+        EXPECT_EQ(gathered, columns);
+        EXPECT_EQ(Tasks::is_active(tasks, now, Execution::default_executor()), gathered);
+        for (std::size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(gathered[i], tasks[i].is_active(now)) << i;
+        }
+    }
+}
+
+TEST(TaskBatch, Overdue) {
+    const auto tasks = make_tasks(200);
+    const Temporal::TimePoint now{Temporal::Days{5}};
+
+    const auto overdue = Tasks::is_overdue(tasks, now);
+    const auto columns =
+        Tasks::is_overdue(Tasks::deadline_column(tasks), Tasks::completion_bitset(tasks), now);
+
+    EXPECT_EQ(overdue, columns);
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        const bool expected = !tasks[i].completed() && tasks[i].deadline() &&
+                              *tasks[i].deadline() < now;
+        EXPECT_EQ(overdue[i], expected) << i;
+    }
+}
+
+TEST(TaskBatch, DeadlinePassed) {
+    const std::vector<std::int64_t> deadlines{1, 5, Tasks::NO_DEADLINE, 10};
+    const auto passed =
+        Tasks::deadline_passed(deadlines, Temporal::TimePoint{Temporal::Seconds{5}});
+
+    EXPECT_TRUE(passed[0]);
+    EXPECT_FALSE(passed[1]);
+    EXPECT_FALSE(passed[2]);
+    EXPECT_FALSE(passed[3]);
+}
+
+TEST(TaskBatch, ColumnSizeMismatch) {
+    const std::vector<std::int64_t> deadlines{1, 2};
+    EXPECT_THROW((void)Tasks::is_active(deadlines, Containers::Bitset(3),
+                                        Temporal::TimePoint{Temporal::Seconds{0}}),
+                 std::invalid_argument);
+}
+
+TEST(TaskBatch, AdvanceDeadlinesMatchesSerial) {
+    const Temporal::TimePoint completed_at{Temporal::Days{30} + Temporal::Hours{5}};
+    Execution::InlineExecutor inline_executor;
+    Execution::WorkStealingExecutor pool{4};
+    for (Execution::Executor *executor : {static_cast<Execution::Executor *>(&inline_executor),
+                                          static_cast<Execution::Executor *>(&pool)}) {
+        auto serial = make_repeating_tasks(20'000);
+        auto batch = serial;
+        for (Task &task : serial) {
+            task.advance_deadline(completed_at);
+        }
+        Tasks::advance_deadlines(batch, completed_at, *executor);
+        for (std::size_t i = 0; i < serial.size(); ++i) {
+            ASSERT_EQ(batch[i].deadline(), serial[i].deadline()) << i;
+        }
+    }
+}
+
+TEST(TaskBatch, AdvanceDeadlinesNotifiesInOrder) {
+    const Temporal::TimePoint completed_at{Temporal::Days{30}};
+    auto serial = make_repeating_tasks(10'000);
+    auto batch = serial;
+    DeadlineLog serial_log;
+    DeadlineLog batch_log;
+    for (std::size_t i = 0; i < serial.size(); i += 3) {
+        serial[i].attach(serial_log, static_cast<TaskID>(i));
+        batch[i].attach(batch_log, static_cast<TaskID>(i));
+    }
+    for (Task &task : serial) {
+        task.advance_deadline(completed_at);
+    }
+    Execution::WorkStealingExecutor pool{4};
+    Tasks::advance_deadlines(batch, completed_at, pool);
+    EXPECT_EQ(batch_log.entries, serial_log.entries);
+    EXPECT_EQ(batch_log.entries.size(), 3334U);
+}
@@ -0,0 +1,149 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_dependencies.hpp"
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace Lines;
+
+namespace {
+// Whether `to` can be reached from `from` along blocked -> blocker edges
+auto waits_for(const std::set<std::pair<TaskID, TaskID>> &edges, TaskID from, TaskID to) -> bool {
+    std::vector<TaskID> stack{from};
+    std::set<TaskID> seen{from};
+    while (!stack.empty()) {
+        const TaskID current = stack.back();
+        stack.pop_back();
+        if (current == to) {
+            return true;
+        }
+        for (const auto &[blocked, blocker] : edges) {
+            if (blocked == current && seen.insert(blocker).second) {
+                stack.push_back(blocker);
+            }
+        }
+    }
+    return false;
+}
+} // namespace
+
+TEST(TaskDependencyGraph, ReadySetFollowsCompletion) {
+    std::vector<Task> tasks;
+    for (int i = 0; i < 4; ++i) {
+        tasks.emplace_back(TaskInfo{"task"});
+    }
+    TaskDependencyGraph graph;
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        graph.track(tasks[id], id);
+    }
+    // 3 waits for 1 and 2, both wait for 0
+    EXPECT_TRUE(graph.add_dependency(1, 0));
+    EXPECT_TRUE(graph.add_dependency(2, 0));
+    EXPECT_TRUE(graph.add_dependency(3, 1));
+    EXPECT_TRUE(graph.add_dependency(3, 2));
+    EXPECT_FALSE(graph.add_dependency(3, 2));
+    EXPECT_EQ(graph.dependency_count(), 4);
+    EXPECT_EQ(graph.ready().to_vector(), (std::vector<std::uint32_t>{0}));
+
+    tasks[0].complete();
+    EXPECT_EQ(graph.ready().to_vector(), (std::vector<std::uint32_t>{1, 2}));
+    tasks[1].complete();
+    tasks[2].complete();
+    EXPECT_EQ(graph.ready().to_vector(), (std::vector<std::uint32_t>{3}));
+    tasks[0].uncomplete();
+    EXPECT_EQ(graph.ready().to_vector(), (std::vector<std::uint32_t>{0, 3}));
+
+    EXPECT_THROW(graph.add_dependency(0, 3), std::invalid_argument);
+    EXPECT_THROW(graph.add_dependency(2, 2), std::invalid_argument);
+    EXPECT_THROW(graph.add_dependency(2, 9), std::out_of_range);
+    EXPECT_EQ(graph.dependency_count(), 4);
+
+    EXPECT_TRUE(graph.remove_dependency(3, 2));
+    EXPECT_FALSE(graph.remove_dependency(3, 2));
+    graph.untrack(tasks[1]);
+    EXPECT_FALSE(tasks[1].attached());
+    EXPECT_EQ(graph.size(), 3);
+    EXPECT_EQ(graph.dependency_count(), 1);
+    EXPECT_EQ(std::vector<TaskID>(graph.dependents(0).begin(), graph.dependents(0).end()),
+              (std::vector<TaskID>{2}));
+    EXPECT_EQ(graph.blockers(3).size(), 0);
+    // Without its blockers 3 no longer closes a cycle through 0
+    EXPECT_TRUE(graph.add_dependency(0, 3));
+}
+
+TEST(TaskDependencyGraph, OrderMatchesReachability) {
+    LINES_CONSTEXPR TaskID TASKS = 60;
+    std::mt19937 rng{17};
+    TaskDependencyGraph graph;
+    std::set<std::pair<TaskID, TaskID>> edges;
+    std::vector<bool> completed(TASKS);
+    for (TaskID id = 0; id < TASKS; ++id) {
+        graph.insert(id);
+    }
+    for (int step = 0; step < 2000; ++step) {
+        const TaskID blocked = rng() % TASKS;
+        const TaskID blocker = rng() % TASKS;
+        switch (rng() % 4) {
+        case 0:
+        case 1: {
+            const bool cycle = blocked == blocker || waits_for(edges, blocker, blocked);
+            if (cycle) {
+                EXPECT_THROW(graph.add_dependency(blocked, blocker), std::invalid_argument);
+            } else {
+                EXPECT_EQ(graph.add_dependency(blocked, blocker),
+                          edges.emplace(blocked, blocker).second);
+            }
+            break;
+        }
+        case 2:
+            EXPECT_EQ(graph.remove_dependency(blocked, blocker),
+                      edges.erase({blocked, blocker}) == 1);
+            break;
+        default:
+            completed[blocked] = !completed[blocked];
+            graph.set_completed(blocked, completed[blocked]);
+        }
+
+        for (const auto &[to, from] : edges) {
+            ASSERT_TRUE(graph.precedes(from, to)) << step;
+        }
+        Containers::RoaringBitmap ready;
+        for (TaskID id = 0; id < TASKS; ++id) {
+            bool open = false;
+            for (const auto &[to, from] : edges) {
+                open = open || (to == id && !completed[from]);
+            }
+            if (!completed[id] && !open) {
+                ready.add(id);
+            }
+        }
+        ASSERT_EQ(graph.ready(), ready) << step;
+    }
+    EXPECT_EQ(graph.dependency_count(), edges.size());
+    const auto order = graph.topological_order();
+    ASSERT_EQ(order.size(), TASKS);
+    std::vector<std::size_t> position(TASKS);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        position[order[i]] = i;
+    }
+    for (const auto &[to, from] : edges) {
+        EXPECT_LT(position[from], position[to]);
+    }
+}
@@ -0,0 +1,212 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/execution/work_stealing.hpp"
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_query.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Lines;
+
+namespace {
+auto at(std::int64_t hours) -> Temporal::TimePoint {
+    return Temporal::TimePoint{Temporal::Hours{hours}};
+}
+
+const TaskRepeatRule DAILY{
+    .repeat_type = TaskRepeat::EveryUnit{.interval = Temporal::Seconds{86400}, .unit_str = "days"}};
+
+auto random_tasks(std::size_t count, std::mt19937 &rng) -> std::vector<Task> {
+    const std::vector<std::string> tags{"work", "home", "urgent", "later", "rare"};
+    const std::vector<std::string> words{"Write", "Read", "Call", "Fix", "Plan"};
+    std::vector<Task> tasks;
+    for (std::size_t i = 0; i < count; ++i) {
+        Tags task_tags;
+        for (std::size_t tag = 0; tag < tags.size(); ++tag) {
+            // "rare" is on about one task in a hundred
+            if (rng() % (tag == 4 ? 100 : 3) == 0) {
+                task_tags.emplace_back(tags[tag]);
+            }
+        }
+        const std::string title = words[rng() % words.size()] + " " + std::to_string(i);
+        Task &task = tasks.emplace_back(TaskInfo{title},
+                                        rng() % 4 == 0 ? std::optional{DAILY} : std::nullopt);
+        task.set_tags(std::move(task_tags));
+        if (rng() % 3 != 0) {
+            task.set_deadline(at(static_cast<int64_t>(rng() % 500)));
+        }
+        if (rng() % 4 == 0) {
+            task.complete();
+        }
+    }
+    return tasks;
+}
+
+// Query answered by testing every task, what the index has to agree with
+auto brute_force(const std::vector<Task> &tasks, const TaskQuery &query) -> std::vector<TaskID> {
+    std::vector<TaskID> ids;
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        if (query.where.matches(tasks[id])) {
+            ids.push_back(id);
+        }
+    }
+    if (query.order == TaskOrder::Deadline) {
+        std::ranges::stable_sort(ids, [&](TaskID lhs, TaskID rhs) {
+            const auto &left = tasks[lhs].deadline();
+            const auto &right = tasks[rhs].deadline();
+            if (left.has_value() != right.has_value()) {
+                return left.has_value();
+            }
+            return left && *left < *right;
+        });
+    }
+    const std::size_t first = std::min(query.offset, ids.size());
+    const std::size_t last = std::min(ids.size() - first, query.limit) + first;
+    return {ids.begin() + static_cast<std::ptrdiff_t>(first),
+            ids.begin() + static_cast<std::ptrdiff_t>(last)};
+}
+} // namespace
+
+TEST(TaskQuery, MatchesBruteForce) {
+    std::mt19937 rng{7};
+    auto tasks = random_tasks(3000, rng);
+    TaskQueryIndex index;
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        index.track(tasks[id], id);
+    }
+    using P = TaskPredicate;
+    const std::vector<TaskPredicate> predicates{
+        P::all(),
+        P::tag("work"),
+        P::tag("missing"),
+        P::tag("work") & ~P::completed() & P::deadline_in(at(100), at(268)),
+        P::tag("rare") & P::deadline_in(std::nullopt, at(400)) & ~P::tag("home"),
+        P::title_prefix("Fix 1") | (P::repeating() & P::tag("urgent")),
+        ~(P::tag("work") | P::has_deadline()),
+        P::all_of({}),
+        P::all_of({~P::completed(), ~P::repeating()}),
+        P::title_prefix("Call") & P::deadline_in(at(490), std::nullopt) & P::tag("later"),
+    };
+    for (const auto &predicate : predicates) {
+        for (const auto order : {TaskOrder::Id, TaskOrder::Deadline}) {
+            for (const auto &[offset, limit] :
+                 {std::pair<std::size_t, std::size_t>{0, TaskQuery::NO_LIMIT}, {0, 5}, {10, 20},
+                  {5000, 1}}) {
+                const TaskQuery query{
+                    .where = predicate, .order = order, .offset = offset, .limit = limit};
+                ASSERT_EQ(index.run(query), brute_force(tasks, query)) << index.explain(query);
+            }
+        }
+    }
+}
+
+TEST(TaskQuery, BulkInsert) {
+    std::mt19937 rng{11};
+    const auto tasks = random_tasks(3000, rng);
+    Execution::WorkStealingExecutor pool{4};
+    TaskQueryIndex index;
+    index.insert(0, tasks, pool);
+    EXPECT_EQ(index.size(), tasks.size());
+    using P = TaskPredicate;
+    for (const auto &predicate :
+         {P::all(), P::tag("rare") | P::title_prefix("Fix 2"),
+          P::tag("work") & ~P::completed() & P::deadline_in(at(100), at(268))}) {
+        for (const auto order : {TaskOrder::Id, TaskOrder::Deadline}) {
+            const TaskQuery query{.where = predicate, .order = order};
+            ASSERT_EQ(index.run(query), brute_force(tasks, query)) << index.explain(query);
+        }
+    }
+    // Nothing is indexed if one of the ids is taken
+    EXPECT_THROW(index.insert(static_cast<TaskID>(tasks.size() - 1), tasks, pool),
+                 std::invalid_argument);
+    EXPECT_EQ(index.size(), tasks.size());
+    EXPECT_EQ(index.tags().tasks().cardinality(), tasks.size());
+}
+
+TEST(TaskQuery, FollowsMutations) {
+    std::vector<Task> tasks;
+    tasks.emplace_back(TaskInfo{"Write report", std::nullopt, {"work"}});
+    tasks.emplace_back(TaskInfo{"Gym", std::nullopt, {"home"}});
+    tasks.emplace_back(TaskInfo{"Write tests", std::nullopt, {"work"}});
+    TaskQueryIndex index;
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        index.track(tasks[id], id);
+    }
+    EXPECT_THROW(index.insert(1, tasks[1]), std::invalid_argument);
+
+    using P = TaskPredicate;
+    const TaskQuery due{.where = P::tag("work") & ~P::completed(), .order = TaskOrder::Deadline};
+    EXPECT_EQ(index.run(due), (std::vector<TaskID>{0, 2}));
+
+    tasks[2].set_deadline(at(5));
+    tasks[0].set_deadline(at(9));
+    EXPECT_EQ(index.run(due), (std::vector<TaskID>{2, 0}));
+
+    tasks[2].complete();
+    tasks[1].set_tags({"work"});
+    tasks[1].set_title("Write more");
+    tasks[1].set_repeat_rule(DAILY);
+    EXPECT_EQ(index.run(due), (std::vector<TaskID>{0, 1}));
+    EXPECT_EQ(index.run({.where = P::title_prefix("Write m") & P::repeating()}),
+              (std::vector<TaskID>{1}));
+    EXPECT_EQ(index.run({.where = P::deadline_in(at(5), at(9))}), (std::vector<TaskID>{2}));
+
+    index.untrack(tasks[0]);
+    EXPECT_FALSE(tasks[0].attached());
+    EXPECT_EQ(index.size(), 2);
+    EXPECT_EQ(index.run(due), (std::vector<TaskID>{1}));
+    EXPECT_TRUE(index.run({.where = P::title_prefix("Write r")}).empty());
+}
+
+TEST(TaskQuery, ExplainShowsAccessPaths) {
+    std::mt19937 rng{11};
+    auto tasks = random_tasks(5000, rng);
+    TaskQueryIndex index;
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        index.insert(id, tasks[id]);
+    }
+    using P = TaskPredicate;
+
+    // The rare tag leaves few candidates, the wide deadline range is then
+    // checked on them instead of being materialized
+    const TaskQuery narrow{.where = P::deadline_in(at(0), at(450)) & P::tag("rare") &
+                                    ~P::completed(),
+                           .order = TaskOrder::Deadline,
+                           .limit = 3};
+    const std::string plan = index.explain(narrow);
+    EXPECT_EQ(plan.substr(0, plan.find('\n')).substr(0, 15), "and: intersect ");
+    EXPECT_NE(plan.find("  tag \"rare\": index -> "), std::string::npos) << plan;
+    EXPECT_NE(plan.find("  deadline in [0, 1620000): scan "), std::string::npos) << plan;
+    EXPECT_NE(plan.find("order by deadline: heap top 3"), std::string::npos) << plan;
+    EXPECT_NE(plan.find("offset 0, limit 3 -> 3"), std::string::npos) << plan;
+
+    // Comparable operands are combined as bitmaps, and the first page of a
+    // large result comes from the deadline index
+    const TaskQuery wide{.where = P::tag("work") & ~P::tag("home"),
+                         .order = TaskOrder::Deadline,
+                         .limit = 10};
+    const std::string wide_plan = index.explain(wide);
+    EXPECT_NE(wide_plan.find("not tag \"home\": index, subtract"), std::string::npos)
+        << wide_plan;
+    EXPECT_NE(wide_plan.find("order by deadline: index walk over "), std::string::npos)
+        << wide_plan;
+    EXPECT_EQ(index.run(wide), brute_force(tasks, wide));
+}
@@ -0,0 +1,150 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_sort.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace Lines;
+
+namespace {
+// Deadlines on both sides of the epoch, many ties and some without one
+auto random_tasks(std::size_t count, std::mt19937 &rng) -> std::vector<Task> {
+    std::vector<Task> tasks;
+    tasks.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        Task &task =
+            tasks.emplace_back(TaskInfo{std::string(1, static_cast<char>('a' + rng() % 3))});
+        if (rng() % 5 != 0) {
+            const auto seconds = static_cast<int64_t>(rng() % 2000) - 1000;
+            task.set_deadline(
+                Temporal::TimePoint{Temporal::Seconds{seconds * (i % 2 ? 1 : 86400)}});
+        }
+        if (rng() % 2 == 0) {
+            task.complete();
+        }
+    }
+    return tasks;
+}
+
+auto deadline_before(const std::vector<Task> &tasks) {
+    return [&](std::uint32_t lhs, std::uint32_t rhs) {
+        const auto &left = tasks[lhs].deadline();
+        const auto &right = tasks[rhs].deadline();
+        if (left.has_value() != right.has_value()) {
+            return left.has_value();
+        }
+        return left && *left < *right;
+    };
+}
+} // namespace
+
+TEST(TaskSort, RadixMatchesStableSort) {
+    std::mt19937 rng{3};
+    for (const std::size_t count : {0, 1, 100, 5000}) {
+        const auto tasks = random_tasks(count, rng);
+        auto expected = Tasks::identity_permutation(tasks);
+        std::ranges::stable_sort(expected, deadline_before(tasks));
+        EXPECT_EQ(Tasks::sort_by_deadline(tasks), expected) << count;
+    }
+
+    // A subset keeps its own order among ties
+    const auto tasks = random_tasks(3000, rng);
+    std::vector<std::uint32_t> subset;
+    for (std::uint32_t i = tasks.size(); i-- > 0;) {
+        if (i % 3 != 0) {
+            subset.push_back(i);
+        }
+    }
+    auto expected = subset;
+    std::ranges::stable_sort(expected, deadline_before(tasks));
+    Tasks::sort_by_deadline(subset, tasks);
+    EXPECT_EQ(subset, expected);
+}
+
+TEST(TaskSort, MultiKey) {
+    std::mt19937 rng{5};
+    const auto tasks = random_tasks(4000, rng);
+    auto expected = Tasks::identity_permutation(tasks);
+    const auto before = deadline_before(tasks);
+    std::ranges::stable_sort(expected, [&](std::uint32_t lhs, std::uint32_t rhs) {
+        if (before(lhs, rhs) || before(rhs, lhs)) {
+            return before(lhs, rhs);
+        }
+        return std::tuple{tasks[lhs].completed(), std::string_view{tasks[lhs].title()}} <
+               std::tuple{tasks[rhs].completed(), std::string_view{tasks[rhs].title()}};
+    });
+    auto permutation = Tasks::identity_permutation(tasks);
+    Tasks::sort_by(permutation, tasks);
+    EXPECT_EQ(permutation, expected);
+
+    auto by_title = Tasks::identity_permutation(tasks);
+    Tasks::sort_by(by_title, tasks, {Tasks::SortKey::Title});
+    EXPECT_TRUE(std::ranges::is_sorted(by_title, {}, [&](std::uint32_t index) {
+        return std::string_view{tasks[index].title()};
+    }));
+}
+
+TEST(TaskSort, TopK) {
+    std::mt19937 rng{9};
+    const auto tasks = random_tasks(5000, rng);
+    const auto sorted = Tasks::sort_by_deadline(tasks);
+    for (const std::size_t k : {0, 1, 17, 5000, 6000}) {
+        const auto top = Tasks::top_by_deadline(tasks, k);
+        ASSERT_EQ(top.size(), std::min<std::size_t>(k, tasks.size()));
+        EXPECT_TRUE(std::equal(top.begin(), top.end(), sorted.begin())) << k;
+    }
+
+    std::vector<std::uint32_t> reversed(sorted.rbegin(), sorted.rend());
+    auto expected = reversed;
+    std::ranges::stable_sort(expected, deadline_before(tasks));
+    expected.resize(40);
+    EXPECT_EQ(Tasks::top_by_deadline(reversed, tasks, 40), expected);
+}
+
+TEST(TaskSort, InPlaceMovesAttachments) {
+    std::vector<Task> tasks;
+    for (int i = 0; i < 5; ++i) {
+        tasks.emplace_back(TaskInfo{std::to_string(i)});
+        tasks.back().set_deadline(Temporal::TimePoint{Temporal::Seconds{(i * 3) % 5}});
+    }
+    TaskObserver observer;
+    tasks[4].attach(observer, 4);
+
+    Tasks::sort_by_deadline(std::span<Task>{tasks});
+    std::vector<std::string> titles;
+    for (const Task &task : tasks) {
+        titles.emplace_back(task.title());
+    }
+    EXPECT_EQ(titles, (std::vector<std::string>{"0", "2", "4", "1", "3"}));
+    EXPECT_EQ(tasks[2].id(), 4U);
+    EXPECT_FALSE(tasks[4].attached());
+
+    EXPECT_THROW(Tasks::apply_permutation(tasks, std::vector<std::uint32_t>{0, 1}),
+                 std::invalid_argument);
+    EXPECT_THROW(Tasks::apply_permutation(tasks, std::vector<std::uint32_t>{0, 1, 2, 3, 5}),
+                 std::invalid_argument);
+    EXPECT_THROW(Tasks::apply_permutation(tasks, std::vector<std::uint32_t>{0, 1, 1, 3, 4}),
+                 std::invalid_argument);
+    // Rejected permutations leave the tasks alone
+    EXPECT_EQ(tasks[0].title(), "0");
+    EXPECT_EQ(tasks[2].id(), 4U);
+}
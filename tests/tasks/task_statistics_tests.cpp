@@ -0,0 +1,205 @@
+/*
+  #        #  #     #  # # # #  # # # #
+  #        #  # #   #  #        #
+  #        #  #   # #  # # # #  # # # #
+  #        #  #     #  #              #
+  # # # #  #  #     #  # # # #  # # # #
+  Copyright (c) 2025-2026 I.H.Y.A.D.
+
+  Lines Project, Core library.
+  This file is licensed under GNU Lesser General Public License v3.0 or later.
+  See LICENSE for more information.
+  SPDX-License-Identifier: LGPL-3.0-or-later.
+*/
+#include "lines/tasks/task.hpp"
+#include "lines/tasks/task_statistics.hpp"
+#include "lines/temporal/duration.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace Lines;
+
+namespace {
+auto at(int64_t hours) -> Temporal::TimePoint {
+    return Temporal::TimePoint{Temporal::Hours{hours}};
+}
+
+// Counts computed from scratch, what the statistics have to agree with
+auto recount(const std::vector<Task> &tasks, const Temporal::TimePoint &now,
+             std::string_view tag = {}) -> TaskCounts {
+    TaskCounts counts;
+    for (const Task &task : tasks) {
+        if (!tag.empty() && std::ranges::find(task.info().tags, tag) == task.info().tags.end()) {
+            continue;
+        }
+        ++counts.total;
+        if (task.completed()) {
+            ++counts.completed;
+        } else if (task.is_active(now)) {
+            ++counts.active;
+        } else {
+            ++counts.overdue;
+        }
+    }
+    return counts;
+}
+} // namespace
+
+TEST(TaskStatistics, FollowsMutations) {
+    std::vector<Task> tasks;
+    tasks.emplace_back(TaskInfo{"a", std::nullopt, {"work", "urgent"}});
+    tasks.emplace_back(TaskInfo{"b", std::nullopt, {"work"}});
+    tasks.emplace_back(TaskInfo{"c", std::nullopt, {"home"}});
+    tasks[1].set_deadline(at(1));
+    tasks[2].complete();
+
+    TaskStatistics stats{at(2)};
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        stats.track(tasks[id], id);
+    }
+    EXPECT_EQ(stats.counts(), (TaskCounts{.total = 3, .completed = 1, .active = 1, .overdue = 1}));
+    EXPECT_EQ(stats.counts("work"), (TaskCounts{.total = 2, .active = 1, .overdue = 1}));
+
+    tasks[1].set_deadline(at(5));
+    tasks[0].complete();
+    tasks[2].set_tags({"work", "work"});
+    EXPECT_EQ(stats.counts(), recount(tasks, stats.now()));
+    EXPECT_EQ(stats.counts("work"), recount(tasks, stats.now(), "work"));
+    EXPECT_EQ(stats.counts("home"), TaskCounts{});
+    EXPECT_EQ(stats.counts("missing"), TaskCounts{});
+    EXPECT_EQ(stats.snapshot(), stats.counts());
+
+    stats.untrack(tasks[2]);
+    EXPECT_FALSE(tasks[2].attached());
+    EXPECT_EQ(stats.counts().total, 2U);
+    EXPECT_EQ(stats.counts("work").completed, 1U);
+    EXPECT_THROW(stats.insert(0, tasks[0]), std::invalid_argument);
+}
+
+TEST(TaskStatistics, RejectsAttachedTasks) {
+    Task task{TaskInfo{"a", std::nullopt, {"work"}}};
+    TaskStatistics first{at(0)};
+    TaskStatistics second{at(0)};
+    first.track(task, 0);
+    EXPECT_THROW(second.track(task, 0), std::invalid_argument);
+    EXPECT_EQ(second.counts().total, 0U);
+    first.untrack(task);
+
+    // Several observers share a task through a list
+    TaskObserverList list;
+    list.add(first);
+    list.add(second);
+    first.insert(0, task);
+    second.insert(0, task);
+    task.attach(list, 0);
+    task.complete();
+    EXPECT_EQ(first.counts().completed, 1U);
+    EXPECT_EQ(second.counts("work").completed, 1U);
+}
+
+TEST(TaskStatistics, DeadlineCursor) {
+    std::vector<Task> tasks;
+    for (int64_t hour = 1; hour <= 4; ++hour) {
+        tasks.emplace_back(TaskInfo{"t"});
+        tasks.back().set_deadline(at(hour));
+    }
+    TaskStatistics stats{at(0)};
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        stats.track(tasks[id], id);
+    }
+    EXPECT_EQ(stats.counts().active, 4U);
+
+    // Deadlines are inclusive, like Task::is_active()
+    EXPECT_EQ(stats.advance_to(at(2)), 1U);
+    // A moved deadline leaves its old place in the cursor behind
+    tasks[2].set_deadline(at(10));
+    tasks[3].complete();
+    EXPECT_EQ(stats.advance_to(at(5)), 1U);
+    EXPECT_EQ(stats.counts(), recount(tasks, stats.now()));
+
+    // Going back in time brings overdue tasks back
+    EXPECT_EQ(stats.advance_to(at(0)), 0U);
+    EXPECT_EQ(stats.counts(), (TaskCounts{.total = 4, .completed = 1, .active = 3}));
+    EXPECT_EQ(stats.advance_to(at(11)), 3U);
+    EXPECT_EQ(stats.counts(), recount(tasks, stats.now()));
+}
+
+TEST(TaskStatistics, MatchesRecount) {
+    std::mt19937 random{42};
+    std::vector<Task> tasks;
+    for (int i = 0; i < 200; ++i) {
+        tasks.emplace_back(TaskInfo{"t", std::nullopt, {i % 2 == 0 ? "even" : "odd"}});
+    }
+    TaskStatistics stats{at(0)};
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        stats.track(tasks[id], id);
+    }
+
+    int64_t hour = 0;
+    for (int step = 0; step < 5000; ++step) {
+        Task &task = tasks[random() % tasks.size()];
+        switch (random() % 5) {
+        case 0:
+            task.set_deadline(at(hour + static_cast<int64_t>(random() % 48) - 8));
+            break;
+        case 1:
+            task.set_deadline(std::nullopt);
+            break;
+        case 2:
+            task.completed() ? task.uncomplete() : task.complete();
+            break;
+        case 3:
+            task.set_tags({random() % 2 == 0 ? "even" : "odd", "shared"});
+            break;
+        default:
+            hour += static_cast<int64_t>(random() % 5) - 1;
+            stats.advance_to(at(hour));
+            break;
+        }
+        ASSERT_EQ(stats.counts(), recount(tasks, stats.now())) << "step " << step;
+    }
+    EXPECT_EQ(stats.counts("shared"), recount(tasks, stats.now(), "shared"));
+    EXPECT_EQ(stats.counts("even"), recount(tasks, stats.now(), "even"));
+}
+
+TEST(TaskStatistics, SnapshotFromOtherThread) {
+    std::vector<Task> tasks;
+    for (int i = 0; i < 64; ++i) {
+        tasks.emplace_back(TaskInfo{"t"});
+        tasks.back().set_deadline(at(i));
+    }
+    TaskStatistics stats{at(0)};
+    for (TaskID id = 0; id < tasks.size(); ++id) {
+        stats.track(tasks[id], id);
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> torn{0};
+    std::thread reader{[&] {
+        while (!done.load()) {
+            const TaskCounts counts = stats.snapshot();
+            if (counts.total != 64 ||
+                counts.completed + counts.active + counts.overdue != counts.total) {
+                torn.fetch_add(1);
+            }
+        }
+    }};
+    for (int round = 0; round < 200; ++round) {
+        for (Task &task : tasks) {
+            task.complete();
+        }
+        stats.advance_to(at(round % 64));
+        for (Task &task : tasks) {
+            task.uncomplete();
+        }
+    }
+    done.store(true);
+    reader.join();
+    EXPECT_EQ(torn.load(), 0U);
+    EXPECT_EQ(stats.snapshot(), recount(tasks, stats.now()));
+}
@@ -128,3 +128,68 @@ TEST(Task, AdvanceDeadline) {
     task.advance_deadline(Temporal::TimePoint{Temporal::Days{14}});
     EXPECT_EQ(*task.deadline(), Temporal::TimePoint{Temporal::Days{15}});
 }
+
+namespace {
+struct RecordingObserver : TaskObserver {
+    std::vector<std::string> events;
+
+    void on_title_changed(TaskID id, const Task &task, const std::pmr::string &old_title) override {
+        events.push_back("title " + std::to_string(id) + " " + std::string(old_title) + "->" +
+                         std::string(task.title()));
+    }
+    void on_tags_changed(TaskID /*id*/, const Task & /*task*/, const Tags & /*old_tags*/) override {
+        events.emplace_back("tags");
+    }
+    void on_deadline_changed(TaskID /*id*/, const Task & /*task*/,
+                             const std::optional<Temporal::TimePoint> & /*old*/) override {
+        events.emplace_back("deadline");
+    }
+    void on_completion_changed(TaskID /*id*/, const Task &task) override {
+        events.emplace_back(task.completed() ? "completed" : "uncompleted");
+    }
+};
+} // namespace
+
+TEST(TaskObserver, Notifications) {
+    RecordingObserver observer;
+    Task task{TaskInfo{"old"}};
+    task.attach(observer, 7);
+    EXPECT_EQ(task.id(), 7);
+
+    task.set_title("new");
+    task.set_tags({"tag"});
+    task.complete();
+    task.complete(); // No change, no notification
+    task.uncomplete();
+    task.set_deadline(Temporal::TimePoint{Temporal::Days{1}});
+
+    EXPECT_EQ(observer.events, (std::vector<std::string>{"title 7 old->new", "tags", "completed",
+                                                         "uncompleted", "deadline"}));
+
+    Task moved = std::move(task);
+    EXPECT_TRUE(moved.attached());
+
+    moved.detach();
+    moved.set_title("ignored");
+    EXPECT_EQ(observer.events.size(), 5);
+    EXPECT_FALSE(moved.id());
+}
+
+TEST(TaskObserver, ObserverList) {
+    RecordingObserver first;
+    RecordingObserver second;
+    TaskObserverList list;
+    list.add(first);
+    list.add(second);
+
+    Task task{TaskInfo{"task"}};
+    task.attach(list, 0);
+    task.complete();
+
+    list.remove(second);
+    task.uncomplete();
+
+    EXPECT_EQ(first.events.size(), 2);
+    EXPECT_EQ(second.events.size(), 1);
+    EXPECT_EQ(list.size(), 1);
+}